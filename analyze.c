@@ -0,0 +1,192 @@
+#define _POSIX_C_SOURCE 200809L
+#include "analyze.h"
+#include "board.h"
+#include "movegen.h"
+#include "engine.h"
+#include "epd.h"
+#include "stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+/*
+ * Batch analysis of an EPD file. Worker threads take lines from the
+ * memory-mapped file through a shared cursor, search each position with
+ * their own SearchState (the transposition table is shared) and print one
+ * JSON object per line, in completion order. The "index" field is the
+ * position's 0-based index in the file.
+ */
+
+typedef struct {
+	EpdFile              file;
+	const AnalyzeLimits *limits;
+	pthread_mutex_t      lock;     /* cursor, counters and stdout */
+	size_t               offset;
+	int                  next_index;
+	int                  done;
+	int                  failed;
+	uint64_t             nodes;
+} Analysis;
+
+static int64_t analyze_time_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static int json_string(char *out, const char *s) {
+	int n = 0;
+	out[n++] = '"';
+	for (; *s; s++) {
+		unsigned char c = (unsigned char)*s;
+		if (c == '"' || c == '\\') {
+			out[n++] = '\\';
+			out[n++] = (char)c;
+		} else if (c < 0x20) {
+			n += sprintf(out + n, "\\u%04x", c);
+		} else {
+			out[n++] = (char)c;
+		}
+	}
+	out[n++] = '"';
+	out[n] = '\0';
+	return n;
+}
+
+static int analyze_position(Analysis *a, SearchState *st, volatile int *stop,
+                            int index, const char *line, size_t len,
+                            char *out, bool *ok) {
+	Position p;
+	char fen[256], id[256];
+	const char *ops;
+	size_t ops_len;
+	int n = sprintf(out, "{\"index\":%d", index);
+
+	*ok = epd_parse(line, len, &p, fen, sizeof(fen), &ops, &ops_len);
+	if (!*ok)
+		return n + sprintf(out + n, ",\"error\":\"invalid EPD\"}\n");
+	if (epd_opcode(ops, ops_len, "id", id, sizeof(id))) {
+		n += sprintf(out + n, ",\"id\":");
+		n += json_string(out + n, id);
+	}
+	n += sprintf(out + n, ",\"fen\":");
+	n += json_string(out + n, fen);
+
+	MoveList legal;
+	generate_legal_moves(&p, &legal);
+	if (legal.count == 0)
+		return n + sprintf(out + n, ",\"bestmove\":null,\"score\":{\"%s\":0}}\n",
+		                   is_in_check(&p) ? "mate" : "cp");
+
+	*stop = 0;
+	st->node_limit = a->limits->nodes;
+	int64_t start = analyze_time_ms();
+	Move best;
+	int score = engine_search_state(st, &p, a->limits->depth,
+	                                a->limits->movetime, false, &best);
+	int64_t ms = analyze_time_ms() - start;
+
+	char ms_buf[8];
+	move_to_str(&best, ms_buf);
+	n += sprintf(out + n, ",\"bestmove\":\"%s\",\"score\":", ms_buf);
+	if (score > SCORE_MATE - MAX_PLY)
+		n += sprintf(out + n, "{\"mate\":%d}", (SCORE_MATE - score + 1) / 2);
+	else if (score < -SCORE_MATE + MAX_PLY)
+		n += sprintf(out + n, "{\"mate\":%d}", -(SCORE_MATE + score + 1) / 2);
+	else
+		n += sprintf(out + n, "{\"cp\":%d}", score);
+	n += sprintf(out + n, ",\"depth\":%d,\"nodes\":%llu,\"time\":%lld,\"pv\":\"",
+	             st->completed_depth, (unsigned long long)st->nodes,
+	             (long long)ms);
+
+	Move pv[MAX_PLY];
+	int pv_len = search_state_pv(st, pv);
+	for (int i = 0; i < pv_len; i++) {
+		move_to_str(&pv[i], ms_buf);
+		n += sprintf(out + n, "%s%s", i ? " " : "", ms_buf);
+	}
+	n += sprintf(out + n, "\"");
+	if (STATS_ENABLED) {
+		n += sprintf(out + n, ",\"stats\":");
+		n += stats_json(&st->stats, st->nodes, out + n);
+	}
+	return n + sprintf(out + n, "}\n");
+}
+
+static void *analyze_worker(void *arg) {
+	Analysis *a = arg;
+	volatile int stop = 0;
+	SearchState *st = malloc(sizeof(SearchState));
+	char *out = malloc(2048 + MAX_PLY * 6 + STATS_BUF_SIZE);
+	if (!st || !out) {
+		free(st);
+		free(out);
+		return NULL;
+	}
+	search_state_init(st, &stop);
+
+	for (;;) {
+		const char *line;
+		size_t len;
+		pthread_mutex_lock(&a->lock);
+		bool more = epd_next_line(&a->file, &a->offset, &line, &len);
+		int index = a->next_index++;
+		pthread_mutex_unlock(&a->lock);
+		if (!more) break;
+
+		if (len > 1024) len = 1024;
+		bool ok;
+		int n = analyze_position(a, st, &stop, index, line, len, out, &ok);
+
+		pthread_mutex_lock(&a->lock);
+		fwrite(out, 1, (size_t)n, stdout);
+		a->done++;
+		a->nodes += st->nodes;
+		if (!ok) a->failed++;
+		pthread_mutex_unlock(&a->lock);
+	}
+	free(st);
+	free(out);
+	return NULL;
+}
+
+int analyze_epd(const char *path, const AnalyzeLimits *limits) {
+	Analysis a;
+	memset(&a, 0, sizeof(a));
+	if (!epd_open(&a.file, path)) {
+		fprintf(stderr, "cannot open %s\n", path);
+		return 1;
+	}
+	a.limits = limits;
+	pthread_mutex_init(&a.lock, NULL);
+
+	int threads = limits->threads;
+	if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if (threads <= 0) threads = 1;
+
+	pthread_t *tids = malloc(sizeof(pthread_t) * (size_t)threads);
+	if (!tids) return 1;
+	int64_t start = analyze_time_ms();
+	int started = 0;
+	for (int i = 0; i < threads; i++)
+		if (pthread_create(&tids[started], NULL, analyze_worker, &a) == 0)
+			started++;
+	for (int i = 0; i < started; i++)
+		pthread_join(tids[i], NULL);
+	int64_t ms = analyze_time_ms() - start;
+	fflush(stdout);
+
+	if (ms == 0) ms = 1;
+	fprintf(stderr, "Analyzed %d positions (%d invalid) with %d threads in %.2f s: "
+	        "%.1f positions/s, %llu nps\n",
+	        a.done, a.failed, started, ms / 1000.0, a.done * 1000.0 / ms,
+	        (unsigned long long)(a.nodes * 1000 / (uint64_t)ms));
+
+	free(tids);
+	pthread_mutex_destroy(&a.lock);
+	epd_close(&a.file);
+	return started > 0 ? 0 : 1;
+}
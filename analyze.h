@@ -0,0 +1,15 @@
+#ifndef ANALYZE_H
+#define ANALYZE_H
+
+#include <stdint.h>
+
+typedef struct {
+	int      threads;    /* 0 for one per CPU */
+	int      depth;      /* 0 for no depth limit */
+	uint64_t nodes;      /* per position, 0 for none */
+	int64_t  movetime;   /* ms per position, 0 for none */
+} AnalyzeLimits;
+
+int analyze_epd(const char *path, const AnalyzeLimits *limits);
+
+#endif
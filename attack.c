@@ -1,54 +1,14 @@
 #include "attack.h"
-
-static Bitboard pawn_attack_table[2][64];
-static Bitboard knight_attack_table[64];
-static Bitboard king_attack_table[64];
-
-#define FILE_A  0x0101010101010101ULL
-#define FILE_H  0x8080808080808080ULL
-#define FILE_AB (FILE_A | (FILE_A << 1))
-#define FILE_GH (FILE_H | (FILE_H >> 1))
-
-static void init_pawn_attacks(void) {
-	for (int sq = 0; sq < 64; sq++) {
-		Bitboard bb = 1ULL << sq;
-		pawn_attack_table[WHITE][sq] =
-			((bb & ~FILE_A) << 7) | ((bb & ~FILE_H) << 9);
-		pawn_attack_table[BLACK][sq] =
-			((bb & ~FILE_H) >> 7) | ((bb & ~FILE_A) >> 9);
-	}
-}
-
-static void init_knight_attacks(void) {
-	for (int sq = 0; sq < 64; sq++) {
-		Bitboard bb = 1ULL << sq, a = 0;
-		a |= (bb & ~FILE_A)  << 15;  a |= (bb & ~FILE_H)  << 17;
-		a |= (bb & ~FILE_AB) << 6;   a |= (bb & ~FILE_GH) << 10;
-		a |= (bb & ~FILE_H)  >> 15;  a |= (bb & ~FILE_A)  >> 17;
-		a |= (bb & ~FILE_GH) >> 6;   a |= (bb & ~FILE_AB) >> 10;
-		knight_attack_table[sq] = a;
-	}
-}
-
-static void init_king_attacks(void) {
-	for (int sq = 0; sq < 64; sq++) {
-		Bitboard bb = 1ULL << sq, a = 0;
-		a |= (bb & ~FILE_A) << 7;  a |= bb << 8;  a |= (bb & ~FILE_H) << 9;
-		a |= (bb & ~FILE_H) << 1;  a |= (bb & ~FILE_H) >> 7;
-		a |= bb >> 8;  a |= (bb & ~FILE_A) >> 9;  a |= (bb & ~FILE_A) >> 1;
-		king_attack_table[sq] = a;
-	}
-}
-
-void init_attacks(void) {
-	init_pawn_attacks();
-	init_knight_attacks();
-	init_king_attacks();
-}
+#include "tables.h"
+#include "kernels.h"
 
 Bitboard pawn_attacks(int sq, Color side)   { return pawn_attack_table[side][sq]; }
 Bitboard knight_attacks(int sq)             { return knight_attack_table[sq]; }
 Bitboard king_attacks(int sq)               { return king_attack_table[sq]; }
+Bitboard bishop_pseudo_attacks(int sq)      { return bishop_pseudo_table[sq]; }
+Bitboard rook_pseudo_attacks(int sq)        { return rook_pseudo_table[sq]; }
+Bitboard between_bb(int a, int b)           { return between_table[a][b]; }
+Bitboard line_bb(int a, int b)              { return line_table[a][b]; }
 
 /* Classical ray scanning for sliding pieces */
 static const int bishop_dirs[4][2] = {{-1,1},{1,1},{-1,-1},{1,-1}};
@@ -80,3 +40,13 @@ Bitboard rook_attacks(int sq, Bitboard occ) {
 Bitboard queen_attacks(int sq, Bitboard occ) {
 	return bishop_attacks(sq, occ) | rook_attacks(sq, occ);
 }
+
+/* The fills themselves live in kernels.c */
+void slider_sets(Bitboard rooks, Bitboard bishops, Bitboard queens,
+                 Bitboard occ, SliderSets *s) {
+	kernels->slider_sets(rooks, bishops, queens, occ, s);
+}
+
+const char *slider_kernel(void) {
+	return kernels->simd;
+}
@@ -9,6 +9,25 @@ Bitboard king_attacks(int sq);
 Bitboard bishop_attacks(int sq, Bitboard occ);
 Bitboard rook_attacks(int sq, Bitboard occ);
 Bitboard queen_attacks(int sq, Bitboard occ);
-void     init_attacks(void);
+Bitboard bishop_pseudo_attacks(int sq);
+Bitboard rook_pseudo_attacks(int sq);
+Bitboard between_bb(int a, int b);
+Bitboard line_bb(int a, int b);
+
+/*
+ * Attacks of whole piece sets, one bitboard per direction (N E S W, then
+ * NE NW SW SE), blockers included. While every slider is in occ, rays
+ * running the same way never overlap, so popcounts over the directions
+ * add up to the per-piece totals.
+ */
+typedef struct {
+	Bitboard rook[4];
+	Bitboard bishop[4];
+	Bitboard queen[8];
+} SliderSets;
+
+void        slider_sets(Bitboard rooks, Bitboard bishops, Bitboard queens,
+                        Bitboard occ, SliderSets *s);
+const char *slider_kernel(void);
 
 #endif
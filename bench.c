@@ -0,0 +1,318 @@
+#define _POSIX_C_SOURCE 200809L
+#include "bench.h"
+#include "board.h"
+#include "engine.h"
+#include "bitbase.h"
+#include "move.h"
+#include "nnue.h"
+#include "kernels.h"
+#include "stats.h"
+#include "profile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+static const char *bench_fens[] = {
+	"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+	"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+	"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+	"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+	"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+	"r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+	"r1bqkbnr/pppp1ppp/2n5/1B2p3/4P3/5N2/PPPP1PPP/RNBQK2R b KQkq - 3 3",
+	"r1bq1rk1/pp2bppp/2n1pn2/3p4/2PP4/2N1PN2/PP1B1PPP/R2QKB1R w KQ - 0 8",
+	"2r2rk1/pp3ppp/4p3/3pP3/3P4/P4N2/1P3PPP/2R2RK1 w - - 0 25",
+	"8/5pk1/6p1/8/3R4/6P1/5PK1/r7 w - - 0 40",
+	"8/8/4k3/8/2P5/8/4K3/8 w - - 0 1",
+	"6k1/5p2/6p1/8/7p/8/6PP/6K1 b - - 0 1",
+	"8/8/8/4k3/8/8/8/NNK5 w - - 0 1",   /* KNNK, must score 0 */
+};
+
+#define BENCH_COUNT ((int)(sizeof(bench_fens) / sizeof(bench_fens[0])))
+
+static int64_t bench_time_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+void bench(int depth) {
+	if (depth <= 0) depth = BENCH_DEPTH;
+	uint64_t total_nodes = 0;
+	int64_t total_time = 0;
+	SearchStats total_stats = {0};
+
+	int kpk_positions, kpk_bytes;
+	bitbase_stats(&kpk_positions, &kpk_bytes);
+	printf("KPK bitbase: %d positions, %d bytes\n", kpk_positions, kpk_bytes);
+	printf("Kernels: %s (%s)\n\n", kernels_name(), kernels->simd);
+	profile_reset();
+
+	for (int i = 0; i < BENCH_COUNT; i++) {
+		Position pos;
+		if (!position_from_fen(&pos, bench_fens[i])) {
+			printf("bad bench FEN: %s\n", bench_fens[i]);
+			continue;
+		}
+		engine_init();
+		Move best;
+		int64_t start = bench_time_ms();
+		int score = engine_search(&pos, depth, &best);
+		int64_t elapsed = bench_time_ms() - start;
+		uint64_t n = engine_nodes();
+		char buf[8];
+		move_to_str(&best, buf);
+		printf("%2d/%d  %-6s %+6d  nodes %10llu  time %6lld ms\n",
+		       i + 1, BENCH_COUNT, buf, score,
+		       (unsigned long long)n, (long long)elapsed);
+		total_nodes += n;
+		total_time += elapsed;
+		stats_add(&total_stats, engine_last_stats());
+	}
+
+	if (total_time == 0) total_time = 1;
+	printf("\nDepth:  %d\n", depth);
+	printf("Nodes:  %llu\n", (unsigned long long)total_nodes);
+	printf("Time:   %lld ms\n", (long long)total_time);
+	printf("NPS:    %llu\n",
+	       (unsigned long long)(total_nodes * 1000 / (uint64_t)total_time));
+	if (STATS_ENABLED) {
+		printf("\n");
+		stats_print(&total_stats, total_nodes);
+	}
+	if (PROF_ENABLED) {
+		printf("\n");
+		profile_report("");
+	}
+	fflush(stdout);
+}
+
+static uint64_t perft_rec(const Position *p, int depth) {
+	MoveList list;
+	generate_legal_moves(p, &list);
+	if (depth == 1) return (uint64_t)list.count;
+	uint64_t n = 0;
+	for (int i = 0; i < list.count; i++) {
+		Position child = *p;
+		make_move(&child, &list.moves[i]);
+		n += perft_rec(&child, depth - 1);
+	}
+	return n;
+}
+
+uint64_t perft(const Position *p, int depth) {
+	if (depth <= 0) return 1;
+	return perft_rec(p, depth);
+}
+
+void perft_divide(const Position *p, int depth) {
+	if (depth <= 0) depth = 1;
+	MoveList list;
+	generate_legal_moves(p, &list);
+	uint64_t total = 0;
+	int64_t start = bench_time_ms();
+	for (int i = 0; i < list.count; i++) {
+		Position child = *p;
+		make_move(&child, &list.moves[i]);
+		uint64_t n = perft(&child, depth - 1);
+		char buf[8];
+		move_to_str(&list.moves[i], buf);
+		printf("%-6s %llu\n", buf, (unsigned long long)n);
+		total += n;
+	}
+	int64_t elapsed = bench_time_ms() - start;
+	if (elapsed == 0) elapsed = 1;
+	printf("\nNodes:  %llu\n", (unsigned long long)total);
+	printf("Time:   %lld ms\n", (long long)elapsed);
+	printf("NPS:    %llu\n",
+	       (unsigned long long)(total * 1000 / (uint64_t)elapsed));
+	fflush(stdout);
+}
+
+/* Per-call cost of evaluate and legal move generation over the bench set */
+void bench_micro(int iterations) {
+	if (iterations <= 0) iterations = BENCH_MICRO_ITERS;
+	Position pos[BENCH_COUNT];
+	for (int i = 0; i < BENCH_COUNT; i++)
+		position_from_fen(&pos[i], bench_fens[i]);
+
+	volatile int sink = 0;
+	struct timespec t0, t1;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (int it = 0; it < iterations; it++)
+		for (int i = 0; i < BENCH_COUNT; i++)
+			sink += evaluate(&pos[i]);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	double eval_ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec))
+	               / ((double)iterations * BENCH_COUNT);
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (int it = 0; it < iterations; it++)
+		for (int i = 0; i < BENCH_COUNT; i++) {
+			MoveList list;
+			generate_legal_moves(&pos[i], &list);
+			sink += list.count;
+		}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	double gen_ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec))
+	              / ((double)iterations * BENCH_COUNT);
+
+	/* What a search node pays: one attack map shared by eval and movegen */
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (int it = 0; it < iterations; it++)
+		for (int i = 0; i < BENCH_COUNT; i++) {
+			AttackInfo ai;
+			MoveList list;
+			compute_attack_info(&pos[i], &ai);
+			sink += evaluate_ai(&pos[i], &ai);
+			generate_moves(&pos[i], &ai, &list);
+			sink += list.count;
+		}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	double node_ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec))
+	               / ((double)iterations * BENCH_COUNT);
+
+	/* Child evaluation as the search sees it: classic from scratch
+	 * versus an NNUE accumulator advanced by make_move */
+	MoveList moves[BENCH_COUNT];
+	long child_count = 0;
+	for (int i = 0; i < BENCH_COUNT; i++) {
+		generate_legal_moves(&pos[i], &moves[i]);
+		child_count += moves[i].count;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (int it = 0; it < iterations; it++)
+		for (int i = 0; i < BENCH_COUNT; i++)
+			for (int m = 0; m < moves[i].count; m++) {
+				Position child = pos[i];
+				AttackInfo ai;
+				make_move(&child, &moves[i].moves[m]);
+				compute_attack_info(&child, &ai);
+				sink += evaluate_ai(&child, &ai);
+			}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	double classic_ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec))
+	                  / ((double)iterations * child_count);
+
+	NnueAccumulator acc[2];
+	nnue_init();
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (int it = 0; it < iterations; it++)
+		for (int i = 0; i < BENCH_COUNT; i++) {
+			Position root = pos[i];
+			root.acc = &acc[0];
+			nnue_refresh(&root);
+			sink += nnue_evaluate(&root);
+		}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	double refresh_ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec))
+	                  / ((double)iterations * BENCH_COUNT);
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (int it = 0; it < iterations; it++)
+		for (int i = 0; i < BENCH_COUNT; i++) {
+			Position root = pos[i];
+			root.acc = &acc[0];
+			nnue_refresh(&root);
+			for (int m = 0; m < moves[i].count; m++) {
+				Position child = root;
+				make_move(&child, &moves[i].moves[m]);
+				sink += nnue_evaluate(&child);
+			}
+		}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	double nnue_ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec))
+	               / ((double)iterations * child_count);
+
+	printf("evaluate:             %8.1f ns/call\n", eval_ns);
+	printf("generate_legal_moves: %8.1f ns/call\n", gen_ns);
+	printf("shared eval+movegen:  %8.1f ns/call\n", node_ns);
+	printf("make_move+classic:    %8.1f ns/call  %6.2f M evals/s\n",
+	       classic_ns, 1e3 / classic_ns);
+	printf("nnue refresh+eval:    %8.1f ns/call  %6.2f M evals/s\n",
+	       refresh_ns, 1e3 / refresh_ns);
+	printf("make_move+nnue:       %8.1f ns/call  %6.2f M evals/s (%s)\n",
+	       nnue_ns, 1e3 / nnue_ns, nnue_kernel());
+	fflush(stdout);
+	(void)sink;
+}
+
+/* Time from fork to "uciok" of one "gce --uci" child, in microseconds */
+static double startup_once(void) {
+	int to_child[2], from_child[2];
+	if (pipe(to_child) < 0) return -1;
+	if (pipe(from_child) < 0) {
+		close(to_child[0]);
+		close(to_child[1]);
+		return -1;
+	}
+	struct timespec t0, t1;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	pid_t pid = fork();
+	if (pid == 0) {
+		dup2(to_child[0], STDIN_FILENO);
+		dup2(from_child[1], STDOUT_FILENO);
+		close(to_child[1]);
+		close(from_child[0]);
+		execl("/proc/self/exe", "gce", "--uci", (char *)NULL);
+		_exit(127);
+	}
+	close(to_child[0]);
+	close(from_child[1]);
+	if (pid < 0) {
+		close(to_child[1]);
+		close(from_child[0]);
+		return -1;
+	}
+
+	static const char hello[] = "uci\n", bye[] = "quit\n";
+	char buf[4096];
+	size_t len = 0;
+	bool ok = write(to_child[1], hello, sizeof(hello) - 1) > 0;
+	while (ok) {
+		ssize_t n = read(from_child[0], buf + len, sizeof(buf) - 1 - len);
+		if (n <= 0) {
+			ok = false;
+			break;
+		}
+		len += (size_t)n;
+		buf[len] = '\0';
+		if (strstr(buf, "uciok\n")) break;
+		if (len == sizeof(buf) - 1) ok = false;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	if (write(to_child[1], bye, sizeof(bye) - 1) < 0) ok = false;
+	close(to_child[1]);
+	close(from_child[0]);
+	waitpid(pid, NULL, 0);
+	if (!ok) return -1;
+	return (t1.tv_sec - t0.tv_sec) * 1e6 + (t1.tv_nsec - t0.tv_nsec) / 1e3;
+}
+
+static int cmp_double(const void *a, const void *b) {
+	double x = *(const double *)a, y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+/* What a GUI or match runner pays to get a fresh engine to "uciok" */
+int bench_startup(int runs) {
+	if (runs <= 0) runs = BENCH_STARTUP_RUNS;
+	double *us = malloc(sizeof(double) * (size_t)runs);
+	if (!us) return 1;
+	for (int i = 0; i < runs; i++) {
+		if ((us[i] = startup_once()) < 0) {
+			fprintf(stderr, "could not run gce --uci\n");
+			free(us);
+			return 1;
+		}
+	}
+	qsort(us, (size_t)runs, sizeof(double), cmp_double);
+	printf("spawn to uciok over %d runs: min %.0f us, median %.0f us, max %.0f us\n",
+	       runs, us[0], us[runs / 2], us[runs - 1]);
+	fflush(stdout);
+	free(us);
+	return 0;
+}
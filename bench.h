@@ -0,0 +1,16 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "board.h"
+
+#define BENCH_DEPTH       8
+#define BENCH_MICRO_ITERS 100000
+#define BENCH_STARTUP_RUNS 50
+
+void     bench(int depth);
+void     bench_micro(int iterations);
+int      bench_startup(int runs);
+uint64_t perft(const Position *p, int depth);
+void     perft_divide(const Position *p, int depth);
+
+#endif
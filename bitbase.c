@@ -0,0 +1,25 @@
+#include "bitbase.h"
+#include "tables.h"
+
+bool kpk_probe(Color strong, int strong_ksq, int psq, int weak_ksq,
+               Color side_to_move) {
+	/* Normalise: strong side plays up the board with the pawn on a-d */
+	if (strong == BLACK) {
+		strong_ksq ^= 56;
+		weak_ksq ^= 56;
+		psq ^= 56;
+	}
+	if (SQ_FILE(psq) >= 4) {
+		strong_ksq ^= 7;
+		weak_ksq ^= 7;
+		psq ^= 7;
+	}
+	Color stm = (side_to_move == strong) ? WHITE : BLACK;
+	int idx = kpk_index(stm, weak_ksq, strong_ksq, psq);
+	return (kpk_table[idx >> 5] >> (idx & 31)) & 1;
+}
+
+void bitbase_stats(int *positions, int *bytes) {
+	if (positions) *positions = KPK_SIZE;
+	if (bytes) *bytes = (int)sizeof(kpk_table);
+}
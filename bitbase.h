@@ -0,0 +1,22 @@
+#ifndef BITBASE_H
+#define BITBASE_H
+
+#include "board.h"
+
+/*
+ * KPK bitbase, generated at build time by gentables. The strong side is
+ * normalised to white with the pawn on files a-d, which leaves
+ * 2 (side) * 64 (wk) * 64 (bk) * 24 (pawn) positions, one bit each.
+ */
+#define KPK_SIZE (2 * 64 * 64 * 24)
+
+static inline int kpk_index(Color stm, int bksq, int wksq, int psq) {
+	return wksq | (bksq << 6) | (stm << 12) | (SQ_FILE(psq) << 13)
+	     | ((6 - SQ_RANK(psq)) << 15);
+}
+
+bool kpk_probe(Color strong, int strong_ksq, int psq, int weak_ksq,
+               Color side_to_move);
+void bitbase_stats(int *positions, int *bytes);
+
+#endif
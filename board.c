@@ -1,41 +1,23 @@
 #include "board.h"
 #include "attack.h"
+#include "tables.h"
+#include "kernels.h"
+#include "profile.h"
 #include <stdio.h>
 #include <string.h>
 
-static uint64_t piece_keys[2][NUM_PIECE_TYPES][64];
-static uint64_t side_key;
-static uint64_t castling_keys[16];
-static uint64_t ep_keys[8];
-
-static uint64_t xorshift64(uint64_t *state) {
-	uint64_t x = *state;
-	x ^= x << 13;
-	x ^= x >> 7;
-	x ^= x << 17;
-	*state = x;
-	return x;
-}
-
-void init_zobrist(void) {
-	uint64_t state = 0x4D595A6F62726973ULL;
-	for (int c = 0; c < 2; c++)
-		for (int p = 0; p < NUM_PIECE_TYPES; p++)
-			for (int s = 0; s < 64; s++)
-				piece_keys[c][p][s] = xorshift64(&state);
-	side_key = xorshift64(&state);
-	for (int i = 0; i < 16; i++)
-		castling_keys[i] = xorshift64(&state);
-	for (int i = 0; i < 8; i++)
-		ep_keys[i] = xorshift64(&state);
+uint64_t zobrist_piece_key(int color, int piece_type, int sq) {
+	return zobrist_piece[color][piece_type][sq];
 }
+uint64_t zobrist_side_key(void)        { return zobrist_side; }
+uint64_t zobrist_castling_key(int r)   { return zobrist_castling[r & 0x0F]; }
+uint64_t zobrist_ep_key(int file)      { return zobrist_ep[file & 7]; }
 
-uint64_t zobrist_piece_key(int color, int piece_type, int sq) {
-	return piece_keys[color][piece_type][sq];
+/* The material key XORs one piece key per (colour, type, count) slot,
+ * reusing the square index as the count. */
+uint64_t zobrist_material_key(int color, int piece_type, int count) {
+	return zobrist_piece[color][piece_type][count & 63];
 }
-uint64_t zobrist_side_key(void)        { return side_key; }
-uint64_t zobrist_castling_key(int r)   { return castling_keys[r & 0x0F]; }
-uint64_t zobrist_ep_key(int file)      { return ep_keys[file & 7]; }
 
 uint64_t compute_hash(const Position *p) {
 	uint64_t h = 0;
@@ -44,16 +26,27 @@ uint64_t compute_hash(const Position *p) {
 			Bitboard bb = p->pieces[c][pt];
 			while (bb) {
 				int sq = __builtin_ctzll(bb);
-				h ^= piece_keys[c][pt][sq];
+				h ^= zobrist_piece[c][pt][sq];
 				bb &= bb - 1;
 			}
 		}
-	if (!p->white_turn) h ^= side_key;
-	h ^= castling_keys[p->castling & 0x0F];
-	if (p->en_passant >= 0) h ^= ep_keys[p->en_passant & 7];
+	if (!p->white_turn) h ^= zobrist_side;
+	h ^= zobrist_castling[p->castling & 0x0F];
+	if (p->en_passant >= 0) h ^= zobrist_ep[p->en_passant & 7];
 	return h;
 }
 
+uint64_t compute_material_key(const Position *p) {
+	uint64_t k = 0;
+	for (int c = 0; c < 2; c++)
+		for (int pt = 0; pt < KING; pt++) {
+			int n = __builtin_popcountll(p->pieces[c][pt]);
+			for (int i = 0; i < n; i++)
+				k ^= zobrist_piece[c][pt][i];
+		}
+	return k;
+}
+
 bool position_from_fen(Position *p, const char *fen) {
 	memset(p, 0, sizeof(Position));
 	p->en_passant = -1;
@@ -139,9 +132,46 @@ bool position_from_fen(Position *p, const char *fen) {
 	}
 
 	p->hash = compute_hash(p);
+	p->material_key = compute_material_key(p);
 	return true;
 }
 
+/* fen must hold FEN_MAX bytes */
+void position_to_fen(const Position *p, char *fen) {
+	char *s = fen;
+	for (int rank = 7; rank >= 0; rank--) {
+		int empty = 0;
+		for (int file = 0; file < 8; file++) {
+			char c = piece_at(p, rank * 8 + file);
+			if (c == '.') {
+				empty++;
+				continue;
+			}
+			if (empty) *s++ = (char)('0' + empty);
+			empty = 0;
+			*s++ = c;
+		}
+		if (empty) *s++ = (char)('0' + empty);
+		if (rank > 0) *s++ = '/';
+	}
+	*s++ = ' ';
+	*s++ = p->white_turn ? 'w' : 'b';
+	*s++ = ' ';
+	if (!p->castling) *s++ = '-';
+	if (p->castling & CASTLE_WK) *s++ = 'K';
+	if (p->castling & CASTLE_WQ) *s++ = 'Q';
+	if (p->castling & CASTLE_BK) *s++ = 'k';
+	if (p->castling & CASTLE_BQ) *s++ = 'q';
+	*s++ = ' ';
+	if (p->en_passant >= 0) {
+		*s++ = (char)('a' + SQ_FILE(p->en_passant));
+		*s++ = (char)('1' + SQ_RANK(p->en_passant));
+	} else {
+		*s++ = '-';
+	}
+	sprintf(s, " %d %d", p->halfmove, p->fullmove);
+}
+
 void init_position(Position *p) {
 	memset(p, 0, sizeof(Position));
 	p->pieces[WHITE][PAWN]   = 0x000000000000FF00ULL;
@@ -162,6 +192,7 @@ void init_position(Position *p) {
 	p->halfmove   = 0;
 	p->fullmove   = 1;
 	p->hash       = compute_hash(p);
+	p->material_key = compute_material_key(p);
 }
 
 Bitboard pieces_by_color(const Position *p, Color c) {
@@ -239,3 +270,22 @@ bool is_in_check(const Position *p) {
 	return is_square_attacked(p, __builtin_ctzll(king),
 		p->white_turn ? BLACK : WHITE);
 }
+
+/* Pieces of both colours attacking sq, with sliders seeing through occ */
+Bitboard attackers_to(const Position *p, int sq, Bitboard occ) {
+	Bitboard bq = p->pieces[WHITE][BISHOP] | p->pieces[BLACK][BISHOP]
+	            | p->pieces[WHITE][QUEEN]  | p->pieces[BLACK][QUEEN];
+	Bitboard rq = p->pieces[WHITE][ROOK]   | p->pieces[BLACK][ROOK]
+	            | p->pieces[WHITE][QUEEN]  | p->pieces[BLACK][QUEEN];
+	return (pawn_attacks(sq, BLACK) & p->pieces[WHITE][PAWN])
+	     | (pawn_attacks(sq, WHITE) & p->pieces[BLACK][PAWN])
+	     | (knight_attacks(sq) & (p->pieces[WHITE][KNIGHT] | p->pieces[BLACK][KNIGHT]))
+	     | (king_attacks(sq) & (p->pieces[WHITE][KING] | p->pieces[BLACK][KING]))
+	     | (bishop_attacks(sq, occ) & bq)
+	     | (rook_attacks(sq, occ) & rq);
+}
+
+/* Built per ISA level in kernels.c */
+void compute_attack_info(const Position *p, AttackInfo *ai) {
+	PROF(PROF_ATTACK_INFO, kernels->attack_info(p, ai));
+}
@@ -29,6 +29,9 @@ typedef uint64_t Bitboard;
 #define SQ_G8 62
 #define SQ_H8 63
 
+/* Longest FEN, with its terminator */
+#define FEN_MAX 128
+
 #define SQ_FILE(sq) ((sq) & 7)
 #define SQ_RANK(sq) ((sq) >> 3)
 
@@ -40,6 +43,8 @@ typedef enum {
 
 typedef enum { WHITE = 0, BLACK = 1 } Color;
 
+struct NnueAccumulator;
+
 typedef struct {
 	Bitboard pieces[2][NUM_PIECE_TYPES];
 	bool white_turn;
@@ -48,17 +53,33 @@ typedef struct {
 	int halfmove;
 	int fullmove;
 	uint64_t hash;
+	uint64_t material_key;
+	struct NnueAccumulator *acc;  /* NNUE slot that make_move advances;
+	                                 NULL outside an NNUE search */
 } Position;
 
-void     init_zobrist(void);
+/* Attack maps for both colours, computed once per node and shared by
+ * evaluation and move generation. */
+typedef struct {
+	Bitboard by_color[2];
+	Bitboard by_piece[2][NUM_PIECE_TYPES];
+	Bitboard piece_attacks[64];   /* attacks of each side-to-move piece */
+	Bitboard checkers;            /* enemy pieces giving check */
+	Bitboard pinned;              /* side-to-move pieces pinned to the king */
+	int      mobility[2];         /* knight..queen moves not onto own pieces */
+} AttackInfo;
+
 uint64_t compute_hash(const Position *p);
+uint64_t compute_material_key(const Position *p);
 uint64_t zobrist_piece_key(int color, int piece_type, int sq);
 uint64_t zobrist_side_key(void);
 uint64_t zobrist_castling_key(int rights);
 uint64_t zobrist_ep_key(int file);
+uint64_t zobrist_material_key(int color, int piece_type, int count);
 
 void init_position(Position *p);
 bool position_from_fen(Position *p, const char *fen);
+void position_to_fen(const Position *p, char *fen);
 
 Bitboard  occupied(const Position *p);
 Bitboard  pieces_by_color(const Position *p, Color c);
@@ -67,7 +88,9 @@ PieceType piece_type_at(const Position *p, int sq);
 Color     piece_color_at(const Position *p, int sq);
 void      print_board(const Position *p);
 
-bool is_square_attacked(const Position *p, int sq, Color by);
-bool is_in_check(const Position *p);
+bool     is_square_attacked(const Position *p, int sq, Color by);
+bool     is_in_check(const Position *p);
+Bitboard attackers_to(const Position *p, int sq, Bitboard occ);
+void     compute_attack_info(const Position *p, AttackInfo *ai);
 
 #endif
@@ -0,0 +1,63 @@
+#include "kernels.h"
+#include <string.h>
+
+/*
+ * Runtime ISA dispatch. kernels.c is compiled as kernels_generic for any
+ * target and, on x86-64, also as kernels_v2 (SSE4.2, POPCNT) and
+ * kernels_v3 (AVX2, BMI2, LZCNT); a constructor points kernels at the
+ * best one this CPU runs, so one binary serves every machine.
+ */
+extern const Kernels kernels_generic;
+#if defined(__x86_64__)
+extern const Kernels kernels_v2, kernels_v3;
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 12
+#define HAS_V3() __builtin_cpu_supports("x86-64-v3")
+#define HAS_V2() __builtin_cpu_supports("x86-64-v2")
+#else
+#define HAS_V3() (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2") \
+                  && __builtin_cpu_supports("fma"))
+#define HAS_V2() (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt"))
+#endif
+#endif
+
+typedef struct {
+	const char    *name;
+	const Kernels *k;
+} KernelLevel;
+
+static KernelLevel levels[3];
+static int         n_levels;
+
+const Kernels *kernels = &kernels_generic;
+static const char *current = "generic";
+
+static void __attribute__((constructor)) kernels_detect(void) {
+#if defined(__x86_64__)
+	__builtin_cpu_init();
+	if (HAS_V3()) levels[n_levels++] = (KernelLevel){ "x86-64-v3", &kernels_v3 };
+	if (HAS_V2()) levels[n_levels++] = (KernelLevel){ "x86-64-v2", &kernels_v2 };
+#endif
+	levels[n_levels++] = (KernelLevel){ "generic", &kernels_generic };
+	kernels = levels[0].k;
+	current = levels[0].name;
+}
+
+const char *kernels_name(void) {
+	return current;
+}
+
+const char *kernels_level(int i) {
+	return i >= 0 && i < n_levels ? levels[i].name : NULL;
+}
+
+/* Fails for levels this CPU or build lacks */
+bool kernels_select(const char *name) {
+	for (int i = 0; i < n_levels; i++)
+		if (strcmp(levels[i].name, name) == 0) {
+			kernels = levels[i].k;
+			current = levels[i].name;
+			return true;
+		}
+	return false;
+}
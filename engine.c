@@ -2,318 +2,101 @@
 #include "engine.h"
 #include "move.h"
 #include "attack.h"
+#include "material.h"
+#include "bitbase.h"
+#include "tt.h"
+#include "evalparams.h"
+#include "nnue.h"
+#include "kernels.h"
+#include "stats.h"
+#include "profile.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
 
-#define VAL_PAWN   100
-#define VAL_KNIGHT 320
-#define VAL_BISHOP 330
-#define VAL_ROOK   500
-#define VAL_QUEEN  900
-#define VAL_KING   20000
-
-static const int piece_value[7] = {
+const int piece_value[7] = {
 	VAL_PAWN, VAL_KNIGHT, VAL_BISHOP, VAL_ROOK, VAL_QUEEN, VAL_KING, 0
 };
 
-static const int pst_pawn[64] = {
-	  0,   0,   0,   0,   0,   0,   0,   0,
-	  5,  10,  10, -20, -20,  10,  10,   5,
-	  5,  -5, -10,   0,   0, -10,  -5,   5,
-	  0,   0,   0,  20,  20,   0,   0,   0,
-	  5,   5,  10,  25,  25,  10,   5,   5,
-	 10,  10,  20,  30,  30,  20,  10,  10,
-	 50,  50,  50,  50,  50,  50,  50,  50,
-	  0,   0,   0,   0,   0,   0,   0,   0
-};
-static const int pst_knight[64] = {
-	-50, -40, -30, -30, -30, -30, -40, -50,
-	-40, -20,   0,   5,   5,   0, -20, -40,
-	-30,   5,  10,  15,  15,  10,   5, -30,
-	-30,   0,  15,  20,  20,  15,   0, -30,
-	-30,   5,  15,  20,  20,  15,   5, -30,
-	-30,   0,  10,  15,  15,  10,   0, -30,
-	-40, -20,   0,   0,   0,   0, -20, -40,
-	-50, -40, -30, -30, -30, -30, -40, -50
-};
-static const int pst_bishop[64] = {
-	-20, -10, -10, -10, -10, -10, -10, -20,
-	-10,   5,   0,   0,   0,   0,   5, -10,
-	-10,  10,  10,  10,  10,  10,  10, -10,
-	-10,   0,  10,  10,  10,  10,   0, -10,
-	-10,   5,   5,  10,  10,   5,   5, -10,
-	-10,   0,   5,  10,  10,   5,   0, -10,
-	-10,   0,   0,   0,   0,   0,   0, -10,
-	-20, -10, -10, -10, -10, -10, -10, -20
-};
-static const int pst_rook[64] = {
-	  0,   0,   0,   5,   5,   0,   0,   0,
-	 -5,   0,   0,   0,   0,   0,   0,  -5,
-	 -5,   0,   0,   0,   0,   0,   0,  -5,
-	 -5,   0,   0,   0,   0,   0,   0,  -5,
-	 -5,   0,   0,   0,   0,   0,   0,  -5,
-	 -5,   0,   0,   0,   0,   0,   0,  -5,
-	  5,  10,  10,  10,  10,  10,  10,   5,
-	  0,   0,   0,   0,   0,   0,   0,   0
-};
-static const int pst_queen[64] = {
-	-20, -10, -10,  -5,  -5, -10, -10, -20,
-	-10,   0,   5,   0,   0,   0,   0, -10,
-	-10,   5,   5,   5,   5,   5,   0, -10,
-	  0,   0,   5,   5,   5,   5,   0,  -5,
-	 -5,   0,   5,   5,   5,   5,   0,  -5,
-	-10,   0,   5,   5,   5,   5,   0, -10,
-	-10,   0,   0,   0,   0,   0,   0, -10,
-	-20, -10, -10,  -5,  -5, -10, -10, -20
-};
-static const int pst_king_mg[64] = {
-	 20,  30,  10,   0,   0,  10,  30,  20,
-	 20,  20,   0,   0,   0,   0,  20,  20,
-	-10, -20, -20, -20, -20, -20, -20, -10,
-	-20, -30, -30, -40, -40, -30, -30, -20,
-	-30, -40, -40, -50, -50, -40, -40, -30,
-	-30, -40, -40, -50, -50, -40, -40, -30,
-	-30, -40, -40, -50, -50, -40, -40, -30,
-	-30, -40, -40, -50, -50, -40, -40, -30
-};
-
-static const int *pst_tables[NUM_PIECE_TYPES] = {
-	pst_pawn, pst_knight, pst_bishop, pst_rook, pst_queen, pst_king_mg
-};
-
-static const Bitboard file_mask[8] = {
-	0x0101010101010101ULL, 0x0202020202020202ULL,
-	0x0404040404040404ULL, 0x0808080808080808ULL,
-	0x1010101010101010ULL, 0x2020202020202020ULL,
-	0x4040404040404040ULL, 0x8080808080808080ULL
-};
-
-static const Bitboard rank_mask[8] = {
-	0x00000000000000FFULL, 0x000000000000FF00ULL,
-	0x0000000000FF0000ULL, 0x00000000FF000000ULL,
-	0x000000FF00000000ULL, 0x0000FF0000000000ULL,
-	0x00FF000000000000ULL, 0xFF00000000000000ULL
-};
+#define DARK_SQUARES 0xAA55AA55AA55AA55ULL
 
-static int pst_sum(Bitboard bb, const int *table) {
-	int score = 0;
-	while (bb) {
-		int sq = __builtin_ctzll(bb);
-		score += table[sq];
-		bb &= bb - 1;
-	}
-	return score;
-}
+static int evaluate_terms(const Position *p, const AttackInfo *ai) {
+	MaterialEntry *me;
+	PROF(PROF_EVAL_MATERIAL, me = material_probe(p));
+	if (me->eval_fn) return me->eval_fn(p, me->strong);
 
-static int pst_sum_mirror(Bitboard bb, const int *table) {
-	int score = 0;
-	while (bb) {
-		int sq = __builtin_ctzll(bb);
-		score += table[(7 - (sq >> 3)) * 8 + (sq & 7)];
-		bb &= bb - 1;
+	int score;
+	if (p->acc) {
+		PROF(PROF_EVAL_NNUE, score = nnue_evaluate(p));
+		if (!p->white_turn) score = -score;
+	} else {
+		score = kernels->eval_classic(p, ai, me);
 	}
-	return score;
-}
 
-static int eval_pawns(const Position *p, Color c) {
-	Bitboard pawns = p->pieces[c][PAWN];
-	Bitboard enemy = p->pieces[c ^ 1][PAWN];
-	int score = 0;
-	Bitboard bb = pawns;
-	while (bb) {
-		int sq = __builtin_ctzll(bb);
-		bb &= bb - 1;
-		int f = sq & 7;
-		/* Doubled: another friendly pawn on the same file */
-		if (pawns & file_mask[f] & ~(1ULL << sq))
-			score -= 10;
-		/* Isolated: no friendly pawns on adjacent files */
-		Bitboard adj = 0;
-		if (f > 0) adj |= file_mask[f - 1];
-		if (f < 7) adj |= file_mask[f + 1];
-		if (!(pawns & adj))
-			score -= 15;
-		/* Passed: no enemy pawns on same or adjacent files ahead */
-		Bitboard front = 0;
-		if (c == WHITE) {
-			for (int r = (sq >> 3) + 1; r <= 7; r++)
-				front |= rank_mask[r];
-		} else {
-			for (int r = (sq >> 3) - 1; r >= 0; r--)
-				front |= rank_mask[r];
-		}
-		Bitboard block_files = file_mask[f] | adj;
-		if (!(enemy & block_files & front)) {
-			int rank = (c == WHITE) ? (sq >> 3) : (7 - (sq >> 3));
-			score += 10 + rank * rank;
-		}
+	int scale = me->scale[score > 0 ? WHITE : BLACK];
+	if (me->ocb_candidate) {
+		bool wdark = (p->pieces[WHITE][BISHOP] & DARK_SQUARES) != 0;
+		bool bdark = (p->pieces[BLACK][BISHOP] & DARK_SQUARES) != 0;
+		if (wdark != bdark && scale > SCALE_NORMAL / 2)
+			scale = SCALE_NORMAL / 2;
 	}
-	return score;
+	return score * scale / SCALE_NORMAL;
 }
 
-static int eval_king_safety(const Position *p, Color c) {
-	Bitboard king = p->pieces[c][KING];
-	if (!king) return 0;
-	int ksq = __builtin_ctzll(king);
-	int kf = ksq & 7;
-	int score = 0;
-	Bitboard pawns = p->pieces[c][PAWN];
-	/* Pawn shield: pawns on files near king */
-	for (int df = -1; df <= 1; df++) {
-		int f = kf + df;
-		if (f < 0 || f > 7) continue;
-		Bitboard fpawns = pawns & file_mask[f];
-		if (fpawns) {
-			int closest;
-			if (c == WHITE) {
-				closest = __builtin_ctzll(fpawns) >> 3;
-				int dist = closest - (ksq >> 3);
-				if (dist >= 1 && dist <= 2) score += 10;
-			} else {
-				closest = (63 - __builtin_clzll(fpawns)) >> 3;
-				int dist = (ksq >> 3) - closest;
-				if (dist >= 1 && dist <= 2) score += 10;
-			}
-		} else {
-			score -= 15;
-		}
-	}
-	return score;
-}
-
-static int eval_mobility(const Position *p, Color c) {
-	Bitboard occ = occupied(p);
-	Bitboard friendly = pieces_by_color(p, c);
-	int mob = 0;
-	Bitboard bb;
-	bb = p->pieces[c][KNIGHT];
-	while (bb) {
-		int sq = __builtin_ctzll(bb);
-		bb &= bb - 1;
-		mob += __builtin_popcountll(knight_attacks(sq) & ~friendly);
-	}
-	bb = p->pieces[c][BISHOP];
-	while (bb) {
-		int sq = __builtin_ctzll(bb);
-		bb &= bb - 1;
-		mob += __builtin_popcountll(bishop_attacks(sq, occ) & ~friendly);
-	}
-	bb = p->pieces[c][ROOK];
-	while (bb) {
-		int sq = __builtin_ctzll(bb);
-		bb &= bb - 1;
-		mob += __builtin_popcountll(rook_attacks(sq, occ) & ~friendly);
-	}
-	bb = p->pieces[c][QUEEN];
-	while (bb) {
-		int sq = __builtin_ctzll(bb);
-		bb &= bb - 1;
-		mob += __builtin_popcountll(queen_attacks(sq, occ) & ~friendly);
-	}
-	return mob * 3;
-}
-
-static int eval_rooks(const Position *p, Color c) {
-	Bitboard rooks = p->pieces[c][ROOK];
-	Bitboard our_pawns = p->pieces[c][PAWN];
-	Bitboard their_pawns = p->pieces[c ^ 1][PAWN];
-	int score = 0;
-	while (rooks) {
-		int sq = __builtin_ctzll(rooks);
-		rooks &= rooks - 1;
-		int f = sq & 7;
-		if (!(our_pawns & file_mask[f])) {
-			if (!(their_pawns & file_mask[f]))
-				score += 20;
-			else
-				score += 10;
-		}
-	}
+/* White's view; positions carrying an NNUE accumulator use the net */
+int evaluate_ai(const Position *p, const AttackInfo *ai) {
+	PROF_BEGIN(t);
+	int score = evaluate_terms(p, ai);
+	PROF_END(PROF_EVALUATE, t);
 	return score;
 }
 
+/* For positions from outside the search, which carry no accumulator */
 int evaluate(const Position *p) {
-	int score = 0;
-	for (int pt = PAWN; pt <= QUEEN; pt++)
-		score += piece_value[pt]
-		       * (__builtin_popcountll(p->pieces[WHITE][pt])
-		        - __builtin_popcountll(p->pieces[BLACK][pt]));
-	if (__builtin_popcountll(p->pieces[WHITE][BISHOP]) >= 2) score += 30;
-	if (__builtin_popcountll(p->pieces[BLACK][BISHOP]) >= 2) score -= 30;
-	for (int pt = 0; pt < NUM_PIECE_TYPES; pt++) {
-		score += pst_sum(p->pieces[WHITE][pt], pst_tables[pt]);
-		score -= pst_sum_mirror(p->pieces[BLACK][pt], pst_tables[pt]);
+	AttackInfo ai;
+	compute_attack_info(p, &ai);
+	if (nnue_enabled) {
+		NnueAccumulator acc;
+		Position fresh = *p;
+		fresh.acc = &acc;
+		nnue_refresh(&fresh);
+		return evaluate_ai(&fresh, &ai);
 	}
-	score += eval_pawns(p, WHITE) - eval_pawns(p, BLACK);
-	score += eval_king_safety(p, WHITE) - eval_king_safety(p, BLACK);
-	score += eval_mobility(p, WHITE) - eval_mobility(p, BLACK);
-	score += eval_rooks(p, WHITE) - eval_rooks(p, BLACK);
-	return score;
+	return evaluate_ai(p, &ai);
 }
 
-/* Transposition table */
-#define TT_EXACT 0
-#define TT_ALPHA 1
-#define TT_BETA  2
-
-typedef struct {
-	uint64_t key;
-	int score, depth, flag;
-	Move best_move;
-} TTEntry;
+volatile int engine_stop = 0;
+bool engine_debug = false;
+EngineCheckFn engine_check_fn = NULL;
 
-#define TT_SIZE (1 << 20)
-#define TT_MASK (TT_SIZE - 1)
+/* Search state of the classic single-threaded entry points */
+static SearchState main_state = { .stop = &engine_stop };
 
-static TTEntry tt[TT_SIZE];
-static Move killers[MAX_PLY][2];
-static int history[2][64][64];
+void search_state_init(SearchState *s, volatile int *stop) {
+	memset(s, 0, sizeof(*s));
+	s->stop = stop;
+}
 
 void engine_init(void) {
-	memset(tt, 0, sizeof(tt));
-	memset(killers, 0, sizeof(killers));
-	memset(history, 0, sizeof(history));
+	tt_new_game();
+	search_state_init(&main_state, &engine_stop);
 }
 
-volatile int engine_stop = 0;
-EngineCheckFn engine_check_fn = NULL;
-
-static uint64_t nodes;
-static int64_t search_start_time;
-static int64_t search_time_limit;
-
 static int64_t get_time_ms(void) {
 	struct timespec ts;
 	clock_gettime(CLOCK_MONOTONIC, &ts);
 	return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
 }
 
-static void check_limits(void) {
-	if (search_time_limit > 0 &&
-	    get_time_ms() - search_start_time >= search_time_limit)
-		engine_stop = 1;
-	if (engine_check_fn) engine_check_fn();
-}
-
-static TTEntry *tt_probe(uint64_t key) {
-	TTEntry *e = &tt[key & TT_MASK];
-	return (e->key == key) ? e : NULL;
+static void check_limits(SearchState *s) {
+	if (s->time_limit > 0 &&
+	    get_time_ms() - s->start_time >= s->time_limit)
+		*s->stop = 1;
+	if (s->check_fn) s->check_fn();
 }
 
-static void tt_store(uint64_t key, int score, int depth, int flag, Move best) {
-	TTEntry *e = &tt[key & TT_MASK];
-	if (e->key == 0 || e->key == key || depth >= e->depth) {
-		e->key = key;
-		e->score = score;
-		e->depth = depth;
-		e->flag = flag;
-		e->best_move = best;
-	}
-}
-
-static int score_move(const Position *p, const Move *m,
+static int score_move(const SearchState *s, const Position *p, const Move *m,
                       const Move *tt_move, int ply) {
 	if (tt_move && m->from == tt_move->from && m->to == tt_move->to
 	    && m->flags == tt_move->flags)
@@ -325,18 +108,19 @@ static int score_move(const Position *p, const Move *m,
 	}
 	if (MOVE_IS_PROMO(m->flags)) return 48000;
 	if (ply < MAX_PLY) {
-		if (m->from == killers[ply][0].from && m->to == killers[ply][0].to)
+		if (m->from == s->killers[ply][0].from && m->to == s->killers[ply][0].to)
 			return 40000;
-		if (m->from == killers[ply][1].from && m->to == killers[ply][1].to)
+		if (m->from == s->killers[ply][1].from && m->to == s->killers[ply][1].to)
 			return 39000;
 	}
-	return history[p->white_turn ? 0 : 1][m->from][m->to];
+	return s->history[p->white_turn ? 0 : 1][m->from][m->to];
 }
 
-static void score_moves(const Position *p, MoveList *list,
-                        int *scores, const Move *tt_move, int ply) {
+static void score_moves(const SearchState *s, const Position *p,
+                        MoveList *list, int *scores,
+                        const Move *tt_move, int ply) {
 	for (int i = 0; i < list->count; i++)
-		scores[i] = score_move(p, &list->moves[i], tt_move, ply);
+		scores[i] = score_move(s, p, &list->moves[i], tt_move, ply);
 }
 
 static void pick_best(MoveList *list, int *scores, int start) {
@@ -353,33 +137,51 @@ static void pick_best(MoveList *list, int *scores, int start) {
 	}
 }
 
-static void store_killer(const Move *m, int ply) {
+static void store_killer(SearchState *s, const Move *m, int ply) {
 	if (ply >= MAX_PLY) return;
-	if (killers[ply][0].from == m->from && killers[ply][0].to == m->to) return;
-	killers[ply][1] = killers[ply][0];
-	killers[ply][0] = *m;
+	if (s->killers[ply][0].from == m->from && s->killers[ply][0].to == m->to)
+		return;
+	s->killers[ply][1] = s->killers[ply][0];
+	s->killers[ply][0] = *m;
 }
 
-static void update_history(const Position *p, const Move *m, int depth) {
+static void update_history(SearchState *s, const Position *p,
+                           const Move *m, int depth) {
 	int c = p->white_turn ? 0 : 1;
-	history[c][m->from][m->to] += depth * depth;
-	if (history[c][m->from][m->to] > 30000)
-		history[c][m->from][m->to] = 30000;
+	s->history[c][m->from][m->to] += depth * depth;
+	if (s->history[c][m->from][m->to] > 30000)
+		s->history[c][m->from][m->to] = 30000;
+}
+
+static int quiescence_node(SearchState *s, const Position *p, int alpha,
+                           int beta, int ply);
+
+/* Every quiescence node returns through here, where the tracer sees it */
+static inline int quiescence(SearchState *s, const Position *p, int alpha,
+                             int beta, int ply) {
+	int score = quiescence_node(s, p, alpha, beta, ply);
+	TRACE_NODE(s, ply, 0, alpha, beta, score);
+	return score;
 }
 
-static int quiescence(const Position *p, int alpha, int beta) {
-	nodes++;
-	if (engine_stop) return 0;
+static int quiescence_node(SearchState *s, const Position *p, int alpha,
+                           int beta, int ply) {
+	s->nodes++;
+	STAT_INC(s, qnodes);
+	STAT_MAX(s, seldepth, ply);
+	if (*s->stop) return TRACED(s, ply, TRACE_STOP, 0);
 
-	int eval = evaluate(p);
+	AttackInfo ai;
+	compute_attack_info(p, &ai);
+	int eval = evaluate_ai(p, &ai);
 	if (!p->white_turn) eval = -eval;
-	if (eval >= beta) return beta;
+	if (eval >= beta) return TRACED(s, ply, TRACE_STANDPAT, beta);
 	if (eval > alpha) alpha = eval;
 
 	MoveList caps;
-	generate_legal_captures(p, &caps);
+	generate_captures(p, &ai, &caps);
 	int scores[MAX_MOVES];
-	score_moves(p, &caps, scores, NULL, MAX_PLY);
+	score_moves(s, p, &caps, scores, NULL, MAX_PLY);
 
 	for (int i = 0; i < caps.count; i++) {
 		pick_best(&caps, scores, i);
@@ -390,45 +192,144 @@ static int quiescence(const Position *p, int alpha, int beta) {
 			continue;
 		Position child = *p;
 		make_move(&child, &caps.moves[i]);
-		int score = -quiescence(&child, -beta, -alpha);
-		if (score >= beta) return beta;
+		TRACE_CHILD(s, ply, trace_move(&caps.moves[i]), 0, TRACE_F_QS);
+		int score = -quiescence(s, &child, -beta, -alpha, ply + 1);
+		if (score >= beta) return TRACED(s, ply, TRACE_BETA, beta);
 		if (score > alpha) alpha = score;
 	}
-	return alpha;
+	return TRACED(s, ply, TRACE_QS, alpha);
 }
 
-static int negamax(const Position *p, int depth, int alpha, int beta,
-                   int ply, Move *best_move, bool do_null) {
-	nodes++;
-	if ((nodes & 4095) == 0) check_limits();
-	if (engine_stop) return 0;
-	if (p->halfmove >= 100) return 0;
+static void update_pv(SearchState *s, const Move *m, int ply) {
+	s->pv_table[ply][ply] = *m;
+	for (int i = ply + 1; i < s->pv_length[ply + 1]; i++)
+		s->pv_table[ply][i] = s->pv_table[ply + 1][i];
+	s->pv_length[ply] = s->pv_length[ply + 1];
+}
+
+/* Forward pruning margins (centipawns); override with -D at build time */
+#ifndef RFP_DEPTH
+#define RFP_DEPTH        6
+#endif
+#ifndef RFP_MARGIN
+#define RFP_MARGIN       80
+#endif
+#ifndef RAZOR_DEPTH
+#define RAZOR_DEPTH      2
+#endif
+#ifndef RAZOR_MARGIN
+#define RAZOR_MARGIN     250
+#endif
+#ifndef FUTILITY_DEPTH
+#define FUTILITY_DEPTH   3
+#endif
+#ifndef FUTILITY_MARGIN
+#define FUTILITY_MARGIN  120
+#endif
+#ifndef LMP_DEPTH
+#define LMP_DEPTH        3
+#endif
+#ifndef LMP_BASE
+#define LMP_BASE         4
+#endif
+
+#define IS_MATE_SCORE(s) ((s) > SCORE_MATE - MAX_PLY || (s) < -SCORE_MATE + MAX_PLY)
+
+static int negamax_node(SearchState *s, const Position *p, int depth,
+                        int alpha, int beta, int ply, Move *best_move,
+                        bool do_null);
+
+/* Every full-width node returns through here, where the tracer sees it */
+static inline int negamax(SearchState *s, const Position *p, int depth,
+                          int alpha, int beta, int ply, Move *best_move,
+                          bool do_null) {
+	int score = negamax_node(s, p, depth, alpha, beta, ply, best_move, do_null);
+	TRACE_NODE(s, ply, depth, alpha, beta, score);
+	return score;
+}
+
+static int negamax_node(SearchState *s, const Position *p, int depth,
+                        int alpha, int beta, int ply, Move *best_move,
+                        bool do_null) {
+	s->nodes++;
+	s->pv_length[ply] = ply;
+	STAT_MAX(s, seldepth, ply);
+	if ((s->nodes & 4095) == 0) check_limits(s);
+	if (s->node_limit && s->nodes >= s->node_limit) *s->stop = 1;
+	if (*s->stop) return TRACED(s, ply, TRACE_STOP, 0);
+	if (p->halfmove >= 100) return TRACED(s, ply, TRACE_DRAW, 0);
+
+	/* Dead material (no mate possible) and drawn KPK need no search */
+	if (ply > 0 && material_is_draw(p, material_probe(p)))
+		return TRACED(s, ply, TRACE_DRAW, 0);
+
+	if (ply >= MAX_PLY - 1) {
+		int eval = evaluate(p);
+		return TRACED(s, ply, TRACE_MAXPLY, p->white_turn ? eval : -eval);
+	}
 
 	bool pv_node = (beta - alpha > 1);
 	int orig_alpha = alpha;
-	TTEntry *tt_entry = tt_probe(p->hash);
-	Move tt_mv;
+	TTData tt_entry;
 	Move *tt_move = NULL;
 
-	if (tt_entry) {
-		tt_mv = tt_entry->best_move;
-		tt_move = &tt_mv;
-		if (tt_entry->depth >= depth && !pv_node) {
-			int s = tt_entry->score;
-			if (tt_entry->flag == TT_EXACT) {
-				if (best_move) *best_move = tt_entry->best_move;
-				return s;
+	STAT_INC(s, tt_probes);
+	if (tt_probe(p->hash, &tt_entry)) {
+		STAT_INC(s, tt_hits);
+		tt_move = &tt_entry.best_move;
+		if (tt_entry.depth >= depth && !pv_node) {
+			int ts = tt_entry.score;
+			if (tt_entry.flag == TT_EXACT) {
+				STAT_INC(s, tt_cutoffs);
+				if (best_move) *best_move = tt_entry.best_move;
+				return TRACED(s, ply, TRACE_TT, ts);
+			}
+			if (tt_entry.flag == TT_ALPHA && ts <= alpha) {
+				STAT_INC(s, tt_cutoffs);
+				return TRACED(s, ply, TRACE_TT, alpha);
+			}
+			if (tt_entry.flag == TT_BETA && ts >= beta) {
+				STAT_INC(s, tt_cutoffs);
+				return TRACED(s, ply, TRACE_TT, beta);
 			}
-			if (tt_entry->flag == TT_ALPHA && s <= alpha) return alpha;
-			if (tt_entry->flag == TT_BETA  && s >= beta)  return beta;
 		}
 	}
 
-	if (depth <= 0) return quiescence(p, alpha, beta);
+	/* The quiescence node is this node, so it is traced only once */
+	if (depth <= 0) return quiescence_node(s, p, alpha, beta, ply);
 
-	bool in_check = is_in_check(p);
+	AttackInfo ai;
+	compute_attack_info(p, &ai);
+	bool in_check = ai.checkers != 0;
 	if (in_check) depth++;
 
+	int static_eval = 0;
+	if (!in_check && !pv_node) {
+		static_eval = evaluate_ai(p, &ai);
+		if (!p->white_turn) static_eval = -static_eval;
+	}
+
+	/* Reverse futility pruning: static eval far above beta */
+	if (!in_check && !pv_node && depth <= RFP_DEPTH && ply > 0
+	    && !IS_MATE_SCORE(beta)
+	    && static_eval - RFP_MARGIN * depth >= beta)
+		return TRACED(s, ply, TRACE_RFP, beta);
+
+	/* Razoring: hopeless shallow nodes drop straight into quiescence */
+	if (!in_check && !pv_node && depth <= RAZOR_DEPTH
+	    && !IS_MATE_SCORE(alpha)
+	    && static_eval + RAZOR_MARGIN * depth < alpha) {
+		int qs = quiescence_node(s, p, alpha, beta, ply);
+		if (depth == 1 || qs <= alpha) return TRACED(s, ply, TRACE_RAZOR, qs);
+	}
+
+	/* Futility pruning: quiet moves cannot lift eval to alpha */
+	bool futile = !in_check && !pv_node && depth <= FUTILITY_DEPTH
+	           && !IS_MATE_SCORE(alpha)
+	           && static_eval + FUTILITY_MARGIN * depth <= alpha;
+	int lmp_limit = (!in_check && !pv_node && depth <= LMP_DEPTH)
+	              ? LMP_BASE + depth * depth : MAX_MOVES;
+
 	/* Null move pruning */
 	if (do_null && !in_check && !pv_node && depth >= 3 && ply > 0) {
 		Color us = p->white_turn ? WHITE : BLACK;
@@ -442,19 +343,24 @@ static int negamax(const Position *p, int depth, int alpha, int beta,
 			if (p->en_passant >= 0)
 				np.hash ^= zobrist_ep_key(p->en_passant & 7);
 			int R = 2 + (depth >= 6 ? 1 : 0);
-			int ns = -negamax(&np, depth - 1 - R, -beta, -beta + 1,
+			STAT_INC(s, null_tries);
+			TRACE_CHILD(s, ply, 0, 0, TRACE_F_NULL);
+			int ns = -negamax(s, &np, depth - 1 - R, -beta, -beta + 1,
 			                  ply + 1, NULL, false);
-			if (ns >= beta) return beta;
+			if (ns >= beta) {
+				STAT_INC(s, null_cutoffs);
+				return TRACED(s, ply, TRACE_NULL, beta);
+			}
 		}
 	}
 
 	MoveList moves;
-	generate_legal_moves(p, &moves);
+	generate_moves(p, &ai, &moves);
 	if (moves.count == 0)
-		return in_check ? -(SCORE_MATE - ply) : 0;
+		return TRACED(s, ply, TRACE_MATE, in_check ? -(SCORE_MATE - ply) : 0);
 
 	int scores[MAX_MOVES];
-	score_moves(p, &moves, scores, tt_move, ply);
+	score_moves(s, p, &moves, scores, tt_move, ply);
 
 	Move local_best = moves.moves[0];
 	int searched = 0;
@@ -468,14 +374,25 @@ static int negamax(const Position *p, int depth, int alpha, int beta,
 		bool tactical = MOVE_IS_CAPTURE(moves.moves[i].flags)
 		             || MOVE_IS_PROMO(moves.moves[i].flags);
 		bool killer = (ply < MAX_PLY)
-			&& ((moves.moves[i].from == killers[ply][0].from
-			     && moves.moves[i].to == killers[ply][0].to)
-			 || (moves.moves[i].from == killers[ply][1].from
-			     && moves.moves[i].to == killers[ply][1].to));
+			&& ((moves.moves[i].from == s->killers[ply][0].from
+			     && moves.moves[i].to == s->killers[ply][0].to)
+			 || (moves.moves[i].from == s->killers[ply][1].from
+			     && moves.moves[i].to == s->killers[ply][1].to));
+
+		/* Futility and late-move pruning of quiet, non-checking moves */
+		if (searched > 0 && !tactical && !killer
+		    && (futile || searched >= lmp_limit)
+		    && !is_in_check(&child)) {
+			TRACE_PRUNED(s, ply, trace_move(&moves.moves[i]),
+			             futile ? TRACE_FUTILITY : TRACE_LMP,
+			             depth - 1, alpha, beta);
+			continue;
+		}
 
 		if (searched == 0) {
 			/* PVS: search first move with full window */
-			score = -negamax(&child, depth - 1, -beta, -alpha,
+			TRACE_CHILD(s, ply, trace_move(&moves.moves[i]), 0, 0);
+			score = -negamax(s, &child, depth - 1, -beta, -alpha,
 			                 ply + 1, NULL, true);
 		} else {
 			/* LMR + PVS: late moves get reduced zero-window search */
@@ -484,122 +401,146 @@ static int negamax(const Position *p, int depth, int alpha, int beta,
 			    && !in_check && !tactical && !killer)
 				reduction = 1 + (searched >= 8 ? 1 : 0);
 
-			score = -negamax(&child, depth - 1 - reduction,
+			if (reduction > 0) STAT_INC(s, lmr_searches);
+			TRACE_CHILD(s, ply, trace_move(&moves.moves[i]), reduction, 0);
+			score = -negamax(s, &child, depth - 1 - reduction,
 			                 -alpha - 1, -alpha, ply + 1, NULL, true);
 
 			/* Re-search at full depth if reduced search beats alpha */
-			if (reduction > 0 && score > alpha)
-				score = -negamax(&child, depth - 1, -alpha - 1, -alpha,
+			if (reduction > 0 && score > alpha) {
+				STAT_INC(s, lmr_researches);
+				TRACE_CHILD(s, ply, trace_move(&moves.moves[i]), 0,
+				            TRACE_F_RESEARCH);
+				score = -negamax(s, &child, depth - 1, -alpha - 1, -alpha,
 				                 ply + 1, NULL, true);
+			}
 
 			/* PVS re-search with full window if zero-window beats alpha */
-			if (score > alpha && score < beta)
-				score = -negamax(&child, depth - 1, -beta, -alpha,
+			if (score > alpha && score < beta) {
+				TRACE_CHILD(s, ply, trace_move(&moves.moves[i]), 0,
+				            TRACE_F_RESEARCH);
+				score = -negamax(s, &child, depth - 1, -beta, -alpha,
 				                 ply + 1, NULL, true);
+			}
 		}
 		searched++;
 
 		if (score >= beta) {
+			STAT_INC(s, fail_highs);
+			if (searched == 1) STAT_INC(s, first_move_fail_highs);
 			if (!tactical) {
-				store_killer(&moves.moves[i], ply);
-				update_history(p, &moves.moves[i], depth);
+				store_killer(s, &moves.moves[i], ply);
+				update_history(s, p, &moves.moves[i], depth);
 			}
 			tt_store(p->hash, beta, depth, TT_BETA, moves.moves[i]);
 			if (best_move) *best_move = moves.moves[i];
-			return beta;
+			return TRACED(s, ply, TRACE_BETA, beta);
 		}
 		if (score > alpha) {
 			alpha = score;
 			local_best = moves.moves[i];
+			update_pv(s, &moves.moves[i], ply);
 		}
 	}
 
 	int flag = (alpha <= orig_alpha) ? TT_ALPHA : TT_EXACT;
 	tt_store(p->hash, alpha, depth, flag, local_best);
 	if (best_move) *best_move = local_best;
-	return alpha;
+	return TRACED(s, ply, flag == TT_EXACT ? TRACE_PV : TRACE_ALL, alpha);
 }
 
 #define ASP_WINDOW 50
 
-int engine_search(const Position *p, int max_depth, Move *best_move) {
-	Move iter_best = {0};
-	int iter_score = 0;
-	engine_stop = 0;
-	nodes = 0;
-	search_start_time = 0;
-	search_time_limit = 0;
-	memset(killers, 0, sizeof(killers));
-	for (int c = 0; c < 2; c++)
-		for (int f = 0; f < 64; f++)
-			for (int t = 0; t < 64; t++)
-				history[c][f][t] /= 4;
-	for (int depth = 1; depth <= max_depth; depth++) {
-		int alpha, beta;
-		if (depth >= 4) {
-			alpha = iter_score - ASP_WINDOW;
-			beta  = iter_score + ASP_WINDOW;
-		} else {
-			alpha = -SCORE_INF;
-			beta  = SCORE_INF;
-		}
-		int score = negamax(p, depth, alpha, beta, 0, &iter_best, true);
-		if (score <= alpha || score >= beta)
-			score = negamax(p, depth, -SCORE_INF, SCORE_INF,
-			                0, &iter_best, true);
-		iter_score = score;
-		if (score > SCORE_MATE - MAX_PLY || score < -SCORE_MATE + MAX_PLY)
-			break;
+/* Send one line of search output to the state's sink, or to stdout */
+static void search_emit(SearchState *s, const char *line) {
+	if (s->info_fn) {
+		s->info_fn(s->info_ctx, line);
+	} else {
+		printf("%s\n", line);
+		fflush(stdout);
 	}
-	if (best_move) *best_move = iter_best;
-	return iter_score;
 }
 
-static int extract_pv(const Position *pos, Move *pv, int max_len) {
-	Position p = *pos;
-	int len = 0;
-	uint64_t seen[MAX_PLY];
-	for (int i = 0; i < max_len && i < MAX_PLY; i++) {
-		bool cycle = false;
-		for (int j = 0; j < len; j++)
-			if (seen[j] == p.hash) { cycle = true; break; }
-		if (cycle) break;
-		TTEntry *e = tt_probe(p.hash);
-		if (!e) break;
-		Move m = e->best_move;
-		MoveList legal;
-		generate_legal_moves(&p, &legal);
-		bool found = false;
-		for (int j = 0; j < legal.count; j++)
-			if (legal.moves[j].from == m.from &&
-			    legal.moves[j].to == m.to &&
-			    legal.moves[j].flags == m.flags) { found = true; break; }
-		if (!found) break;
-		seen[len] = p.hash;
-		pv[len] = m;
-		len++;
-		make_move(&p, &m);
+static void report_iteration(SearchState *s, int depth, int score) {
+	char line[64 + MAX_PLY * 6];
+	int64_t elapsed = get_time_ms() - s->start_time;
+	if (elapsed == 0) elapsed = 1;
+	uint64_t nps = s->nodes * 1000 / (uint64_t)elapsed;
+	int n;
+
+	if (score > SCORE_MATE - MAX_PLY) {
+		int mate = (SCORE_MATE - score + 1) / 2;
+		n = sprintf(line, "info depth %d score mate %d nodes %llu time %lld nps %llu",
+		            depth, mate, (unsigned long long)s->nodes,
+		            (long long)elapsed, (unsigned long long)nps);
+	} else if (score < -SCORE_MATE + MAX_PLY) {
+		int mate = -(SCORE_MATE + score + 1) / 2;
+		n = sprintf(line, "info depth %d score mate %d nodes %llu time %lld nps %llu",
+		            depth, mate, (unsigned long long)s->nodes,
+		            (long long)elapsed, (unsigned long long)nps);
+	} else {
+		n = sprintf(line, "info depth %d score cp %d nodes %llu time %lld nps %llu",
+		            depth, score, (unsigned long long)s->nodes,
+		            (long long)elapsed, (unsigned long long)nps);
+	}
+
+	n += sprintf(line + n, " pv");
+	for (int i = 0; i < s->root_pv_length; i++) {
+		char buf[8];
+		move_to_str(&s->root_pv[i], buf);
+		n += sprintf(line + n, " %s", buf);
+	}
+	search_emit(s, line);
+
+	if (STATS_ENABLED && engine_debug) {
+		char stats[STATS_BUF_SIZE] = "info string ";
+		stats_line(&s->stats, s->nodes, stats + 12);
+		search_emit(s, stats);
 	}
-	return len;
 }
 
-int engine_search_uci(const Position *p, int max_depth,
-                      int64_t time_limit_ms, Move *best_move) {
+/* Iterative deepening with aspiration windows. The caller owns *s->stop;
+ * it is not cleared here so that a search stopped before it started
+ * returns at once. */
+int engine_search_state(SearchState *s, const Position *p, int max_depth,
+                        int64_t time_limit_ms, bool report, Move *best_move) {
 	Move iter_best = {0};
 	int iter_score = 0;
-	engine_stop = 0;
-	nodes = 0;
-	search_start_time = get_time_ms();
-	search_time_limit = time_limit_ms;
-	memset(killers, 0, sizeof(killers));
+	if (!tt_ensure()) {
+		search_emit(s, "info string cannot allocate the hash table");
+		if (best_move) *best_move = iter_best;
+		return 0;
+	}
+	PROF_BEGIN(prof_start);
+	/* make_move keeps the accumulator current from here on */
+	Position root = *p;
+	root.acc = NULL;
+	if (nnue_enabled) {
+		root.acc = s->acc_stack;
+		nnue_refresh(&root);
+	}
+	p = &root;
+	s->nodes = 0;
+	s->completed_depth = 0;
+#if STATS_ENABLED
+	memset(&s->stats, 0, sizeof(s->stats));
+#endif
+#if TRACE_ENABLED
+	s->trace = trace_attach();
+	memset(&s->trace_path[0], 0, sizeof(s->trace_path[0]));
+#endif
+	s->start_time = get_time_ms();
+	s->time_limit = time_limit_ms;
+	memset(s->killers, 0, sizeof(s->killers));
 	for (int c = 0; c < 2; c++)
 		for (int f = 0; f < 64; f++)
 			for (int t = 0; t < 64; t++)
-				history[c][f][t] /= 4;
+				s->history[c][f][t] /= 4;
 
 	int limit = (max_depth > 0) ? max_depth : MAX_PLY;
 	MoveList legal;
 	generate_legal_moves(p, &legal);
+	s->root_pv_length = 0;
 	if (legal.count > 0) iter_best = legal.moves[0];
 
 	for (int depth = 1; depth <= limit; depth++) {
@@ -612,53 +553,73 @@ int engine_search_uci(const Position *p, int max_depth,
 			alpha = -SCORE_INF;
 			beta  = SCORE_INF;
 		}
-		int score = negamax(p, depth, alpha, beta,
+		int score = negamax(s, p, depth, alpha, beta,
 		                    0, &current_best, true);
-		if (!engine_stop && (score <= alpha || score >= beta))
-			score = negamax(p, depth, -SCORE_INF, SCORE_INF,
+		if (!*s->stop && (score <= alpha || score >= beta))
+			score = negamax(s, p, depth, -SCORE_INF, SCORE_INF,
 			                0, &current_best, true);
-		if (engine_stop) break;
+		if (*s->stop) break;
 		iter_best = current_best;
 		iter_score = score;
-
-		int64_t elapsed = get_time_ms() - search_start_time;
-		if (elapsed == 0) elapsed = 1;
-		uint64_t nps = nodes * 1000 / (uint64_t)elapsed;
-
-		if (score > SCORE_MATE - MAX_PLY) {
-			int mate = (SCORE_MATE - score + 1) / 2;
-			printf("info depth %d score mate %d nodes %llu time %lld nps %llu",
-			       depth, mate, (unsigned long long)nodes,
-			       (long long)elapsed, (unsigned long long)nps);
-		} else if (score < -SCORE_MATE + MAX_PLY) {
-			int mate = -(SCORE_MATE + score + 1) / 2;
-			printf("info depth %d score mate %d nodes %llu time %lld nps %llu",
-			       depth, mate, (unsigned long long)nodes,
-			       (long long)elapsed, (unsigned long long)nps);
-		} else {
-			printf("info depth %d score cp %d nodes %llu time %lld nps %llu",
-			       depth, score, (unsigned long long)nodes,
-			       (long long)elapsed, (unsigned long long)nps);
+		s->completed_depth = depth;
+#if STATS_ENABLED
+		s->stats.iterations = depth;
+		s->stats.iter_nodes[depth] = s->nodes;
+#endif
+		s->root_pv_length = s->pv_length[0];
+		memcpy(s->root_pv, s->pv_table[0], sizeof(Move) * s->root_pv_length);
+		if (s->root_pv_length == 0) {
+			s->root_pv[0] = current_best;
+			s->root_pv_length = 1;
 		}
 
-		Move pv[MAX_PLY];
-		int pv_len = extract_pv(p, pv, depth);
-		if (pv_len > 0) {
-			printf(" pv");
-			for (int i = 0; i < pv_len; i++) {
-				char buf[8];
-				move_to_str(&pv[i], buf);
-				printf(" %s", buf);
-			}
-		}
-		printf("\n");
-		fflush(stdout);
+		if (report) report_iteration(s, depth, score);
+		if (s->iter_fn)
+			s->iter_fn(s->iter_ctx, depth, score, &iter_best, s->nodes,
+			           get_time_ms() - s->start_time);
 
 		if (score > SCORE_MATE - MAX_PLY || score < -SCORE_MATE + MAX_PLY)
 			break;
-		if (time_limit_ms > 0 && elapsed >= time_limit_ms / 2)
+		if (time_limit_ms > 0
+		    && get_time_ms() - s->start_time >= time_limit_ms / 2)
 			break;
 	}
+#if TRACE_ENABLED
+	if (s->trace) trace_flush(s->trace, p, s->completed_depth);
+#endif
 	if (best_move) *best_move = iter_best;
+	PROF_END(PROF_SEARCH, prof_start);
 	return iter_score;
 }
+
+int engine_search(const Position *p, int max_depth, Move *best_move) {
+	engine_stop = 0;
+	main_state.check_fn = NULL;
+	return engine_search_state(&main_state, p, max_depth, 0, false,
+	                           best_move);
+}
+
+int engine_search_uci(const Position *p, int max_depth,
+                      int64_t time_limit_ms, Move *best_move) {
+	engine_stop = 0;
+	main_state.check_fn = engine_check_fn;
+	return engine_search_state(&main_state, p, max_depth, time_limit_ms,
+	                           true, best_move);
+}
+
+uint64_t engine_nodes(void) {
+	return main_state.nodes;
+}
+
+const SearchStats *engine_last_stats(void) {
+	return &main_state.stats;
+}
+
+int engine_last_pv(Move *pv) {
+	return search_state_pv(&main_state, pv);
+}
+
+int search_state_pv(const SearchState *s, Move *pv) {
+	memcpy(pv, s->root_pv, sizeof(Move) * s->root_pv_length);
+	return s->root_pv_length;
+}
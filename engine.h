@@ -3,21 +3,82 @@
 
 #include "board.h"
 #include "movegen.h"
+#include "nnue.h"
+#include "trace.h"
 
 #define DEFAULT_DEPTH 6
 #define SCORE_INF     1000000
 #define SCORE_MATE    999000
 #define MAX_PLY       128
 
+#define VAL_KING   20000
+
+extern const int piece_value[7];
+
+typedef void (*EngineCheckFn)(void);
+typedef void (*EngineInfoFn)(void *ctx, const char *line);
+/* Called after every completed iteration */
+typedef void (*EngineIterFn)(void *ctx, int depth, int score,
+                             const Move *best, uint64_t nodes, int64_t ms);
+
+/* Search counters, kept only in builds with -DGCE_STATS; see stats.h */
+typedef struct {
+	uint64_t qnodes;
+	uint64_t tt_probes, tt_hits, tt_cutoffs;
+	uint64_t fail_highs, first_move_fail_highs;
+	uint64_t null_tries, null_cutoffs;
+	uint64_t lmr_searches, lmr_researches;
+	int      seldepth;
+	int      iterations;
+	uint64_t iter_nodes[MAX_PLY + 1];   /* total nodes after each depth */
+} SearchStats;
+
+/* Per-thread search state. The transposition table is shared; killers,
+ * history, PV and counters belong to one search at a time. */
+typedef struct {
+	Move          killers[MAX_PLY][2];
+	int           history[2][64][64];
+	Move          pv_table[MAX_PLY][MAX_PLY];
+	int           pv_length[MAX_PLY];
+	Move          root_pv[MAX_PLY];
+	int           root_pv_length;
+	uint64_t      nodes;
+	uint64_t      node_limit;   /* 0 for none */
+	int           completed_depth;
+	int64_t       start_time;
+	int64_t       time_limit;
+	volatile int *stop;
+	EngineCheckFn check_fn;
+	EngineInfoFn  info_fn;      /* NULL prints info lines to stdout */
+	void         *info_ctx;
+	EngineIterFn  iter_fn;
+	void         *iter_ctx;
+	SearchStats   stats;
+#ifdef GCE_TRACE
+	TraceRing    *trace;        /* NULL when no trace file is open */
+	TracePly      trace_path[MAX_PLY + 64];
+#endif
+	/* One slot per ply; quiescence may run some captures past MAX_PLY */
+	NnueAccumulator acc_stack[MAX_PLY + 64];
+} SearchState;
+
 void engine_init(void);
 int  evaluate(const Position *p);
+int  evaluate_ai(const Position *p, const AttackInfo *ai);
 int  engine_search(const Position *p, int max_depth, Move *best_move);
 int  engine_search_uci(const Position *p, int max_depth,
                        int64_t time_limit_ms, Move *best_move);
+int  engine_last_pv(Move *pv);
+uint64_t engine_nodes(void);
+const SearchStats *engine_last_stats(void);
 
-extern volatile int engine_stop;
+void search_state_init(SearchState *s, volatile int *stop);
+int  engine_search_state(SearchState *s, const Position *p, int max_depth,
+                         int64_t time_limit_ms, bool report, Move *best_move);
+int  search_state_pv(const SearchState *s, Move *pv);
 
-typedef void (*EngineCheckFn)(void);
+extern volatile int engine_stop;
+extern bool engine_debug;   /* UCI "debug on": per-iteration statistics */
 extern EngineCheckFn engine_check_fn;
 
 #endif
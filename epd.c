@@ -0,0 +1,128 @@
+#define _POSIX_C_SOURCE 200809L
+#include "epd.h"
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+bool epd_open(EpdFile *f, const char *path) {
+	f->data = NULL;
+	f->size = 0;
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) return false;
+	struct stat st;
+	if (fstat(fd, &st) < 0) {
+		close(fd);
+		return false;
+	}
+	if (st.st_size > 0) {
+		void *m = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (m == MAP_FAILED) {
+			close(fd);
+			return false;
+		}
+		posix_madvise(m, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+		f->data = m;
+		f->size = (size_t)st.st_size;
+	}
+	close(fd);
+	return true;
+}
+
+void epd_close(EpdFile *f) {
+	if (f->data) munmap((void *)f->data, f->size);
+	f->data = NULL;
+	f->size = 0;
+}
+
+/* Next non-blank, non-comment line at *offset; advances *offset past it */
+bool epd_next_line(const EpdFile *f, size_t *offset,
+                   const char **line, size_t *len) {
+	while (*offset < f->size) {
+		const char *start = f->data + *offset;
+		const char *nl = memchr(start, '\n', f->size - *offset);
+		size_t n = nl ? (size_t)(nl - start) : f->size - *offset;
+		*offset += n + (nl != NULL);
+		while (n > 0 && (start[n - 1] == '\r' || start[n - 1] == ' '))
+			n--;
+		while (n > 0 && *start == ' ') {
+			start++;
+			n--;
+		}
+		if (n == 0 || *start == '#') continue;
+		*line = start;
+		*len = n;
+		return true;
+	}
+	return false;
+}
+
+/*
+ * Parse the four EPD position fields (plus optional halfmove/fullmove
+ * counters, as in FEN) into p. fen receives the position as a FEN, and
+ * ops/ops_len point at the opcode section that follows.
+ */
+bool epd_parse(const char *line, size_t len, Position *p,
+               char *fen, size_t fen_size, const char **ops, size_t *ops_len) {
+	size_t i = 0;
+	int fields = 0;
+	while (fields < 6 && i < len) {
+		while (i < len && line[i] == ' ') i++;
+		size_t start = i;
+		while (i < len && line[i] != ' ') i++;
+		if (i == start) break;
+		/* Counters are optional; anything else starts the opcodes */
+		if (fields >= 4 && (line[start] < '0' || line[start] > '9')) {
+			i = start;
+			break;
+		}
+		fields++;
+	}
+	if (fields < 4) return false;
+
+	size_t n = i;
+	while (n > 0 && line[n - 1] == ' ') n--;
+	if (n + 5 > fen_size) return false;
+	memcpy(fen, line, n);
+	fen[n] = '\0';
+	if (fields == 4) strcpy(fen + n, " 0 1");
+	if (!position_from_fen(p, fen)) return false;
+
+	while (i < len && line[i] == ' ') i++;
+	*ops = line + i;
+	*ops_len = len - i;
+	return true;
+}
+
+/* Operand of opcode name (quotes stripped), e.g. "bm" or "id" */
+bool epd_opcode(const char *ops, size_t ops_len, const char *name,
+                char *out, size_t out_size) {
+	size_t nlen = strlen(name);
+	size_t i = 0;
+	while (i < ops_len) {
+		while (i < ops_len && ops[i] == ' ') i++;
+		size_t start = i;
+		bool quoted = false;
+		while (i < ops_len && (quoted || ops[i] != ';')) {
+			if (ops[i] == '"') quoted = !quoted;
+			i++;
+		}
+		size_t end = i++;
+		if (end - start > nlen && memcmp(ops + start, name, nlen) == 0
+		    && ops[start + nlen] == ' ') {
+			size_t a = start + nlen + 1, b = end;
+			while (a < b && ops[a] == ' ') a++;
+			while (b > a && ops[b - 1] == ' ') b--;
+			if (b - a >= 2 && ops[a] == '"' && ops[b - 1] == '"') {
+				a++;
+				b--;
+			}
+			if (b - a >= out_size) return false;
+			memcpy(out, ops + a, b - a);
+			out[b - a] = '\0';
+			return true;
+		}
+	}
+	return false;
+}
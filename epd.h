@@ -0,0 +1,22 @@
+#ifndef EPD_H
+#define EPD_H
+
+#include "board.h"
+#include <stddef.h>
+
+/* Read-only memory-mapped EPD file, walked line by line */
+typedef struct {
+	const char *data;
+	size_t      size;
+} EpdFile;
+
+bool epd_open(EpdFile *f, const char *path);
+void epd_close(EpdFile *f);
+bool epd_next_line(const EpdFile *f, size_t *offset,
+                   const char **line, size_t *len);
+bool epd_parse(const char *line, size_t len, Position *p,
+               char *fen, size_t fen_size, const char **ops, size_t *ops_len);
+bool epd_opcode(const char *ops, size_t ops_len, const char *name,
+                char *out, size_t out_size);
+
+#endif
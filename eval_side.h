@@ -0,0 +1,47 @@
+/* Colour-dependent evaluation terms for one side; see side.h */
+#include "side.h"
+
+static int SIDED(eval_pawns)(const Position *p) {
+	Bitboard pawns = p->pieces[US][PAWN];
+	Bitboard enemy = p->pieces[THEM][PAWN];
+	int score = 0;
+	Bitboard bb = pawns;
+	while (bb) {
+		int sq = __builtin_ctzll(bb);
+		bb &= bb - 1;
+		int f = sq & 7;
+		/* Doubled: another friendly pawn on the same file */
+		if (pawns & file_mask[f] & ~(1ULL << sq))
+			score += DOUBLED_PAWN;
+		/* Isolated: no friendly pawns on adjacent files */
+		Bitboard adj = adjacent_files[f];
+		if (!(pawns & adj))
+			score += ISOLATED_PAWN;
+		/* Passed: no enemy pawns on same or adjacent files ahead */
+		if (!(enemy & (file_mask[f] | adj) & FORWARD_RANKS(sq)))
+			score += passed_pawn[REL_RANK(sq >> 3)];
+	}
+	return score;
+}
+
+static int SIDED(eval_king_safety)(const Position *p) {
+	Bitboard king = p->pieces[US][KING];
+	if (!king) return 0;
+	int ksq = __builtin_ctzll(king);
+	int kf = ksq & 7;
+	int score = 0;
+	Bitboard pawns = p->pieces[US][PAWN];
+	/* Pawn shield: the closest pawn on each file near the king */
+	for (int df = -1; df <= 1; df++) {
+		int f = kf + df;
+		if (f < 0 || f > 7) continue;
+		Bitboard fpawns = pawns & file_mask[f];
+		if (fpawns) {
+			int dist = REL_RANK(BACKMOST(fpawns) >> 3) - REL_RANK(ksq >> 3);
+			if (dist >= 1 && dist <= 2) score += SHIELD_PAWN;
+		} else {
+			score += SHIELD_MISSING;
+		}
+	}
+	return score;
+}
@@ -0,0 +1,102 @@
+/* Evaluation weights in centipawns. gce-tune rewrites this file with
+ * tuned values; hand edits are kept until the next tuning run. */
+#ifndef EVALPARAMS_H
+#define EVALPARAMS_H
+
+#include "board.h"
+
+#define VAL_PAWN           100
+#define VAL_KNIGHT         320
+#define VAL_BISHOP         330
+#define VAL_ROOK           500
+#define VAL_QUEEN          900
+
+#define BISHOP_PAIR         30
+#define KNIGHT_PAWN_ADJ      6  /* per own pawn above five */
+#define ROOK_PAWN_ADJ      -12  /* per own pawn above five */
+#define DOUBLED_PAWN       -10
+#define ISOLATED_PAWN      -15
+#define SHIELD_PAWN         10  /* per file next to the king */
+#define SHIELD_MISSING     -15
+#define MOBILITY             3  /* per move */
+#define ROOK_OPEN_FILE      20
+#define ROOK_SEMI_OPEN      10
+
+/* Passed pawn by relative rank */
+static const int passed_pawn[8] = {
+	   0,   11,   14,   19,   26,   35,   46,    0
+};
+
+/* Piece-square tables from white's side, a1 first */
+static const int pst_pawn[64] = {
+	   0,    0,    0,    0,    0,    0,    0,    0,
+	   5,   10,   10,  -20,  -20,   10,   10,    5,
+	   5,   -5,  -10,    0,    0,  -10,   -5,    5,
+	   0,    0,    0,   20,   20,    0,    0,    0,
+	   5,    5,   10,   25,   25,   10,    5,    5,
+	  10,   10,   20,   30,   30,   20,   10,   10,
+	  50,   50,   50,   50,   50,   50,   50,   50,
+	   0,    0,    0,    0,    0,    0,    0,    0
+};
+static const int pst_knight[64] = {
+	 -50,  -40,  -30,  -30,  -30,  -30,  -40,  -50,
+	 -40,  -20,    0,    5,    5,    0,  -20,  -40,
+	 -30,    5,   10,   15,   15,   10,    5,  -30,
+	 -30,    0,   15,   20,   20,   15,    0,  -30,
+	 -30,    5,   15,   20,   20,   15,    5,  -30,
+	 -30,    0,   10,   15,   15,   10,    0,  -30,
+	 -40,  -20,    0,    0,    0,    0,  -20,  -40,
+	 -50,  -40,  -30,  -30,  -30,  -30,  -40,  -50
+};
+static const int pst_bishop[64] = {
+	 -20,  -10,  -10,  -10,  -10,  -10,  -10,  -20,
+	 -10,    5,    0,    0,    0,    0,    5,  -10,
+	 -10,   10,   10,   10,   10,   10,   10,  -10,
+	 -10,    0,   10,   10,   10,   10,    0,  -10,
+	 -10,    5,    5,   10,   10,    5,    5,  -10,
+	 -10,    0,    5,   10,   10,    5,    0,  -10,
+	 -10,    0,    0,    0,    0,    0,    0,  -10,
+	 -20,  -10,  -10,  -10,  -10,  -10,  -10,  -20
+};
+static const int pst_rook[64] = {
+	   0,    0,    0,    5,    5,    0,    0,    0,
+	  -5,    0,    0,    0,    0,    0,    0,   -5,
+	  -5,    0,    0,    0,    0,    0,    0,   -5,
+	  -5,    0,    0,    0,    0,    0,    0,   -5,
+	  -5,    0,    0,    0,    0,    0,    0,   -5,
+	  -5,    0,    0,    0,    0,    0,    0,   -5,
+	   5,   10,   10,   10,   10,   10,   10,    5,
+	   0,    0,    0,    0,    0,    0,    0,    0
+};
+static const int pst_queen[64] = {
+	 -20,  -10,  -10,   -5,   -5,  -10,  -10,  -20,
+	 -10,    0,    5,    0,    0,    0,    0,  -10,
+	 -10,    5,    5,    5,    5,    5,    0,  -10,
+	   0,    0,    5,    5,    5,    5,    0,   -5,
+	  -5,    0,    5,    5,    5,    5,    0,   -5,
+	 -10,    0,    5,    5,    5,    5,    0,  -10,
+	 -10,    0,    0,    0,    0,    0,    0,  -10,
+	 -20,  -10,  -10,   -5,   -5,  -10,  -10,  -20
+};
+static const int pst_king_mg[64] = {
+	  20,   30,   10,    0,    0,   10,   30,   20,
+	  20,   20,    0,    0,    0,    0,   20,   20,
+	 -10,  -20,  -20,  -20,  -20,  -20,  -20,  -10,
+	 -20,  -30,  -30,  -40,  -40,  -30,  -30,  -20,
+	 -30,  -40,  -40,  -50,  -50,  -40,  -40,  -30,
+	 -30,  -40,  -40,  -50,  -50,  -40,  -40,  -30,
+	 -30,  -40,  -40,  -50,  -50,  -40,  -40,  -30,
+	 -30,  -40,  -40,  -50,  -50,  -40,  -40,  -30
+};
+static const int pst_king_eg[64] = {
+	 -50,  -30,  -30,  -30,  -30,  -30,  -30,  -50,
+	 -30,  -30,    0,    0,    0,    0,  -30,  -30,
+	 -30,  -10,   20,   30,   30,   20,  -10,  -30,
+	 -30,  -10,   30,   40,   40,   30,  -10,  -30,
+	 -30,  -10,   30,   40,   40,   30,  -10,  -30,
+	 -30,  -10,   20,   30,   30,   20,  -10,  -30,
+	 -30,  -20,  -10,    0,    0,  -10,  -20,  -30,
+	 -50,  -40,  -30,  -20,  -20,  -30,  -40,  -50
+};
+
+#endif
@@ -0,0 +1,247 @@
+#define _POSIX_C_SOURCE 200809L
+#include "gensfen.h"
+#include "board.h"
+#include "movegen.h"
+#include "move.h"
+#include "engine.h"
+#include "sfen.h"
+#include "tt.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+/*
+ * Self-play training data. Each thread plays games from a randomised
+ * opening with fixed-depth or fixed-node searches, keeps a record for
+ * every quiet position (not in check, best move not a capture or
+ * promotion), labels them with the game result once it is known and
+ * appends them to the output through a per-thread buffer.
+ */
+
+#define GEN_BUFFER_RECORDS 4096
+#define GEN_MAX_PLIES      400
+#define GEN_ADJUDICATE     3000   /* |score| that ends the game */
+
+typedef struct {
+	const GensfenConfig *cfg;
+	FILE                *out;
+	pthread_mutex_t      lock;     /* out and the counters */
+	uint64_t             written;
+	uint64_t             games;
+	bool                 done;
+	int64_t              start;
+	int                  threads;
+} Generator;
+
+typedef struct {
+	Generator *gen;
+	int        index;
+} GenWorker;
+
+static int64_t gen_time_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static uint64_t gen_rand(uint64_t *s) {
+	*s ^= *s >> 12;
+	*s ^= *s << 25;
+	*s ^= *s >> 27;
+	return *s * 0x2545F4914F6CDD1DULL;
+}
+
+static void gen_report(Generator *g) {
+	int64_t ms = gen_time_ms() - g->start;
+	if (ms == 0) ms = 1;
+	double pps = g->written * 1000.0 / ms;
+	fprintf(stderr, "%llu positions, %llu games, %.1f s: %.0f pos/s, %.0f pos/s/core\n",
+	        (unsigned long long)g->written, (unsigned long long)g->games,
+	        ms / 1000.0, pps, pps / g->threads);
+}
+
+/* Append buffered records; returns false once enough have been written */
+static bool gen_flush(Generator *g, SfenRecord *buf, int *n, uint64_t games) {
+	pthread_mutex_lock(&g->lock);
+	uint64_t room = g->cfg->count - g->written;
+	size_t take = (uint64_t)*n < room ? (size_t)*n : (size_t)room;
+	if (!g->done && take > 0) {
+		fwrite(buf, SFEN_RECORD_SIZE, take, g->out);
+		uint64_t before = g->written;
+		g->written += take;
+		if (g->written / 100000 != before / 100000) gen_report(g);
+	}
+	g->games += games;
+	if (g->written >= g->cfg->count) g->done = true;
+	bool more = !g->done;
+	pthread_mutex_unlock(&g->lock);
+	*n = 0;
+	return more;
+}
+
+static bool is_repetition(const uint64_t *hashes, int ply, int halfmove) {
+	for (int i = ply - 2; i >= 0 && i >= ply - halfmove; i -= 2)
+		if (hashes[i] == hashes[ply]) return true;
+	return false;
+}
+
+/* Plays one game into recs; returns the number of records */
+static int gen_game(const GensfenConfig *cfg, SearchState *st,
+                    volatile int *stop, uint64_t *rng, SfenRecord *recs) {
+	Position pos;
+	uint64_t hashes[GEN_MAX_PLIES + 1];
+	bool white_side[GEN_MAX_PLIES];
+	int n = 0, result = 0;   /* result from white's view */
+	MoveList legal;
+
+	init_position(&pos);
+	for (int i = 0; i < cfg->random_plies; i++) {
+		generate_legal_moves(&pos, &legal);
+		if (legal.count == 0) return 0;
+		make_move(&pos, &legal.moves[gen_rand(rng) % (uint64_t)legal.count]);
+	}
+	hashes[0] = pos.hash;
+
+	for (int ply = 0; ; ply++) {
+		GameState state = get_game_state(&pos);
+		if (state == GAME_CHECKMATE) {
+			result = pos.white_turn ? -1 : 1;
+			break;
+		}
+		if (state != GAME_ONGOING || ply >= GEN_MAX_PLIES ||
+		    (ply > 0 && is_repetition(hashes, ply, pos.halfmove)))
+			break;
+
+		*stop = 0;
+		st->node_limit = cfg->nodes;
+		Move best;
+		int score = engine_search_state(st, &pos, cfg->depth, 0, false, &best);
+		if (score >= GEN_ADJUDICATE || score <= -GEN_ADJUDICATE) {
+			result = (score > 0) == pos.white_turn ? 1 : -1;
+			break;
+		}
+
+		if (!is_in_check(&pos) && !MOVE_IS_CAPTURE(best.flags) &&
+		    !MOVE_IS_PROMO(best.flags)) {
+			sfen_record(&pos, score, cfg->random_plies + ply, &recs[n]);
+			white_side[n++] = pos.white_turn;
+		}
+		make_move(&pos, &best);
+		hashes[ply + 1] = pos.hash;
+	}
+
+	for (int i = 0; i < n; i++)
+		recs[i].result = (int8_t)(white_side[i] ? result : -result);
+	return n;
+}
+
+static void *gen_worker(void *arg) {
+	GenWorker *w = arg;
+	Generator *g = w->gen;
+	volatile int stop = 0;
+	SearchState *st = malloc(sizeof(SearchState));
+	SfenRecord *buf = malloc(sizeof(SfenRecord) * (GEN_BUFFER_RECORDS + GEN_MAX_PLIES));
+	if (!st || !buf || !tt_ensure()) {
+		free(st);
+		free(buf);
+		return NULL;
+	}
+	search_state_init(st, &stop);
+	uint64_t rng = g->cfg->seed ^ (0x9E3779B97F4A7C15ULL * (uint64_t)(w->index + 1));
+	if (!rng) rng = 1;
+
+	int n = 0;
+	uint64_t games = 0;
+	for (;;) {
+		n += gen_game(g->cfg, st, &stop, &rng, buf + n);
+		games++;
+		if (n >= GEN_BUFFER_RECORDS) {
+			if (!gen_flush(g, buf, &n, games)) break;
+			games = 0;
+		} else if (g->done) {
+			break;
+		}
+	}
+	if (n > 0 || games > 0) gen_flush(g, buf, &n, games);
+	free(st);
+	free(buf);
+	return NULL;
+}
+
+int gensfen_run(const char *path, const GensfenConfig *cfg) {
+	Generator g;
+	memset(&g, 0, sizeof(g));
+	g.cfg = cfg;
+	g.out = fopen(path, "ab");
+	if (!g.out) {
+		fprintf(stderr, "cannot open %s\n", path);
+		return 1;
+	}
+	setvbuf(g.out, NULL, _IOFBF, 1 << 20);
+	pthread_mutex_init(&g.lock, NULL);
+
+	g.threads = cfg->threads > 0 ? cfg->threads : (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if (g.threads < 1) g.threads = 1;
+	fprintf(stderr, "Generating %llu positions into %s: %d threads, ",
+	        (unsigned long long)cfg->count, path, g.threads);
+	if (cfg->nodes) fprintf(stderr, "%llu nodes", (unsigned long long)cfg->nodes);
+	else fprintf(stderr, "depth %d", cfg->depth);
+	fprintf(stderr, " per move, %d random plies\n", cfg->random_plies);
+
+	GenWorker *workers = malloc(sizeof(GenWorker) * (size_t)g.threads);
+	pthread_t *tids = malloc(sizeof(pthread_t) * (size_t)g.threads);
+	if (!workers || !tids) return 1;
+	g.start = gen_time_ms();
+	int started = 0;
+	for (int i = 0; i < g.threads; i++) {
+		workers[started].gen = &g;
+		workers[started].index = i;
+		if (pthread_create(&tids[started], NULL, gen_worker, &workers[started]) == 0)
+			started++;
+	}
+	for (int i = 0; i < started; i++)
+		pthread_join(tids[i], NULL);
+
+	fclose(g.out);
+	g.threads = started > 0 ? started : 1;
+	gen_report(&g);
+	pthread_mutex_destroy(&g.lock);
+	free(workers);
+	free(tids);
+	return started > 0 ? 0 : 1;
+}
+
+/* Records as EPD lines: ce is the search score and c9 the result, as
+ * read by gce-tune */
+int gensfen_to_epd(const char *path) {
+	static const char *results[3] = { "0-1", "1/2-1/2", "1-0" };
+	SfenFile f;
+	if (!sfen_open(&f, path)) {
+		fprintf(stderr, "cannot open %s\n", path);
+		return 1;
+	}
+	uint64_t bad = 0;
+	for (size_t i = 0; i < f.count; i++) {
+		const SfenRecord *r = &f.records[i];
+		Position p;
+		char fen[FEN_MAX];
+		if (!sfen_unpack(&r->pos, &p) || r->result < -1 || r->result > 1) {
+			bad++;
+			continue;
+		}
+		position_to_fen(&p, fen);
+		/* Drop the move counters to keep the four EPD fields */
+		*strrchr(fen, ' ') = '\0';
+		*strrchr(fen, ' ') = '\0';
+		int white_result = p.white_turn ? r->result : -r->result;
+		printf("%s ce %d; c9 \"%s\";\n", fen, sfen_score(r),
+		       results[white_result + 1]);
+	}
+	sfen_close(&f);
+	if (bad) fprintf(stderr, "%llu malformed records skipped\n",
+	                 (unsigned long long)bad);
+	return 0;
+}
@@ -0,0 +1,18 @@
+#ifndef GENSFEN_H
+#define GENSFEN_H
+
+#include <stdint.h>
+
+typedef struct {
+	uint64_t count;          /* positions to write */
+	int      threads;        /* 0 for one per CPU */
+	int      depth;          /* per move, 0 for no depth limit */
+	uint64_t nodes;          /* per move, 0 for none */
+	int      random_plies;   /* random opening moves before recording */
+	uint64_t seed;
+} GensfenConfig;
+
+int gensfen_run(const char *path, const GensfenConfig *cfg);
+int gensfen_to_epd(const char *path);
+
+#endif
@@ -0,0 +1,282 @@
+#include "board.h"
+#include "bitbase.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * Build-time table generator: prints tables.c, the attack tables, Zobrist
+ * keys and KPK bitbase the engine used to compute at every start.
+ * Run by the Makefile as "./gentables > tables.c".
+ */
+
+static Bitboard pawn_attack_table[2][64];
+static Bitboard knight_attack_table[64];
+static Bitboard king_attack_table[64];
+static Bitboard bishop_pseudo_table[64];
+static Bitboard rook_pseudo_table[64];
+static Bitboard between_table[64][64];
+static Bitboard line_table[64][64];
+static uint64_t zobrist_piece[2][NUM_PIECE_TYPES][64];
+static uint64_t zobrist_side;
+static uint64_t zobrist_castling[16];
+static uint64_t zobrist_ep[8];
+static uint32_t kpk_table[KPK_SIZE / 32];
+
+#define FILE_A  0x0101010101010101ULL
+#define FILE_H  0x8080808080808080ULL
+#define FILE_AB (FILE_A | (FILE_A << 1))
+#define FILE_GH (FILE_H | (FILE_H >> 1))
+
+static void gen_leapers(void) {
+	for (int sq = 0; sq < 64; sq++) {
+		Bitboard bb = 1ULL << sq, a = 0;
+		pawn_attack_table[WHITE][sq] =
+			((bb & ~FILE_A) << 7) | ((bb & ~FILE_H) << 9);
+		pawn_attack_table[BLACK][sq] =
+			((bb & ~FILE_H) >> 7) | ((bb & ~FILE_A) >> 9);
+
+		a |= (bb & ~FILE_A)  << 15;  a |= (bb & ~FILE_H)  << 17;
+		a |= (bb & ~FILE_AB) << 6;   a |= (bb & ~FILE_GH) << 10;
+		a |= (bb & ~FILE_H)  >> 15;  a |= (bb & ~FILE_A)  >> 17;
+		a |= (bb & ~FILE_GH) >> 6;   a |= (bb & ~FILE_AB) >> 10;
+		knight_attack_table[sq] = a;
+
+		a = 0;
+		a |= (bb & ~FILE_A) << 7;  a |= bb << 8;  a |= (bb & ~FILE_H) << 9;
+		a |= (bb & ~FILE_H) << 1;  a |= (bb & ~FILE_H) >> 7;
+		a |= bb >> 8;  a |= (bb & ~FILE_A) >> 9;  a |= (bb & ~FILE_A) >> 1;
+		king_attack_table[sq] = a;
+	}
+}
+
+static const int bishop_dirs[4][2] = {{-1,1},{1,1},{-1,-1},{1,-1}};
+static const int rook_dirs[4][2]   = {{0,1},{0,-1},{-1,0},{1,0}};
+
+static Bitboard slide(int sq, Bitboard occ, const int dirs[4][2]) {
+	Bitboard atk = 0;
+	for (int d = 0; d < 4; d++) {
+		int f = (sq & 7) + dirs[d][0], r = (sq >> 3) + dirs[d][1];
+		while (f >= 0 && f <= 7 && r >= 0 && r <= 7) {
+			Bitboard tb = 1ULL << (r * 8 + f);
+			atk |= tb;
+			if (occ & tb) break;
+			f += dirs[d][0];
+			r += dirs[d][1];
+		}
+	}
+	return atk;
+}
+
+/* Empty-board slider rays, and the squares between/through aligned pairs */
+static void gen_lines(void) {
+	for (int sq = 0; sq < 64; sq++) {
+		bishop_pseudo_table[sq] = slide(sq, 0, bishop_dirs);
+		rook_pseudo_table[sq]   = slide(sq, 0, rook_dirs);
+	}
+	for (int a = 0; a < 64; a++)
+		for (int b = 0; b < 64; b++) {
+			Bitboard ab = (1ULL << a) | (1ULL << b);
+			if (a == b) continue;
+			if (bishop_pseudo_table[a] & (1ULL << b)) {
+				line_table[a][b] = (bishop_pseudo_table[a]
+				                  & bishop_pseudo_table[b]) | ab;
+				between_table[a][b] = slide(a, 1ULL << b, bishop_dirs)
+				                    & slide(b, 1ULL << a, bishop_dirs);
+			} else if (rook_pseudo_table[a] & (1ULL << b)) {
+				line_table[a][b] = (rook_pseudo_table[a]
+				                  & rook_pseudo_table[b]) | ab;
+				between_table[a][b] = slide(a, 1ULL << b, rook_dirs)
+				                    & slide(b, 1ULL << a, rook_dirs);
+			}
+		}
+}
+
+static uint64_t xorshift64(uint64_t *state) {
+	uint64_t x = *state;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	*state = x;
+	return x;
+}
+
+static void gen_zobrist(void) {
+	uint64_t state = 0x4D595A6F62726973ULL;
+	for (int c = 0; c < 2; c++)
+		for (int p = 0; p < NUM_PIECE_TYPES; p++)
+			for (int s = 0; s < 64; s++)
+				zobrist_piece[c][p][s] = xorshift64(&state);
+	zobrist_side = xorshift64(&state);
+	for (int i = 0; i < 16; i++)
+		zobrist_castling[i] = xorshift64(&state);
+	for (int i = 0; i < 8; i++)
+		zobrist_ep[i] = xorshift64(&state);
+}
+
+/*
+ * KPK by retrograde analysis: classify what is decided at once, then
+ * propagate until nothing changes. The strong side is white with the
+ * pawn on files a-d.
+ */
+enum {
+	KPK_INVALID = 0,
+	KPK_UNKNOWN = 1,
+	KPK_DRAW    = 2,
+	KPK_WIN     = 4
+};
+
+static int sq_distance(int a, int b) {
+	int df = abs(SQ_FILE(a) - SQ_FILE(b));
+	int dr = abs(SQ_RANK(a) - SQ_RANK(b));
+	return df > dr ? df : dr;
+}
+
+static uint8_t kpk_classify_initial(int idx) {
+	int wksq = idx & 0x3F;
+	int bksq = (idx >> 6) & 0x3F;
+	Color stm = (Color)((idx >> 12) & 1);
+	int psq = (6 - (idx >> 15)) * 8 + ((idx >> 13) & 3);
+
+	if (sq_distance(wksq, bksq) <= 1 || wksq == psq || bksq == psq)
+		return KPK_INVALID;
+	if (stm == WHITE && (pawn_attack_table[WHITE][psq] & (1ULL << bksq)))
+		return KPK_INVALID;
+
+	/* Pawn promotes and the queen cannot be taken */
+	if (stm == WHITE && SQ_RANK(psq) == 6) {
+		int qsq = psq + 8;
+		if (wksq != qsq && bksq != qsq
+		    && (sq_distance(bksq, qsq) > 1 || sq_distance(wksq, qsq) == 1))
+			return KPK_WIN;
+	}
+
+	if (stm == BLACK) {
+		Bitboard bk_moves = king_attack_table[bksq];
+		/* Stalemate */
+		if (!(bk_moves & ~(king_attack_table[wksq]
+		                   | pawn_attack_table[WHITE][psq])))
+			return KPK_DRAW;
+		/* Undefended pawn falls */
+		if (bk_moves & ~king_attack_table[wksq] & (1ULL << psq))
+			return KPK_DRAW;
+	}
+	return KPK_UNKNOWN;
+}
+
+static uint8_t kpk_classify(const uint8_t *db, int idx) {
+	int wksq = idx & 0x3F;
+	int bksq = (idx >> 6) & 0x3F;
+	Color stm = (Color)((idx >> 12) & 1);
+	int psq = (6 - (idx >> 15)) * 8 + ((idx >> 13) & 3);
+	int r = KPK_INVALID;
+
+	if (stm == WHITE) {
+		Bitboard moves = king_attack_table[wksq];
+		while (moves) {
+			int to = __builtin_ctzll(moves);
+			moves &= moves - 1;
+			r |= db[kpk_index(BLACK, bksq, to, psq)];
+		}
+		if (SQ_RANK(psq) < 6)
+			r |= db[kpk_index(BLACK, bksq, wksq, psq + 8)];
+		if (SQ_RANK(psq) == 1 && psq + 8 != wksq && psq + 8 != bksq)
+			r |= db[kpk_index(BLACK, bksq, wksq, psq + 16)];
+		return (r & KPK_WIN) ? KPK_WIN
+		     : (r & KPK_UNKNOWN) ? KPK_UNKNOWN : KPK_DRAW;
+	}
+
+	Bitboard moves = king_attack_table[bksq];
+	while (moves) {
+		int to = __builtin_ctzll(moves);
+		moves &= moves - 1;
+		r |= db[kpk_index(WHITE, to, wksq, psq)];
+	}
+	return (r & KPK_DRAW) ? KPK_DRAW
+	     : (r & KPK_UNKNOWN) ? KPK_UNKNOWN : KPK_WIN;
+}
+
+static void gen_kpk(void) {
+	static uint8_t db[KPK_SIZE];
+	for (int i = 0; i < KPK_SIZE; i++)
+		db[i] = kpk_classify_initial(i);
+
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		for (int i = 0; i < KPK_SIZE; i++)
+			if (db[i] == KPK_UNKNOWN && (db[i] = kpk_classify(db, i)) != KPK_UNKNOWN)
+				changed = true;
+	}
+
+	for (int i = 0; i < KPK_SIZE; i++)
+		if (db[i] == KPK_WIN)
+			kpk_table[i >> 5] |= 1u << (i & 31);
+}
+
+static void newline(int indent) {
+	putchar('\n');
+	while (indent--) putchar('\t');
+}
+
+static void emit_values(const void *data, size_t at, const int *dims, int nd,
+                        int bits, int indent) {
+	if (nd > 1) {
+		size_t stride = 1;
+		for (int i = 1; i < nd; i++) stride *= (size_t)dims[i];
+		for (int i = 0; i < dims[0]; i++) {
+			if (i) putchar(',');
+			newline(indent);
+			putchar('{');
+			emit_values(data, at + i * stride, dims + 1, nd - 1, bits, indent + 1);
+			newline(indent);
+			putchar('}');
+		}
+		return;
+	}
+	for (int i = 0; i < dims[0]; i++) {
+		if (i) putchar(',');
+		if (i % 4 == 0) newline(indent);
+		else putchar(' ');
+		if (bits == 64)
+			printf("0x%016llxULL", (unsigned long long)((const uint64_t *)data)[at + i]);
+		else
+			printf("0x%08xu", ((const uint32_t *)data)[at + i]);
+	}
+}
+
+/* "const <type> <name>[d0][d1]... = {...};", four values to a line */
+static void emit(const char *type, const char *name, const void *data,
+                 int bits, int nd, const int *dims) {
+	printf("\nconst %s %s", type, name);
+	for (int i = 0; i < nd; i++) printf("[%d]", dims[i]);
+	printf(" = {");
+	emit_values(data, 0, dims, nd, bits, 1);
+	printf("\n};\n");
+}
+
+#define EMIT(type, table, bits, ...) \
+	emit(type, #table, table, bits, \
+	     sizeof((int[]){ __VA_ARGS__ }) / sizeof(int), (int[]){ __VA_ARGS__ })
+
+int main(void) {
+	gen_leapers();
+	gen_lines();
+	gen_zobrist();
+	gen_kpk();
+
+	printf("/* Generated by gentables; do not edit */\n#include \"tables.h\"\n");
+	EMIT("Bitboard", pawn_attack_table, 64, 2, 64);
+	EMIT("Bitboard", knight_attack_table, 64, 64);
+	EMIT("Bitboard", king_attack_table, 64, 64);
+	EMIT("Bitboard", bishop_pseudo_table, 64, 64);
+	EMIT("Bitboard", rook_pseudo_table, 64, 64);
+	EMIT("Bitboard", between_table, 64, 64, 64);
+	EMIT("Bitboard", line_table, 64, 64, 64);
+	EMIT("uint64_t", zobrist_piece, 64, 2, NUM_PIECE_TYPES, 64);
+	printf("\nconst uint64_t zobrist_side = 0x%016llxULL;\n",
+	       (unsigned long long)zobrist_side);
+	EMIT("uint64_t", zobrist_castling, 64, 16);
+	EMIT("uint64_t", zobrist_ep, 64, 8);
+	EMIT("uint32_t", kpk_table, 32, KPK_SIZE / 32);
+	return 0;
+}
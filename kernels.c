@@ -0,0 +1,422 @@
+/*
+ * The hot kernels: attack maps, slider fills, classic evaluation and the
+ * NNUE accumulator. The Makefile compiles this file once per ISA level,
+ * naming the exported table after KERNEL_ISA, and cpu.c picks the best
+ * table the CPU can run.
+ */
+#include "kernels.h"
+#include "attack.h"
+#include "evalparams.h"
+#include "profile.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SIMD "avx2"
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define SIMD "sse2"
+#else
+#define SIMD "scalar"
+#endif
+
+#ifndef KERNEL_ISA
+#define KERNEL_ISA generic
+#endif
+#define CAT_(a, b) a##b
+#define CAT(a, b)  CAT_(a, b)
+
+#define FILE_A     0x0101010101010101ULL
+#define FILE_H     0x8080808080808080ULL
+#define NOT_FILE_A (~FILE_A)
+#define NOT_FILE_H (~FILE_H)
+
+/*
+ * Kogge-Stone occluded fills: each step doubles the distance a ray has
+ * travelled through empty squares, so three steps cover the board. The
+ * propagator is masked so rays shifted across the a/h edge die.
+ */
+
+static const int      dir_shift[8] = { 8, 1, 8, 1, 9, 7, 9, 7 };
+static const Bitboard dir_mask[8]  = {
+	~0ULL, NOT_FILE_A, ~0ULL, NOT_FILE_H,
+	NOT_FILE_A, NOT_FILE_H, NOT_FILE_H, NOT_FILE_A
+};
+#define DIR_UP(d) (((d) & 2) == 0)   /* N E NE NW shift towards h8 */
+
+#if defined(__AVX2__)
+/* Four rays at once, each lane with its own shift */
+static inline __m256i fill4(__m256i gen, __m256i pro, __m256i mask, __m256i s,
+                     bool up) {
+	__m256i s2 = _mm256_add_epi64(s, s), s4 = _mm256_add_epi64(s2, s2);
+#define SH(v, n) (up ? _mm256_sllv_epi64(v, n) : _mm256_srlv_epi64(v, n))
+	pro = _mm256_and_si256(pro, mask);
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, SH(gen, s)));
+	pro = _mm256_and_si256(pro, SH(pro, s));
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, SH(gen, s2)));
+	pro = _mm256_and_si256(pro, SH(pro, s2));
+	gen = _mm256_or_si256(gen, _mm256_and_si256(pro, SH(gen, s4)));
+	return _mm256_and_si256(SH(gen, s), mask);
+#undef SH
+}
+
+static void slider_fills(Bitboard rooks, Bitboard bishops, Bitboard queens,
+                         Bitboard occ, SliderSets *s) {
+	__m256i empty = _mm256_set1_epi64x((long long)~occ);
+	/* Lanes: two directions of the rook or bishop set, then the same
+	 * two of the queens */
+	for (int d = 0; d < 8; d += 2) {
+		long long set = (long long)(d < 4 ? rooks : bishops);
+		__m256i gen = _mm256_set_epi64x((long long)queens, (long long)queens,
+		                                set, set);
+		__m256i mask = _mm256_set_epi64x((long long)dir_mask[d + 1],
+		                                 (long long)dir_mask[d],
+		                                 (long long)dir_mask[d + 1],
+		                                 (long long)dir_mask[d]);
+		__m256i sh = _mm256_set_epi64x(dir_shift[d + 1], dir_shift[d],
+		                               dir_shift[d + 1], dir_shift[d]);
+		Bitboard out[4];
+		_mm256_storeu_si256((__m256i *)out,
+		                    fill4(gen, empty, mask, sh, DIR_UP(d)));
+		Bitboard *pair = d < 4 ? &s->rook[d] : &s->bishop[d - 4];
+		pair[0] = out[0];
+		pair[1] = out[1];
+		s->queen[d] = out[2];
+		s->queen[d + 1] = out[3];
+	}
+}
+#elif defined(__SSE2__)
+/* One direction for two sets at once; SSE2 shifts share a count */
+static inline __m128i fill2(__m128i gen, __m128i pro, __m128i mask, int s, bool up) {
+	__m128i c1 = _mm_cvtsi32_si128(s), c2 = _mm_cvtsi32_si128(2 * s);
+	__m128i c4 = _mm_cvtsi32_si128(4 * s);
+#define SH(v, n) (up ? _mm_sll_epi64(v, n) : _mm_srl_epi64(v, n))
+	pro = _mm_and_si128(pro, mask);
+	gen = _mm_or_si128(gen, _mm_and_si128(pro, SH(gen, c1)));
+	pro = _mm_and_si128(pro, SH(pro, c1));
+	gen = _mm_or_si128(gen, _mm_and_si128(pro, SH(gen, c2)));
+	pro = _mm_and_si128(pro, SH(pro, c2));
+	gen = _mm_or_si128(gen, _mm_and_si128(pro, SH(gen, c4)));
+	return _mm_and_si128(SH(gen, c1), mask);
+#undef SH
+}
+
+static void slider_fills(Bitboard rooks, Bitboard bishops, Bitboard queens,
+                         Bitboard occ, SliderSets *s) {
+	__m128i empty = _mm_set1_epi64x((long long)~occ);
+	/* Lanes: the rook or bishop set, then the queens */
+	for (int d = 0; d < 4; d++) {
+		Bitboard out[2];
+		_mm_storeu_si128((__m128i *)out,
+		                 fill2(_mm_set_epi64x((long long)queens, (long long)rooks),
+		                       empty, _mm_set1_epi64x((long long)dir_mask[d]),
+		                       dir_shift[d], DIR_UP(d)));
+		s->rook[d] = out[0];
+		s->queen[d] = out[1];
+		_mm_storeu_si128((__m128i *)out,
+		                 fill2(_mm_set_epi64x((long long)queens, (long long)bishops),
+		                       empty, _mm_set1_epi64x((long long)dir_mask[d + 4]),
+		                       dir_shift[d + 4], DIR_UP(d + 4)));
+		s->bishop[d] = out[0];
+		s->queen[d + 4] = out[1];
+	}
+}
+#else
+static inline Bitboard fill1(Bitboard gen, Bitboard pro, Bitboard mask, int s,
+                      bool up) {
+#define SH(v, n) (up ? (v) << (n) : (v) >> (n))
+	pro &= mask;
+	gen |= pro & SH(gen, s);      pro &= SH(pro, s);
+	gen |= pro & SH(gen, 2 * s);  pro &= SH(pro, 2 * s);
+	gen |= pro & SH(gen, 4 * s);
+	return SH(gen, s) & mask;
+#undef SH
+}
+
+static void slider_fills(Bitboard rooks, Bitboard bishops, Bitboard queens,
+                         Bitboard occ, SliderSets *s) {
+	for (int d = 0; d < 4; d++) {
+		int e = d + 4;
+		s->rook[d]   = fill1(rooks, ~occ, dir_mask[d], dir_shift[d], DIR_UP(d));
+		s->queen[d]  = fill1(queens, ~occ, dir_mask[d], dir_shift[d], DIR_UP(d));
+		s->bishop[d] = fill1(bishops, ~occ, dir_mask[e], dir_shift[e], DIR_UP(e));
+		s->queen[e]  = fill1(queens, ~occ, dir_mask[e], dir_shift[e], DIR_UP(e));
+	}
+}
+#endif
+
+/* Sliders of the side not to move, which need no per-piece maps. The
+ * fills feed their mobility, the attacked-by maps and the check test. */
+static void enemy_slider_info(const Position *p, Color c, Bitboard occ,
+                              AttackInfo *ai) {
+	SliderSets s;
+	Bitboard friendly = pieces_by_color(p, c);
+	Bitboard rook = 0, bishop = 0, queen = 0;
+	int mob = 0;
+	slider_fills(p->pieces[c][ROOK], p->pieces[c][BISHOP], p->pieces[c][QUEEN],
+	             occ, &s);
+	for (int d = 0; d < 4; d++) {
+		rook   |= s.rook[d];
+		bishop |= s.bishop[d];
+		queen  |= s.queen[d] | s.queen[d + 4];
+		/* Same-direction rays are disjoint, even across piece types */
+		mob += __builtin_popcountll((s.rook[d] | s.queen[d]) & ~friendly)
+		     + __builtin_popcountll((s.bishop[d] | s.queen[d + 4]) & ~friendly);
+	}
+	ai->by_piece[c][BISHOP] = bishop;
+	ai->by_piece[c][ROOK]   = rook;
+	ai->by_piece[c][QUEEN]  = queen;
+	ai->mobility[c] += mob;
+}
+
+static void attack_info(const Position *p, AttackInfo *ai) {
+	Bitboard occ = occupied(p);
+	Color us   = p->white_turn ? WHITE : BLACK;
+	Color them = p->white_turn ? BLACK : WHITE;
+	Bitboard our_king = p->pieces[us][KING];
+	ai->checkers = 0;
+
+	for (int c = 0; c < 2; c++) {
+		Bitboard friendly = pieces_by_color(p, (Color)c);
+		Bitboard pawns = p->pieces[c][PAWN];
+		Bitboard all;
+		int mob = 0;
+
+		ai->by_piece[c][PAWN] = (c == WHITE)
+			? ((pawns & NOT_FILE_A) << 7) | ((pawns & NOT_FILE_H) << 9)
+			: ((pawns & NOT_FILE_H) >> 7) | ((pawns & NOT_FILE_A) >> 9);
+		all = ai->by_piece[c][PAWN];
+
+		/* Move generation wants each of our pieces' attacks; theirs are
+		 * only needed as sets */
+		for (int pt = KNIGHT; pt <= KING; pt++) {
+			if (c == (int)them && pt >= BISHOP && pt <= QUEEN) continue;
+			Bitboard pcs = p->pieces[c][pt], pt_atk = 0;
+			while (pcs) {
+				int sq = __builtin_ctzll(pcs);
+				pcs &= pcs - 1;
+				Bitboard a;
+				switch (pt) {
+				case KNIGHT: a = knight_attacks(sq); break;
+				case BISHOP: a = bishop_attacks(sq, occ); break;
+				case ROOK:   a = rook_attacks(sq, occ); break;
+				case QUEEN:  a = queen_attacks(sq, occ); break;
+				default:     a = king_attacks(sq); break;
+				}
+				ai->piece_attacks[sq] = a;
+				pt_atk |= a;
+				if (pt != KING)
+					mob += __builtin_popcountll(a & ~friendly);
+				if (c == (int)them && (a & our_king))
+					ai->checkers |= 1ULL << sq;
+			}
+			ai->by_piece[c][pt] = pt_atk;
+		}
+		ai->mobility[c] = mob;
+		if (c == (int)them) enemy_slider_info(p, them, occ, ai);
+		for (int pt = KNIGHT; pt <= KING; pt++)
+			all |= ai->by_piece[c][pt];
+		ai->by_color[c] = all;
+	}
+
+	ai->pinned = 0;
+	if (!our_king) return;
+	int ksq = __builtin_ctzll(our_king);
+	ai->checkers |= pawn_attacks(ksq, us) & p->pieces[them][PAWN];
+	Bitboard their_sliders = ai->by_piece[them][BISHOP]
+	                       | ai->by_piece[them][ROOK] | ai->by_piece[them][QUEEN];
+	if (their_sliders & our_king)
+		ai->checkers |= (bishop_attacks(ksq, occ)
+		                 & (p->pieces[them][BISHOP] | p->pieces[them][QUEEN]))
+		              | (rook_attacks(ksq, occ)
+		                 & (p->pieces[them][ROOK] | p->pieces[them][QUEEN]));
+
+	/* Enemy sliders aligned with our king with exactly one own piece between */
+	Bitboard snipers =
+		(rook_pseudo_attacks(ksq)
+		 & (p->pieces[them][ROOK] | p->pieces[them][QUEEN]))
+		| (bishop_pseudo_attacks(ksq)
+		 & (p->pieces[them][BISHOP] | p->pieces[them][QUEEN]));
+	Bitboard friendly = pieces_by_color(p, us);
+	while (snipers) {
+		int s = __builtin_ctzll(snipers);
+		snipers &= snipers - 1;
+		Bitboard b = between_bb(ksq, s) & occ;
+		if (b && !(b & (b - 1)) && (b & friendly))
+			ai->pinned |= b;
+	}
+}
+
+static const int *pst_tables[NUM_PIECE_TYPES] = {
+	pst_pawn, pst_knight, pst_bishop, pst_rook, pst_queen, pst_king_mg
+};
+
+static const Bitboard file_mask[8] = {
+	0x0101010101010101ULL, 0x0202020202020202ULL,
+	0x0404040404040404ULL, 0x0808080808080808ULL,
+	0x1010101010101010ULL, 0x2020202020202020ULL,
+	0x4040404040404040ULL, 0x8080808080808080ULL
+};
+
+static int pst_sum(Bitboard bb, const int *table) {
+	int score = 0;
+	while (bb) {
+		int sq = __builtin_ctzll(bb);
+		score += table[sq];
+		bb &= bb - 1;
+	}
+	return score;
+}
+
+static int pst_sum_mirror(Bitboard bb, const int *table) {
+	int score = 0;
+	while (bb) {
+		int sq = __builtin_ctzll(bb);
+		score += table[(7 - (sq >> 3)) * 8 + (sq & 7)];
+		bb &= bb - 1;
+	}
+	return score;
+}
+
+static const Bitboard adjacent_files[8] = {
+	0x0202020202020202ULL, 0x0505050505050505ULL,
+	0x0A0A0A0A0A0A0A0AULL, 0x1414141414141414ULL,
+	0x2828282828282828ULL, 0x5050505050505050ULL,
+	0xA0A0A0A0A0A0A0A0ULL, 0x4040404040404040ULL
+};
+
+#define WHITE_SIDE 1
+#include "eval_side.h"
+#undef WHITE_SIDE
+#define WHITE_SIDE 0
+#include "eval_side.h"
+#undef WHITE_SIDE
+
+static int eval_mobility(const AttackInfo *ai, Color c) {
+	return ai->mobility[c] * MOBILITY;
+}
+
+static int eval_rooks(const Position *p, Color c) {
+	Bitboard rooks = p->pieces[c][ROOK];
+	Bitboard our_pawns = p->pieces[c][PAWN];
+	Bitboard their_pawns = p->pieces[c ^ 1][PAWN];
+	int score = 0;
+	while (rooks) {
+		int sq = __builtin_ctzll(rooks);
+		rooks &= rooks - 1;
+		int f = sq & 7;
+		if (!(our_pawns & file_mask[f])) {
+			if (!(their_pawns & file_mask[f]))
+				score += ROOK_OPEN_FILE;
+			else
+				score += ROOK_SEMI_OPEN;
+		}
+	}
+	return score;
+}
+
+static int eval_classic(const Position *p, const AttackInfo *ai,
+                        const MaterialEntry *me) {
+	int score = me->value;
+	PROF_BEGIN(t);
+	for (int pt = PAWN; pt < KING; pt++) {
+		score += pst_sum(p->pieces[WHITE][pt], pst_tables[pt]);
+		score -= pst_sum_mirror(p->pieces[BLACK][pt], pst_tables[pt]);
+	}
+	/* King placement tapers from middlegame to endgame table by phase */
+	int king_mg = pst_sum(p->pieces[WHITE][KING], pst_king_mg)
+	            - pst_sum_mirror(p->pieces[BLACK][KING], pst_king_mg);
+	int king_eg = pst_sum(p->pieces[WHITE][KING], pst_king_eg)
+	            - pst_sum_mirror(p->pieces[BLACK][KING], pst_king_eg);
+	score += (king_mg * me->phase + king_eg * (PHASE_MAX - me->phase))
+	       / PHASE_MAX;
+	PROF_END(PROF_EVAL_PST, t);
+	PROF(PROF_EVAL_PAWNS, score += eval_pawns_white(p) - eval_pawns_black(p));
+	PROF(PROF_EVAL_KING,
+	     score += eval_king_safety_white(p) - eval_king_safety_black(p));
+	PROF(PROF_EVAL_PIECES,
+	     score += eval_mobility(ai, WHITE) - eval_mobility(ai, BLACK);
+	     score += eval_rooks(p, WHITE) - eval_rooks(p, BLACK));
+	return score;
+}
+
+/* dst = src + add rows - sub rows. Accumulators may live in malloc'd
+ * search states, so only the net's rows are assumed aligned. */
+static void acc_update(int16_t *dst, const int16_t *src,
+                       const int16_t **add, int n_add,
+                       const int16_t **sub, int n_sub) {
+#if defined(__AVX2__)
+	for (int i = 0; i < NNUE_HIDDEN; i += 16) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+		for (int a = 0; a < n_add; a++)
+			v = _mm256_add_epi16(v, _mm256_load_si256((const __m256i *)(add[a] + i)));
+		for (int s = 0; s < n_sub; s++)
+			v = _mm256_sub_epi16(v, _mm256_load_si256((const __m256i *)(sub[s] + i)));
+		_mm256_storeu_si256((__m256i *)(dst + i), v);
+	}
+#elif defined(__SSE2__)
+	for (int i = 0; i < NNUE_HIDDEN; i += 8) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+		for (int a = 0; a < n_add; a++)
+			v = _mm_add_epi16(v, _mm_load_si128((const __m128i *)(add[a] + i)));
+		for (int s = 0; s < n_sub; s++)
+			v = _mm_sub_epi16(v, _mm_load_si128((const __m128i *)(sub[s] + i)));
+		_mm_storeu_si128((__m128i *)(dst + i), v);
+	}
+#else
+	for (int i = 0; i < NNUE_HIDDEN; i++) {
+		int v = src[i];
+		for (int a = 0; a < n_add; a++) v += add[a][i];
+		for (int s = 0; s < n_sub; s++) v -= sub[s][i];
+		dst[i] = (int16_t)v;
+	}
+#endif
+}
+
+/* sum of clamp(acc, 0, QA) * w */
+static int32_t output_half(const int16_t *acc, const int16_t *w) {
+#if defined(__AVX2__)
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i qa = _mm256_set1_epi16(NNUE_QA);
+	__m256i sum = zero;
+	for (int i = 0; i < NNUE_HIDDEN; i += 16) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(acc + i));
+		v = _mm256_min_epi16(_mm256_max_epi16(v, zero), qa);
+		sum = _mm256_add_epi32(sum, _mm256_madd_epi16(v,
+		          _mm256_load_si256((const __m256i *)(w + i))));
+	}
+	__m128i s = _mm_add_epi32(_mm256_castsi256_si128(sum),
+	                          _mm256_extracti128_si256(sum, 1));
+	s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+	s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+	return _mm_cvtsi128_si32(s);
+#elif defined(__SSE2__)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i qa = _mm_set1_epi16(NNUE_QA);
+	__m128i sum = zero;
+	for (int i = 0; i < NNUE_HIDDEN; i += 8) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(acc + i));
+		v = _mm_min_epi16(_mm_max_epi16(v, zero), qa);
+		sum = _mm_add_epi32(sum, _mm_madd_epi16(v,
+		          _mm_load_si128((const __m128i *)(w + i))));
+	}
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+	return _mm_cvtsi128_si32(sum);
+#else
+	int32_t sum = 0;
+	for (int i = 0; i < NNUE_HIDDEN; i++) {
+		int v = acc[i] < 0 ? 0 : acc[i] > NNUE_QA ? NNUE_QA : acc[i];
+		sum += v * w[i];
+	}
+	return sum;
+#endif
+}
+
+const Kernels CAT(kernels_, KERNEL_ISA) = {
+	.simd         = SIMD,
+	.attack_info  = attack_info,
+	.slider_sets  = slider_fills,
+	.eval_classic = eval_classic,
+	.acc_update   = acc_update,
+	.output_half  = output_half,
+};
@@ -0,0 +1,33 @@
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include "board.h"
+#include "attack.h"
+#include "material.h"
+#include "nnue.h"
+
+/*
+ * The hot kernels, built from kernels.c once per ISA level. All levels
+ * compute the same results; only the instructions differ.
+ */
+typedef struct {
+	const char *simd;   /* "avx2", "sse2" or "scalar" */
+	void    (*attack_info)(const Position *p, AttackInfo *ai);
+	void    (*slider_sets)(Bitboard rooks, Bitboard bishops, Bitboard queens,
+	                       Bitboard occ, SliderSets *s);
+	int     (*eval_classic)(const Position *p, const AttackInfo *ai,
+	                        const MaterialEntry *me);
+	void    (*acc_update)(int16_t *dst, const int16_t *src,
+	                      const int16_t **add, int n_add,
+	                      const int16_t **sub, int n_sub);
+	int32_t (*output_half)(const int16_t *acc, const int16_t *w);
+} Kernels;
+
+/* The best level the CPU supports, chosen before main */
+extern const Kernels *kernels;
+
+const char *kernels_name(void);
+const char *kernels_level(int i);   /* i-th supported level, best first */
+bool        kernels_select(const char *name);
+
+#endif
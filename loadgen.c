@@ -0,0 +1,180 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+/*
+ * Load generator for gce --server. Each client plays a self-play game of
+ * N moves over its own connection and records the time from "go" to
+ * "bestmove"; latency percentiles are printed at the end.
+ */
+
+typedef struct {
+	int    fd;
+	char   buf[8192];
+	size_t len;
+} Conn;
+
+static const char *socket_path;
+static int n_moves, movetime;
+static double *latencies;
+static int n_latencies;
+static pthread_mutex_t lat_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static double now_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+static int conn_send(Conn *c, const char *msg) {
+	size_t n = strlen(msg), off = 0;
+	while (off < n) {
+		ssize_t w = send(c->fd, msg + off, n - off, MSG_NOSIGNAL);
+		if (w < 0 && errno == EINTR) continue;
+		if (w <= 0) return -1;
+		off += (size_t)w;
+	}
+	return 0;
+}
+
+/* Read one line into out (without '\n'); returns -1 on EOF */
+static int conn_line(Conn *c, char *out, size_t size) {
+	for (;;) {
+		char *nl = memchr(c->buf, '\n', c->len);
+		if (nl) {
+			size_t n = (size_t)(nl - c->buf);
+			size_t copy = n < size - 1 ? n : size - 1;
+			memcpy(out, c->buf, copy);
+			out[copy] = '\0';
+			c->len -= n + 1;
+			memmove(c->buf, nl + 1, c->len);
+			return 0;
+		}
+		if (c->len == sizeof(c->buf)) c->len = 0;  /* overlong line */
+		ssize_t r = read(c->fd, c->buf + c->len, sizeof(c->buf) - c->len);
+		if (r < 0 && errno == EINTR) continue;
+		if (r <= 0) return -1;
+		c->len += (size_t)r;
+	}
+}
+
+static int conn_wait(Conn *c, const char *prefix, char *line, size_t size) {
+	while (conn_line(c, line, size) == 0)
+		if (strncmp(line, prefix, strlen(prefix)) == 0) return 0;
+	return -1;
+}
+
+static void *client(void *arg) {
+	(void)arg;
+	Conn c = { .len = 0 };
+	c.fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strncpy(addr.sun_path, socket_path, sizeof(addr.sun_path) - 1);
+	if (c.fd < 0 || connect(c.fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		perror(socket_path);
+		return NULL;
+	}
+
+	char line[4096];
+	char *moves = malloc((size_t)n_moves * 6 + 1);
+	char *cmd = malloc((size_t)n_moves * 6 + 64);
+	size_t mlen = 0;
+	moves[0] = '\0';
+
+	if (conn_send(&c, "uci\n") < 0 || conn_wait(&c, "uciok", line, sizeof(line)) < 0 ||
+	    conn_send(&c, "ucinewgame\nisready\n") < 0 ||
+	    conn_wait(&c, "readyok", line, sizeof(line)) < 0)
+		goto done;
+
+	for (int i = 0; i < n_moves; i++) {
+		sprintf(cmd, "position startpos%s%s\ngo movetime %d\n",
+		        mlen ? " moves" : "", moves, movetime);
+		double t0 = now_ms();
+		if (conn_send(&c, cmd) < 0 ||
+		    conn_wait(&c, "bestmove", line, sizeof(line)) < 0)
+			break;
+		double dt = now_ms() - t0;
+
+		pthread_mutex_lock(&lat_lock);
+		latencies[n_latencies++] = dt;
+		pthread_mutex_unlock(&lat_lock);
+
+		char mv[8];
+		if (sscanf(line, "bestmove %7s", mv) != 1 || strcmp(mv, "0000") == 0) {
+			/* Game over: start a new one */
+			mlen = 0;
+			moves[0] = '\0';
+			continue;
+		}
+		mlen += (size_t)sprintf(moves + mlen, " %s", mv);
+	}
+	conn_send(&c, "quit\n");
+done:
+	close(c.fd);
+	free(moves);
+	free(cmd);
+	return NULL;
+}
+
+static int cmp_double(const void *a, const void *b) {
+	double x = *(const double *)a, y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+static double percentile(int p) {
+	int i = (n_latencies * p + 99) / 100 - 1;
+	if (i < 0) i = 0;
+	return latencies[i];
+}
+
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <socket> [clients] [moves] [movetime]\n",
+		        argv[0]);
+		return 1;
+	}
+	socket_path = argv[1];
+	int clients = argc > 2 ? atoi(argv[2]) : 8;
+	n_moves = argc > 3 ? atoi(argv[3]) : 20;
+	movetime = argc > 4 ? atoi(argv[4]) : 50;
+	if (clients < 1 || n_moves < 1 || movetime < 1) {
+		fprintf(stderr, "clients, moves and movetime must be positive\n");
+		return 1;
+	}
+
+	latencies = malloc(sizeof(double) * (size_t)clients * (size_t)n_moves);
+	pthread_t *tids = malloc(sizeof(pthread_t) * (size_t)clients);
+	double start = now_ms();
+	for (int i = 0; i < clients; i++)
+		pthread_create(&tids[i], NULL, client, NULL);
+	for (int i = 0; i < clients; i++)
+		pthread_join(tids[i], NULL);
+	double wall = now_ms() - start;
+
+	if (n_latencies == 0) {
+		fprintf(stderr, "no searches completed\n");
+		return 1;
+	}
+	qsort(latencies, (size_t)n_latencies, sizeof(double), cmp_double);
+	double sum = 0;
+	for (int i = 0; i < n_latencies; i++) sum += latencies[i];
+
+	printf("clients %d  moves %d  movetime %d ms\n", clients, n_latencies, movetime);
+	printf("latency ms: mean %.1f  p50 %.1f  p90 %.1f  p99 %.1f  max %.1f\n",
+	       sum / n_latencies, percentile(50), percentile(90), percentile(99),
+	       latencies[n_latencies - 1]);
+	printf("wall %.2f s  throughput %.1f moves/s\n",
+	       wall / 1000, n_latencies * 1000.0 / wall);
+	free(tids);
+	free(latencies);
+	return 0;
+}
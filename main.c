@@ -4,9 +4,18 @@
 #include "movegen.h"
 #include "move.h"
 #include "engine.h"
+#include "stats.h"
+#include "profile.h"
 #include "uci.h"
+#include "bench.h"
+#include "server.h"
+#include "analyze.h"
+#include "testsuite.h"
+#include "gensfen.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 
 static void print_help(void) {
@@ -16,6 +25,7 @@ static void print_help(void) {
 	       "  eval     Evaluate position\n"
 	       "  top      Show top 5 engine moves\n"
 	       "  go       Engine plays best move\n"
+	       "  stats    Statistics of the last search (stats json: as JSON)\n"
 	       "  uci      Enter UCI mode\n"
 	       "  check    Show if in check\n"
 	       "  board    Redraw board\n"
@@ -27,27 +37,105 @@ static void print_help(void) {
 static void print_legal_moves(const Position *p) {
 	MoveList list;
 	generate_legal_moves(p, &list);
+	char san[MAX_MOVES][SAN_MAX];
+	moves_to_san(p, &list, san);
 	printf("Legal moves (%d):\n", list.count);
 	for (int i = 0; i < list.count; i++) {
-		char buf[12];
-		move_to_san(&list.moves[i], p, buf);
-		printf("  %-8s", buf);
+		printf("  %-8s", san[i]);
 		if ((i + 1) % 8 == 0) printf("\n");
 	}
 	if (list.count % 8 != 0) printf("\n");
 	printf("\n");
 }
 
+/* Value of "--name <value>" among argv[from..], or NULL */
+static const char *option_value(int argc, char **argv, int from,
+                                const char *name) {
+	for (int j = from; j + 1 < argc; j++)
+		if (strcmp(argv[j], name) == 0)
+			return argv[j + 1];
+	return NULL;
+}
+
+static int option_int(int argc, char **argv, int from, const char *name) {
+	const char *v = option_value(argc, argv, from, name);
+	return v ? atoi(v) : 0;
+}
+
 int main(int argc, char **argv) {
-	init_attacks();
-	init_zobrist();
-	engine_init();
+	/* "--trace <file>" goes with any mode: every search is recorded */
+	const char *trace_path = option_value(argc, argv, 1, "--trace");
+	if (trace_path && !TRACE_ENABLED) {
+		fprintf(stderr, "--trace needs a -DGCE_TRACE build\n");
+		return 1;
+	}
+	if (trace_path && !trace_open(trace_path)) {
+		fprintf(stderr, "cannot create %s\n", trace_path);
+		return 1;
+	}
 
-	for (int i = 1; i < argc; i++)
+	for (int i = 1; i < argc; i++) {
 		if (strcmp(argv[i], "--uci") == 0 || strcmp(argv[i], "uci") == 0) {
 			uci_loop();
 			return 0;
 		}
+		if (strcmp(argv[i], "--bench") == 0 || strcmp(argv[i], "bench") == 0) {
+			bench(i + 1 < argc ? atoi(argv[i + 1]) : BENCH_DEPTH);
+			return 0;
+		}
+		if (strcmp(argv[i], "--startup") == 0)
+			return bench_startup(i + 1 < argc ? atoi(argv[i + 1]) : BENCH_STARTUP_RUNS);
+		if (strcmp(argv[i], "--microbench") == 0) {
+			bench_micro(i + 1 < argc ? atoi(argv[i + 1]) : BENCH_MICRO_ITERS);
+			return 0;
+		}
+		if (strcmp(argv[i], "--server") == 0 && i + 1 < argc) {
+			return server_run(argv[i + 1],
+			                  option_int(argc, argv, i + 2, "--threads"));
+		}
+		if (strcmp(argv[i], "--analyze") == 0 && i + 1 < argc) {
+			AnalyzeLimits lim;
+			lim.threads  = option_int(argc, argv, i + 2, "--threads");
+			lim.depth    = option_int(argc, argv, i + 2, "--depth");
+			lim.movetime = option_int(argc, argv, i + 2, "--movetime");
+			const char *nodes = option_value(argc, argv, i + 2, "--nodes");
+			lim.nodes = nodes ? strtoull(nodes, NULL, 10) : 0;
+			if (!lim.depth && !lim.movetime && !lim.nodes)
+				lim.depth = DEFAULT_DEPTH;
+			return analyze_epd(argv[i + 1], &lim);
+		}
+		if (strcmp(argv[i], "--gensfen") == 0 && i + 1 < argc) {
+			GensfenConfig gc;
+			const char *count = option_value(argc, argv, i + 2, "--count");
+			const char *nodes = option_value(argc, argv, i + 2, "--nodes");
+			const char *seed = option_value(argc, argv, i + 2, "--seed");
+			const char *rp = option_value(argc, argv, i + 2, "--random-plies");
+			gc.count = count ? strtoull(count, NULL, 10) : 100000;
+			gc.nodes = nodes ? strtoull(nodes, NULL, 10) : 0;
+			gc.seed = seed ? strtoull(seed, NULL, 10) : (uint64_t)time(NULL);
+			gc.random_plies = rp ? atoi(rp) : 8;
+			gc.threads = option_int(argc, argv, i + 2, "--threads");
+			gc.depth = option_int(argc, argv, i + 2, "--depth");
+			if (!gc.depth && !gc.nodes) gc.depth = 6;
+			return gensfen_run(argv[i + 1], &gc);
+		}
+		if (strcmp(argv[i], "--sfen-to-epd") == 0 && i + 1 < argc)
+			return gensfen_to_epd(argv[i + 1]);
+		if (strcmp(argv[i], "--testsuite") == 0 && i + 1 < argc) {
+			int mt = option_int(argc, argv, i + 2, "--movetime");
+			return testsuite_run(argv[i + 1], mt > 0 ? mt : TESTSUITE_MOVETIME);
+		}
+		if (strcmp(argv[i], "--perft") == 0) {
+			Position p;
+			init_position(&p);
+			if (i + 2 < argc && !position_from_fen(&p, argv[i + 2])) {
+				printf("Invalid FEN\n");
+				return 1;
+			}
+			perft_divide(&p, i + 1 < argc ? atoi(argv[i + 1]) : 1);
+			return 0;
+		}
+	}
 
 	int interactive = isatty(STDIN_FILENO);
 	Position pos;
@@ -104,6 +192,18 @@ int main(int argc, char **argv) {
 				score / 100.0);
 			continue;
 		}
+		if (strcmp(input, "stats") == 0 || strcmp(input, "stats json") == 0) {
+			if (!STATS_ENABLED) {
+				printf("Search statistics need a -DGCE_STATS build.\n\n");
+			} else if (input[5]) {
+				char json[STATS_BUF_SIZE];
+				stats_json(engine_last_stats(), engine_nodes(), json);
+				printf("%s\n\n", json);
+			} else {
+				stats_print(engine_last_stats(), engine_nodes());
+			}
+			continue;
+		}
 		if (strcmp(input, "top") == 0) {
 			if (state != GAME_ONGOING) {
 				printf("Game is over. Type 'reset' to play again.\n");
@@ -142,7 +242,10 @@ int main(int argc, char **argv) {
 				continue;
 			}
 			Move best;
+			profile_reset();
 			int score = engine_search(&pos, DEFAULT_DEPTH, &best);
+			if (PROF_ENABLED) profile_report("");
+			if (best.from == best.to) continue;   /* no hash table */
 			Position before = pos;
 			make_move(&pos, &best);
 			char san[12];
@@ -0,0 +1,725 @@
+#define _GNU_SOURCE   /* pipe2 */
+#include "board.h"
+#include "attack.h"
+#include "movegen.h"
+#include "move.h"
+#include "epd.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <math.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+/*
+ * Self-play match runner for A/B testing two engine builds. Each worker
+ * thread owns one process of each engine and plays games over UCI pipes
+ * with its own clocks; the referee (legality, mate, draws) is the engine's
+ * move generator. Every opening is played twice with colours reversed.
+ * Results feed an Elo estimate and an SPRT; finished games are handed to
+ * a writer thread that appends them to the PGN file.
+ */
+
+#define MAX_GAME_PLIES 600
+#define MAX_OPENINGS   100000
+
+typedef struct {
+	const char *path;
+	pid_t       pid;
+	int         to_fd, from_fd;
+	char        buf[16384];
+	size_t      len;
+} UciEngine;
+
+typedef struct {
+	int64_t base_ms, inc_ms, margin_ms;
+	int     resign_cp, resign_moves;
+	int     draw_cp, draw_plies, draw_min_ply;
+	double  elo0, elo1, alpha, beta;
+	bool    sprt;
+	int     games, concurrency;
+} MatchConfig;
+
+typedef struct {
+	Position start;
+	char     fen[128];
+	Move     moves[MAX_GAME_PLIES];
+	int      n_moves;
+	int      result;          /* white's view: 1, 0, -1 */
+	char     reason[64];
+} GameRecord;
+
+/* PGN writer: a queue of finished games drained by its own thread */
+typedef struct PgnItem {
+	char           *text;
+	struct PgnItem *next;
+} PgnItem;
+
+static struct {
+	FILE           *file;
+	pthread_t       thread;
+	pthread_mutex_t lock;
+	pthread_cond_t  ready;
+	PgnItem        *head, *tail;
+	bool            closing;
+} pgn = { NULL, 0, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER,
+          NULL, NULL, false };
+
+static MatchConfig cfg;
+static char  **openings;
+static int     n_openings;
+static const char *engine_paths[2];
+
+static pthread_mutex_t match_lock = PTHREAD_MUTEX_INITIALIZER;
+static int  next_game, finished;
+static int  wins, losses, draws;     /* engine A's view */
+static bool match_stop;
+
+static int64_t now_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/* --- Engine processes --- */
+
+static bool engine_send(UciEngine *e, const char *fmt, ...) {
+	char line[8192];
+	va_list ap;
+	va_start(ap, fmt);
+	int n = vsnprintf(line, sizeof(line) - 1, fmt, ap);
+	va_end(ap);
+	if (n < 0 || n >= (int)sizeof(line) - 1) return false;
+	line[n++] = '\n';
+	for (int off = 0; off < n; ) {
+		ssize_t w = write(e->to_fd, line + off, (size_t)(n - off));
+		if (w < 0 && errno == EINTR) continue;
+		if (w <= 0) return false;
+		off += (int)w;
+	}
+	return true;
+}
+
+/* 1 with a line, 0 on timeout, -1 when the engine is gone */
+static int engine_readline(UciEngine *e, char *line, size_t size,
+                           int64_t deadline) {
+	for (;;) {
+		char *nl = memchr(e->buf, '\n', e->len);
+		if (nl) {
+			size_t n = (size_t)(nl - e->buf);
+			size_t copy = n < size - 1 ? n : size - 1;
+			memcpy(line, e->buf, copy);
+			line[copy] = '\0';
+			if (copy && line[copy - 1] == '\r') line[copy - 1] = '\0';
+			e->len -= n + 1;
+			memmove(e->buf, nl + 1, e->len);
+			return 1;
+		}
+		if (e->len == sizeof(e->buf)) e->len = 0;   /* overlong line */
+
+		int64_t wait = deadline - now_ms();
+		if (wait <= 0) return 0;
+		struct pollfd pfd = { e->from_fd, POLLIN, 0 };
+		int r = poll(&pfd, 1, wait > 60000 ? 60000 : (int)wait);
+		if (r < 0 && errno == EINTR) continue;
+		if (r < 0) return -1;
+		if (r == 0) continue;
+		ssize_t got = read(e->from_fd, e->buf + e->len, sizeof(e->buf) - e->len);
+		if (got < 0 && errno == EINTR) continue;
+		if (got <= 0) return -1;
+		e->len += (size_t)got;
+	}
+}
+
+static bool engine_wait(UciEngine *e, const char *token, int64_t timeout_ms) {
+	char line[8192];
+	int64_t deadline = now_ms() + timeout_ms;
+	size_t n = strlen(token);
+	while (engine_readline(e, line, sizeof(line), deadline) == 1)
+		if (strncmp(line, token, n) == 0) return true;
+	return false;
+}
+
+static void engine_stop(UciEngine *e) {
+	if (e->pid <= 0) return;
+	engine_send(e, "quit");
+	close(e->to_fd);
+	close(e->from_fd);
+	int64_t deadline = now_ms() + 1000;
+	while (waitpid(e->pid, NULL, WNOHANG) == 0) {
+		if (now_ms() > deadline) {
+			kill(e->pid, SIGKILL);
+			waitpid(e->pid, NULL, 0);
+			break;
+		}
+		struct timespec ts = { 0, 10000000 };
+		nanosleep(&ts, NULL);
+	}
+	e->pid = 0;
+}
+
+static bool engine_start(UciEngine *e, const char *path) {
+	int in[2], out[2];
+	memset(e, 0, sizeof(*e));
+	e->path = path;
+	/* Every end close-on-exec from the start: engines are restarted from
+	 * worker threads, and a child forked for one must not inherit
+	 * another's pipes, or that engine's EOF never arrives. dup2 clears
+	 * the flag on the child's stdin and stdout. */
+	if (pipe2(in, O_CLOEXEC) < 0) return false;
+	if (pipe2(out, O_CLOEXEC) < 0) {
+		close(in[0]);
+		close(in[1]);
+		return false;
+	}
+
+	pid_t pid = fork();
+	if (pid < 0) {
+		close(in[0]);
+		close(in[1]);
+		close(out[0]);
+		close(out[1]);
+		return false;
+	}
+	if (pid == 0) {
+		dup2(in[0], STDIN_FILENO);
+		dup2(out[1], STDOUT_FILENO);
+		int devnull = open("/dev/null", O_WRONLY);
+		if (devnull >= 0) dup2(devnull, STDERR_FILENO);
+		close(in[0]);
+		close(out[1]);
+		execl(path, path, "--uci", (char *)NULL);
+		_exit(127);
+	}
+	close(in[0]);
+	close(out[1]);
+	e->pid = pid;
+	e->to_fd = in[1];
+	e->from_fd = out[0];
+
+	if (!engine_send(e, "uci") || !engine_wait(e, "uciok", 10000)) {
+		engine_stop(e);
+		return false;
+	}
+	return true;
+}
+
+static bool engine_ready(UciEngine *e) {
+	return engine_send(e, "isready") && engine_wait(e, "readyok", 10000);
+}
+
+/* --- Playing a game --- */
+
+static int score_from_info(const char *line, int current) {
+	const char *s = strstr(line, " score ");
+	if (!s) return current;
+	s += 7;
+	if (strncmp(s, "cp ", 3) == 0) return atoi(s + 3);
+	if (strncmp(s, "mate ", 5) == 0) return atoi(s + 5) > 0 ? 30000 : -30000;
+	return current;
+}
+
+static bool is_repetition(const uint64_t *hashes, int ply, int halfmove) {
+	int count = 1;
+	for (int i = ply - 2; i >= 0 && i >= ply - halfmove; i -= 2)
+		if (hashes[i] == hashes[ply] && ++count >= 3) return true;
+	return false;
+}
+
+static void play_game(UciEngine *white, UciEngine *black, const char *fen,
+                      GameRecord *g) {
+	UciEngine *side[2] = { white, black };
+	int64_t clock[2] = { cfg.base_ms, cfg.base_ms };
+	int resign_count[2] = { 0, 0 }, last_score[2] = { 0, 0 };
+	int draw_count = 0;
+	uint64_t hashes[MAX_GAME_PLIES + 1];
+	char *moves_str = malloc(MAX_GAME_PLIES * 6 + 1);
+	size_t moves_len = 0;
+	Position pos;
+
+	position_from_fen(&g->start, fen);
+	snprintf(g->fen, sizeof(g->fen), "%s", fen);
+	pos = g->start;
+	g->n_moves = 0;
+	hashes[0] = pos.hash;
+	moves_str[0] = '\0';
+
+	for (int i = 0; i < 2; i++) {
+		if (!engine_send(side[i], "ucinewgame") || !engine_ready(side[i])) {
+			engine_stop(side[i]);
+			g->result = i == 0 ? -1 : 1;
+			snprintf(g->reason, sizeof(g->reason), "%s disconnects",
+			         i == 0 ? "White" : "Black");
+			free(moves_str);
+			return;
+		}
+	}
+
+	for (;;) {
+		GameState state = get_game_state(&pos);
+		int stm = pos.white_turn ? 0 : 1;
+		const char *colour = stm == 0 ? "White" : "Black";
+		if (state == GAME_CHECKMATE) {
+			g->result = stm == 0 ? -1 : 1;
+			snprintf(g->reason, sizeof(g->reason), "%s mates",
+			         stm == 0 ? "Black" : "White");
+			break;
+		}
+		if (state != GAME_ONGOING) {
+			g->result = 0;
+			snprintf(g->reason, sizeof(g->reason), "%s", game_state_str(state));
+			break;
+		}
+		if (g->n_moves > 0 && is_repetition(hashes, g->n_moves, pos.halfmove)) {
+			g->result = 0;
+			snprintf(g->reason, sizeof(g->reason), "Draw by 3-fold repetition");
+			break;
+		}
+		if (g->n_moves >= MAX_GAME_PLIES) {
+			g->result = 0;
+			snprintf(g->reason, sizeof(g->reason), "Draw by maximum game length");
+			break;
+		}
+
+		UciEngine *e = side[stm];
+		engine_send(e, "position fen %s%s%s", fen,
+		            moves_len ? " moves" : "", moves_str);
+		engine_send(e, "go wtime %lld btime %lld winc %lld binc %lld",
+		            (long long)clock[0], (long long)clock[1],
+		            (long long)cfg.inc_ms, (long long)cfg.inc_ms);
+
+		int64_t start = now_ms();
+		int64_t deadline = start + clock[stm] + cfg.margin_ms;
+		char line[8192], best[16] = "";
+		int score = last_score[stm], r;
+		while ((r = engine_readline(e, line, sizeof(line), deadline)) == 1) {
+			if (strncmp(line, "info ", 5) == 0) {
+				score = score_from_info(line, score);
+			} else if (strncmp(line, "bestmove ", 9) == 0) {
+				sscanf(line + 9, "%15s", best);
+				break;
+			}
+		}
+		int64_t elapsed = now_ms() - start;
+
+		if (r == -1) {
+			engine_stop(e);
+			g->result = stm == 0 ? -1 : 1;
+			snprintf(g->reason, sizeof(g->reason), "%s disconnects", colour);
+			break;
+		}
+		if (r == 0 || elapsed > clock[stm] + cfg.margin_ms) {
+			g->result = stm == 0 ? -1 : 1;
+			snprintf(g->reason, sizeof(g->reason), "%s loses on time", colour);
+			/* Collect the late bestmove so the next game starts clean;
+			 * an engine that does not answer is replaced */
+			engine_send(e, "stop");
+			if (!engine_wait(e, "bestmove", 1000)) engine_stop(e);
+			break;
+		}
+		clock[stm] += cfg.inc_ms - elapsed;
+
+		Move m;
+		if (!parse_move(best, &pos, &m)) {
+			g->result = stm == 0 ? -1 : 1;
+			snprintf(g->reason, sizeof(g->reason), "%s makes an illegal move: %s",
+			         colour, best);
+			break;
+		}
+		g->moves[g->n_moves++] = m;
+		make_move(&pos, &m);
+		hashes[g->n_moves] = pos.hash;
+		moves_len += (size_t)sprintf(moves_str + moves_len, " %s", best);
+
+		/* Adjudication on the engines' own scores */
+		last_score[stm] = score;
+		resign_count[stm] = score <= -cfg.resign_cp ? resign_count[stm] + 1 : 0;
+		if (cfg.resign_moves > 0 && resign_count[stm] >= cfg.resign_moves
+		    && last_score[stm ^ 1] >= cfg.resign_cp) {
+			g->result = stm == 0 ? -1 : 1;
+			snprintf(g->reason, sizeof(g->reason), "%s wins by adjudication",
+			         stm == 0 ? "Black" : "White");
+			break;
+		}
+		draw_count = abs(score) <= cfg.draw_cp ? draw_count + 1 : 0;
+		if (cfg.draw_plies > 0 && g->n_moves >= cfg.draw_min_ply
+		    && draw_count >= cfg.draw_plies) {
+			g->result = 0;
+			snprintf(g->reason, sizeof(g->reason), "Draw by adjudication");
+			break;
+		}
+	}
+	free(moves_str);
+}
+
+/* --- PGN --- */
+
+static char *game_pgn(const GameRecord *g, const char *white, const char *black,
+                      int round) {
+	size_t cap = 4096 + (size_t)g->n_moves * 16;
+	char *out = malloc(cap);
+	if (!out) return NULL;
+	const char *result = g->result > 0 ? "1-0" : g->result < 0 ? "0-1" : "1/2-1/2";
+
+	char date[16];
+	time_t t = time(NULL);
+	struct tm tm;
+	localtime_r(&t, &tm);
+	strftime(date, sizeof(date), "%Y.%m.%d", &tm);
+
+	size_t n = (size_t)sprintf(out,
+		"[Event \"gce-match\"]\n[Site \"local\"]\n[Date \"%s\"]\n"
+		"[Round \"%d\"]\n[White \"%s\"]\n[Black \"%s\"]\n[Result \"%s\"]\n"
+		"[FEN \"%s\"]\n[SetUp \"1\"]\n[TimeControl \"%.3g+%.3g\"]\n"
+		"[PlyCount \"%d\"]\n[Termination \"%s\"]\n\n",
+		date, round, white, black, result, g->fen,
+		cfg.base_ms / 1000.0, cfg.inc_ms / 1000.0, g->n_moves, g->reason);
+
+	Position p = g->start;
+	size_t line_start = n;
+	for (int i = 0; i <= g->n_moves; i++) {
+		char token[96], san[12];
+		int tn;
+		if (i == g->n_moves) {
+			tn = sprintf(token, "{%s} %s", g->reason, result);
+		} else {
+			move_to_san(&g->moves[i], &p, san);
+			if (p.white_turn)
+				tn = sprintf(token, "%d. %s", p.fullmove, san);
+			else if (i == 0)
+				tn = sprintf(token, "%d... %s", p.fullmove, san);
+			else
+				tn = sprintf(token, "%s", san);
+			make_move(&p, &g->moves[i]);
+		}
+		if (n > line_start && n - line_start + (size_t)tn + 1 > 79) {
+			out[n++] = '\n';
+			line_start = n;
+		} else if (n > line_start) {
+			out[n++] = ' ';
+		}
+		memcpy(out + n, token, (size_t)tn);
+		n += (size_t)tn;
+	}
+	memcpy(out + n, "\n\n", 3);
+	return out;
+}
+
+static void *pgn_writer(void *arg) {
+	(void)arg;
+	pthread_mutex_lock(&pgn.lock);
+	for (;;) {
+		while (!pgn.head && !pgn.closing)
+			pthread_cond_wait(&pgn.ready, &pgn.lock);
+		if (!pgn.head) break;
+		PgnItem *item = pgn.head;
+		pgn.head = item->next;
+		if (!pgn.head) pgn.tail = NULL;
+		pthread_mutex_unlock(&pgn.lock);
+
+		fputs(item->text, pgn.file);
+		fflush(pgn.file);
+		free(item->text);
+		free(item);
+
+		pthread_mutex_lock(&pgn.lock);
+	}
+	pthread_mutex_unlock(&pgn.lock);
+	return NULL;
+}
+
+static void pgn_push(char *text) {
+	PgnItem *item = malloc(sizeof(PgnItem));
+	if (!item) {
+		free(text);
+		return;
+	}
+	item->text = text;
+	item->next = NULL;
+	pthread_mutex_lock(&pgn.lock);
+	if (pgn.tail) pgn.tail->next = item;
+	else pgn.head = item;
+	pgn.tail = item;
+	pthread_cond_signal(&pgn.ready);
+	pthread_mutex_unlock(&pgn.lock);
+}
+
+/* --- Statistics --- */
+
+static double elo_from_score(double s) {
+	if (s <= 0) return -INFINITY;
+	if (s >= 1) return INFINITY;
+	return -400.0 * log10(1.0 / s - 1.0);
+}
+
+static double score_from_elo(double elo) {
+	return 1.0 / (1.0 + pow(10.0, -elo / 400.0));
+}
+
+/* Normal approximation of the trinomial GSPRT log-likelihood ratio */
+static double sprt_llr(int w, int l, int d) {
+	int n = w + l + d;
+	if (n == 0) return 0;
+	double s = (w + d / 2.0) / n;
+	double var = (w + d / 4.0) / n - s * s;
+	if (var <= 0) return 0;
+	double s0 = score_from_elo(cfg.elo0), s1 = score_from_elo(cfg.elo1);
+	return (s1 - s0) * (2 * s - s0 - s1) / (2 * var / n);
+}
+
+static void print_stats(FILE *out) {
+	int n = wins + losses + draws;
+	if (n == 0) return;
+	double s = (wins + draws / 2.0) / n;
+	double var = (wins + draws / 4.0) / n - s * s;
+	double dev = var > 0 ? sqrt(var / n) : 0;
+	double elo = elo_from_score(s);
+	double margin = (elo_from_score(s + 1.959964 * dev) -
+	                 elo_from_score(s - 1.959964 * dev)) / 2;
+	double los = wins + losses > 0
+	    ? 0.5 * (1 + erf((wins - losses) / sqrt(2.0 * (wins + losses)))) : 0.5;
+
+	fprintf(out, "Score of %s vs %s: %d - %d - %d  [%.3f] %d\n",
+	        engine_paths[0], engine_paths[1], wins, losses, draws, s, n);
+	/* All wins or all losses leave the interval unbounded */
+	char margin_str[24] = "inf";
+	if (isfinite(margin)) snprintf(margin_str, sizeof(margin_str), "%.1f", margin);
+	fprintf(out, "Elo difference: %.1f +/- %s, LOS: %.1f %%, DrawRatio: %.1f %%\n",
+	        elo, margin_str, los * 100, draws * 100.0 / n);
+	if (cfg.sprt) {
+		double lo = log(cfg.beta / (1 - cfg.alpha));
+		double hi = log((1 - cfg.beta) / cfg.alpha);
+		double llr = sprt_llr(wins, losses, draws);
+		fprintf(out, "SPRT: llr %.2f (%.1f%%), lbound %.2f, ubound %.2f%s\n",
+		        llr, llr / hi * 100, lo, hi,
+		        llr >= hi ? " - H1 was accepted" :
+		        llr <= lo ? " - H0 was accepted" : "");
+	}
+}
+
+/* --- Workers --- */
+
+static void *match_worker(void *arg) {
+	UciEngine *pair = arg;
+	GameRecord *g = malloc(sizeof(GameRecord));
+	if (!g) return NULL;
+
+	for (;;) {
+		pthread_mutex_lock(&match_lock);
+		int idx = (match_stop || next_game >= cfg.games) ? -1 : next_game++;
+		pthread_mutex_unlock(&match_lock);
+		if (idx < 0) break;
+
+		/* Same opening twice, A with white in even games */
+		const char *fen = openings[(idx / 2) % n_openings];
+		int a_white = (idx % 2) == 0;
+		/* A crashed or hung engine was stopped; replace it */
+		for (int i = 0; i < 2; i++)
+			if (pair[i].pid <= 0 && !engine_start(&pair[i], engine_paths[i]))
+				fprintf(stderr, "cannot restart %s\n", engine_paths[i]);
+		UciEngine *white = a_white ? &pair[0] : &pair[1];
+		UciEngine *black = a_white ? &pair[1] : &pair[0];
+		play_game(white, black, fen, g);
+
+		int a_result = a_white ? g->result : -g->result;
+		char *text = pgn.file ? game_pgn(g, engine_paths[a_white ? 0 : 1],
+		                                 engine_paths[a_white ? 1 : 0], idx + 1)
+		                      : NULL;
+		if (text) pgn_push(text);
+
+		pthread_mutex_lock(&match_lock);
+		if (a_result > 0) wins++;
+		else if (a_result < 0) losses++;
+		else draws++;
+		finished++;
+		printf("Finished game %d (%s vs %s): %s {%s}\n", idx + 1,
+		       a_white ? engine_paths[0] : engine_paths[1],
+		       a_white ? engine_paths[1] : engine_paths[0],
+		       g->result > 0 ? "1-0" : g->result < 0 ? "0-1" : "1/2-1/2",
+		       g->reason);
+		print_stats(stdout);
+		if (cfg.sprt) {
+			double llr = sprt_llr(wins, losses, draws);
+			if (llr >= log((1 - cfg.beta) / cfg.alpha) ||
+			    llr <= log(cfg.beta / (1 - cfg.alpha)))
+				match_stop = true;
+		}
+		fflush(stdout);
+		pthread_mutex_unlock(&match_lock);
+	}
+	free(g);
+	return NULL;
+}
+
+static int load_openings(const char *path) {
+	EpdFile f;
+	if (!epd_open(&f, path)) return -1;
+	openings = malloc(sizeof(char *) * MAX_OPENINGS);
+	size_t offset = 0, len;
+	const char *line;
+	while (n_openings < MAX_OPENINGS && epd_next_line(&f, &offset, &line, &len)) {
+		Position p;
+		char fen[128];
+		const char *ops;
+		size_t ops_len;
+		if (epd_parse(line, len, &p, fen, sizeof(fen), &ops, &ops_len))
+			openings[n_openings++] = strdup(fen);
+	}
+	epd_close(&f);
+	return n_openings;
+}
+
+static void usage(const char *prog) {
+	fprintf(stderr,
+		"usage: %s <engineA> <engineB> [options]\n"
+		"  --games N             games to play (default 100)\n"
+		"  --concurrency N       games in parallel (default: CPUs)\n"
+		"  --tc base+inc         seconds, e.g. 10+0.1 (default)\n"
+		"  --margin ms           clock overrun allowance (default 50)\n"
+		"  --openings file.epd   start positions, each played twice\n"
+		"  --pgn file.pgn        append finished games\n"
+		"  --sprt elo0 elo1 [alpha beta]  stop when the SPRT concludes\n"
+		"  --resign cp moves     adjudicate a loss (default 1000 3, 0 moves = off)\n"
+		"  --draw cp plies after_ply  adjudicate a draw (default 10 8 80)\n",
+		prog);
+}
+
+int main(int argc, char **argv) {
+	if (argc < 3) {
+		usage(argv[0]);
+		return 1;
+	}
+	engine_paths[0] = argv[1];
+	engine_paths[1] = argv[2];
+
+	cfg.games = 100;
+	cfg.base_ms = 10000;
+	cfg.inc_ms = 100;
+	cfg.margin_ms = 50;
+	cfg.resign_cp = 1000;
+	cfg.resign_moves = 3;
+	cfg.draw_cp = 10;
+	cfg.draw_plies = 8;
+	cfg.draw_min_ply = 80;
+	cfg.alpha = cfg.beta = 0.05;
+	const char *openings_path = NULL, *pgn_path = NULL;
+
+	for (int i = 3; i < argc; i++) {
+		const char *a = argv[i];
+		bool has1 = i + 1 < argc, has2 = i + 2 < argc;
+		if (strcmp(a, "--games") == 0 && has1) {
+			cfg.games = atoi(argv[++i]);
+		} else if (strcmp(a, "--concurrency") == 0 && has1) {
+			cfg.concurrency = atoi(argv[++i]);
+		} else if (strcmp(a, "--tc") == 0 && has1) {
+			char *end;
+			double base = strtod(argv[++i], &end);
+			double inc = *end == '+' ? strtod(end + 1, NULL) : 0;
+			cfg.base_ms = (int64_t)(base * 1000);
+			cfg.inc_ms = (int64_t)(inc * 1000);
+		} else if (strcmp(a, "--margin") == 0 && has1) {
+			cfg.margin_ms = atoi(argv[++i]);
+		} else if (strcmp(a, "--openings") == 0 && has1) {
+			openings_path = argv[++i];
+		} else if (strcmp(a, "--pgn") == 0 && has1) {
+			pgn_path = argv[++i];
+		} else if (strcmp(a, "--sprt") == 0 && has2) {
+			cfg.sprt = true;
+			cfg.elo0 = atof(argv[++i]);
+			cfg.elo1 = atof(argv[++i]);
+			if (i + 2 < argc && argv[i + 1][0] != '-') {
+				cfg.alpha = atof(argv[++i]);
+				cfg.beta = atof(argv[++i]);
+			}
+		} else if (strcmp(a, "--resign") == 0 && has2) {
+			cfg.resign_cp = atoi(argv[++i]);
+			cfg.resign_moves = atoi(argv[++i]);
+		} else if (strcmp(a, "--draw") == 0 && i + 3 < argc) {
+			cfg.draw_cp = atoi(argv[++i]);
+			cfg.draw_plies = atoi(argv[++i]);
+			cfg.draw_min_ply = atoi(argv[++i]);
+		} else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+	if (cfg.games < 1 || cfg.base_ms <= 0) {
+		fprintf(stderr, "need at least one game and a positive base time\n");
+		return 1;
+	}
+
+	signal(SIGPIPE, SIG_IGN);
+
+	if (openings_path) {
+		if (load_openings(openings_path) <= 0) {
+			fprintf(stderr, "no usable openings in %s\n", openings_path);
+			return 1;
+		}
+	} else {
+		static char *startpos[] = {
+			"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+		};
+		openings = startpos;
+		n_openings = 1;
+	}
+
+	if (pgn_path) {
+		pgn.file = fopen(pgn_path, "a");
+		if (!pgn.file) {
+			fprintf(stderr, "cannot open %s\n", pgn_path);
+			return 1;
+		}
+		pthread_create(&pgn.thread, NULL, pgn_writer, NULL);
+	}
+
+	int workers = cfg.concurrency > 0 ? cfg.concurrency
+	                                  : (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if (workers < 1) workers = 1;
+	if (workers > cfg.games) workers = cfg.games;
+
+	/* Engines are spawned here, before any worker runs, so no thread can
+	 * fork while another holds half-made pipes */
+	UciEngine *pairs = calloc((size_t)workers * 2, sizeof(UciEngine));
+	pthread_t *tids = malloc(sizeof(pthread_t) * (size_t)workers);
+	for (int w = 0; w < workers; w++)
+		for (int i = 0; i < 2; i++)
+			if (!engine_start(&pairs[w * 2 + i], engine_paths[i])) {
+				fprintf(stderr, "cannot start %s\n", engine_paths[i]);
+				return 1;
+			}
+
+	printf("Match %s vs %s: %d games, tc %.3g+%.3g, %d openings, %d workers\n",
+	       engine_paths[0], engine_paths[1], cfg.games, cfg.base_ms / 1000.0,
+	       cfg.inc_ms / 1000.0, n_openings, workers);
+	fflush(stdout);
+
+	for (int w = 0; w < workers; w++)
+		pthread_create(&tids[w], NULL, match_worker, &pairs[w * 2]);
+	for (int w = 0; w < workers; w++)
+		pthread_join(tids[w], NULL);
+	for (int w = 0; w < workers * 2; w++)
+		engine_stop(&pairs[w]);
+
+	if (pgn.file) {
+		pthread_mutex_lock(&pgn.lock);
+		pgn.closing = true;
+		pthread_cond_signal(&pgn.ready);
+		pthread_mutex_unlock(&pgn.lock);
+		pthread_join(pgn.thread, NULL);
+		fclose(pgn.file);
+	}
+
+	printf("\nFinished match: %d games\n", finished);
+	print_stats(stdout);
+	free(pairs);
+	free(tids);
+	return 0;
+}
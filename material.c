@@ -0,0 +1,190 @@
+#include "material.h"
+#include "engine.h"
+#include "bitbase.h"
+#include "evalparams.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MATERIAL_SIZE (1 << 13)
+#define MATERIAL_MASK (MATERIAL_SIZE - 1)
+
+/* One table per thread: entries are several words wide and are rebuilt
+ * on a miss, so sharing them would need locking. */
+static __thread MaterialEntry material_table[MATERIAL_SIZE];
+
+static const int phase_weight[NUM_PIECE_TYPES] = { 0, 1, 1, 2, 4, 0 };
+
+void material_clear(void) {
+	memset(material_table, 0, sizeof(material_table));
+}
+
+static int sq_distance(int a, int b) {
+	int df = abs(SQ_FILE(a) - SQ_FILE(b));
+	int dr = abs(SQ_RANK(a) - SQ_RANK(b));
+	return df > dr ? df : dr;
+}
+
+/* Bonus for driving a king towards the edge of the board */
+static int push_to_edge(int sq) {
+	int f = SQ_FILE(sq), r = SQ_RANK(sq);
+	int fd = f < 4 ? 3 - f : f - 4;
+	int rd = r < 4 ? 3 - r : r - 4;
+	return 15 * (fd + rd);
+}
+
+/* Bonus for keeping the attacking king close to the defending one */
+static int push_close(int a, int b) {
+	return 140 - 20 * sq_distance(a, b);
+}
+
+static int non_pawn_material(const Position *p, Color c) {
+	return VAL_KNIGHT * __builtin_popcountll(p->pieces[c][KNIGHT])
+	     + VAL_BISHOP * __builtin_popcountll(p->pieces[c][BISHOP])
+	     + VAL_ROOK   * __builtin_popcountll(p->pieces[c][ROOK])
+	     + VAL_QUEEN  * __builtin_popcountll(p->pieces[c][QUEEN]);
+}
+
+#define DARK_SQUARES 0xAA55AA55AA55AA55ULL
+
+/* Bishops alone, all on one colour, cannot mate */
+static bool kxk_drawn(const Position *p, Color strong) {
+	Bitboard bishops = p->pieces[strong][BISHOP];
+	return !p->pieces[strong][PAWN] && !p->pieces[strong][KNIGHT]
+	    && !p->pieces[strong][ROOK] && !p->pieces[strong][QUEEN]
+	    && (!(bishops & DARK_SQUARES) || !(bishops & ~DARK_SQUARES));
+}
+
+/* Mating material against a bare king */
+static int eg_kxk(const Position *p, Color strong) {
+	if (kxk_drawn(p, strong)) return 0;
+	Color weak = (Color)(strong ^ 1);
+	int sk = __builtin_ctzll(p->pieces[strong][KING]);
+	int wk = __builtin_ctzll(p->pieces[weak][KING]);
+	Bitboard bishops = p->pieces[strong][BISHOP];
+	int score = non_pawn_material(p, strong)
+	          + VAL_PAWN * __builtin_popcountll(p->pieces[strong][PAWN])
+	          + push_to_edge(wk) + push_close(sk, wk);
+	if (p->pieces[strong][QUEEN] || p->pieces[strong][ROOK]
+	    || (bishops && p->pieces[strong][KNIGHT])
+	    || ((bishops & DARK_SQUARES) && (bishops & ~DARK_SQUARES)))
+		score += SCORE_KNOWN_WIN;
+	return strong == WHITE ? score : -score;
+}
+
+/* Bishop and knight: drive the king to a corner of the bishop's colour */
+static int eg_kbnk(const Position *p, Color strong) {
+	Color weak = (Color)(strong ^ 1);
+	int sk = __builtin_ctzll(p->pieces[strong][KING]);
+	int wk = __builtin_ctzll(p->pieces[weak][KING]);
+	bool dark = (p->pieces[strong][BISHOP] & DARK_SQUARES) != 0;
+	int c1 = dark ? SQ_A1 : SQ_A8, c2 = dark ? SQ_H8 : SQ_H1;
+	int corner = sq_distance(wk, c1) < sq_distance(wk, c2)
+	           ? sq_distance(wk, c1) : sq_distance(wk, c2);
+	int score = SCORE_KNOWN_WIN + VAL_KNIGHT + VAL_BISHOP
+	          + push_close(sk, wk) + 30 * (7 - corner);
+	return strong == WHITE ? score : -score;
+}
+
+static bool kpk_won(const Position *p, Color strong) {
+	Color weak = (Color)(strong ^ 1);
+	return kpk_probe(strong,
+		__builtin_ctzll(p->pieces[strong][KING]),
+		__builtin_ctzll(p->pieces[strong][PAWN]),
+		__builtin_ctzll(p->pieces[weak][KING]),
+		p->white_turn ? WHITE : BLACK);
+}
+
+/* King and pawn against king, exact via the bitbase */
+static int eg_kpk(const Position *p, Color strong) {
+	if (!kpk_won(p, strong)) return 0;
+	int psq = __builtin_ctzll(p->pieces[strong][PAWN]);
+	int rank = (strong == WHITE) ? SQ_RANK(psq) : 7 - SQ_RANK(psq);
+	int score = SCORE_KNOWN_WIN + VAL_PAWN + 20 * rank;
+	return strong == WHITE ? score : -score;
+}
+
+static void material_compute(MaterialEntry *e, const Position *p) {
+	int cnt[2][NUM_PIECE_TYPES];
+	for (int c = 0; c < 2; c++)
+		for (int pt = 0; pt < NUM_PIECE_TYPES; pt++)
+			cnt[c][pt] = __builtin_popcountll(p->pieces[c][pt]);
+
+	e->key = p->material_key;
+	e->eval_fn = NULL;
+	e->strong = WHITE;
+	e->scale[WHITE] = e->scale[BLACK] = SCALE_NORMAL;
+
+	int phase = 0, value = 0;
+	for (int c = 0; c < 2; c++) {
+		int v = 0;
+		for (int pt = PAWN; pt <= QUEEN; pt++) {
+			v += piece_value[pt] * cnt[c][pt];
+			phase += phase_weight[pt] * cnt[c][pt];
+		}
+		if (cnt[c][BISHOP] >= 2) v += BISHOP_PAIR;
+		/* Knights gain and rooks lose value as own pawns accumulate */
+		v += cnt[c][KNIGHT] * (cnt[c][PAWN] - 5) * KNIGHT_PAWN_ADJ;
+		v += cnt[c][ROOK] * (cnt[c][PAWN] - 5) * ROOK_PAWN_ADJ;
+		value += (c == WHITE) ? v : -v;
+	}
+	e->value = value;
+	e->phase = phase > PHASE_MAX ? PHASE_MAX : phase;
+
+	int npm[2] = { non_pawn_material(p, WHITE), non_pawn_material(p, BLACK) };
+	for (int c = 0; c < 2; c++) {
+		int o = c ^ 1;
+		bool weak_bare = npm[o] == 0 && cnt[o][PAWN] == 0;
+
+		/* Two knights cannot force mate; the scale below draws it */
+		bool knn = cnt[c][PAWN] == 0 && cnt[c][KNIGHT] == 2
+		        && npm[c] == 2 * VAL_KNIGHT;
+		if (weak_bare && npm[c] >= VAL_ROOK && !knn) {
+			e->strong = (Color)c;
+			e->eval_fn = (cnt[c][PAWN] == 0 && npm[c] == VAL_KNIGHT + VAL_BISHOP
+			              && cnt[c][KNIGHT] == 1)
+			           ? eg_kbnk : eg_kxk;
+		}
+		if (weak_bare && npm[c] == 0 && cnt[c][PAWN] == 1) {
+			e->strong = (Color)c;
+			e->eval_fn = eg_kpk;
+		}
+
+		/* Without pawns a minor-piece edge does not win */
+		if (cnt[c][PAWN] == 0 && npm[c] - npm[o] <= VAL_BISHOP)
+			e->scale[c] = npm[c] < VAL_ROOK ? SCALE_DRAW
+			            : npm[o] <= VAL_BISHOP ? 4 : 14;
+		if (knn && npm[o] == 0)
+			e->scale[c] = SCALE_DRAW;
+	}
+
+	e->ocb_candidate = cnt[WHITE][BISHOP] == 1 && cnt[BLACK][BISHOP] == 1
+	                && npm[WHITE] == VAL_BISHOP && npm[BLACK] == VAL_BISHOP;
+
+	/* At most one minor, or bishops only; material_is_draw checks colours */
+	int knights = cnt[WHITE][KNIGHT] + cnt[BLACK][KNIGHT];
+	int minors = knights + cnt[WHITE][BISHOP] + cnt[BLACK][BISHOP];
+	e->dead_candidate = cnt[WHITE][PAWN] + cnt[BLACK][PAWN] == 0
+	                 && cnt[WHITE][ROOK] + cnt[BLACK][ROOK] == 0
+	                 && cnt[WHITE][QUEEN] + cnt[BLACK][QUEEN] == 0
+	                 && (minors <= 1 || knights == 0);
+}
+
+MaterialEntry *material_probe(const Position *p) {
+	MaterialEntry *e = &material_table[p->material_key & MATERIAL_MASK];
+	if (e->key != p->material_key || e->key == 0)
+		material_compute(e, p);
+	return e;
+}
+
+/* Only positions where no sequence of moves mates: the search may cut
+ * them off before looking for checkmate. Scale factors stay in eval. */
+bool material_is_draw(const Position *p, const MaterialEntry *me) {
+	if (me->eval_fn == eg_kpk)
+		return !kpk_won(p, me->strong);
+	if (!me->dead_candidate)
+		return false;
+	Bitboard bishops = p->pieces[WHITE][BISHOP] | p->pieces[BLACK][BISHOP];
+	return __builtin_popcountll(bishops | p->pieces[WHITE][KNIGHT]
+	                            | p->pieces[BLACK][KNIGHT]) <= 1
+	    || !(bishops & DARK_SQUARES) || !(bishops & ~DARK_SQUARES);
+}
@@ -0,0 +1,29 @@
+#ifndef MATERIAL_H
+#define MATERIAL_H
+
+#include "board.h"
+
+#define SCALE_NORMAL    64
+#define SCALE_DRAW      0
+#define PHASE_MAX       24
+#define SCORE_KNOWN_WIN 10000
+
+/* Specialised endgame evaluator; returns a score from white's view */
+typedef int (*EndgameFn)(const Position *p, Color strong);
+
+typedef struct {
+	uint64_t  key;
+	int       value;        /* material plus imbalance, white's view */
+	int       phase;        /* PHASE_MAX with all pieces, 0 with none */
+	uint8_t   scale[2];     /* applied when that colour is ahead */
+	bool      ocb_candidate;/* lone bishops each: check square colours */
+	bool      dead_candidate;/* minors only: may be unable to mate */
+	Color     strong;
+	EndgameFn eval_fn;
+} MaterialEntry;
+
+MaterialEntry *material_probe(const Position *p);
+bool           material_is_draw(const Position *p, const MaterialEntry *me);
+void           material_clear(void);
+
+#endif
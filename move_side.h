@@ -0,0 +1,118 @@
+/* make_move for one side; see side.h */
+#include "side.h"
+
+static void SIDED(make_move)(Position *p, const Move *m) {
+	int from = m->from, to = m->to;
+	Bitboard from_bb = 1ULL << from, to_bb = 1ULL << to;
+
+	PieceType moved = PIECE_NONE;
+	for (int pt = 0; pt < NUM_PIECE_TYPES; pt++)
+		if (p->pieces[US][pt] & from_bb) { moved = (PieceType)pt; break; }
+	if (moved == PIECE_NONE) return;
+
+	uint64_t h = p->hash;
+	uint64_t mk = p->material_key;
+	NnueDelta nd = { {0, 0}, {0, 0}, 0, 0 };
+	h ^= zobrist_castling_key(p->castling);
+	if (p->en_passant >= 0)
+		h ^= zobrist_ep_key(p->en_passant & 7);
+
+	/* Captures */
+	if (m->flags == MOVE_CAPTURE || m->flags >= MOVE_PROMO_CAP_N) {
+		for (int pt = 0; pt < NUM_PIECE_TYPES; pt++)
+			if (p->pieces[THEM][pt] & to_bb) {
+				p->pieces[THEM][pt] &= ~to_bb;
+				h ^= zobrist_piece_key(THEM, pt, to);
+				nnue_sub(&nd, THEM, pt, to);
+				mk ^= zobrist_material_key(THEM, pt,
+					__builtin_popcountll(p->pieces[THEM][pt]));
+				break;
+			}
+	}
+
+	/* En passant capture */
+	if (m->flags == MOVE_EP_CAPTURE) {
+		int cap_sq = to - UP;
+		p->pieces[THEM][PAWN] &= ~(1ULL << cap_sq);
+		h ^= zobrist_piece_key(THEM, PAWN, cap_sq);
+		nnue_sub(&nd, THEM, PAWN, cap_sq);
+		mk ^= zobrist_material_key(THEM, PAWN,
+			__builtin_popcountll(p->pieces[THEM][PAWN]));
+	}
+
+	/* Move piece */
+	p->pieces[US][moved] &= ~from_bb;
+	p->pieces[US][moved] |= to_bb;
+	h ^= zobrist_piece_key(US, moved, from);
+	h ^= zobrist_piece_key(US, moved, to);
+	nnue_sub(&nd, US, moved, from);
+	nnue_add(&nd, US, MOVE_IS_PROMO(m->flags)
+	                  ? promo_type_from_flags(m->flags) : moved, to);
+
+	/* Promotion */
+	if (MOVE_IS_PROMO(m->flags)) {
+		PieceType promo = promo_type_from_flags(m->flags);
+		p->pieces[US][moved] &= ~to_bb;
+		mk ^= zobrist_material_key(US, PAWN,
+			__builtin_popcountll(p->pieces[US][PAWN]));
+		mk ^= zobrist_material_key(US, promo,
+			__builtin_popcountll(p->pieces[US][promo]));
+		p->pieces[US][promo] |= to_bb;
+		h ^= zobrist_piece_key(US, moved, to);
+		h ^= zobrist_piece_key(US, promo, to);
+	}
+
+	/* Castling rook */
+	if (m->flags == MOVE_CASTLE_K) {
+		int rf = REL_SQ(SQ_H1), rt = REL_SQ(SQ_F1);
+		p->pieces[US][ROOK] &= ~(1ULL << rf);
+		p->pieces[US][ROOK] |= (1ULL << rt);
+		h ^= zobrist_piece_key(US, ROOK, rf);
+		h ^= zobrist_piece_key(US, ROOK, rt);
+		nnue_sub(&nd, US, ROOK, rf);
+		nnue_add(&nd, US, ROOK, rt);
+	}
+	if (m->flags == MOVE_CASTLE_Q) {
+		int rf = REL_SQ(SQ_A1), rt = REL_SQ(SQ_D1);
+		p->pieces[US][ROOK] &= ~(1ULL << rf);
+		p->pieces[US][ROOK] |= (1ULL << rt);
+		h ^= zobrist_piece_key(US, ROOK, rf);
+		h ^= zobrist_piece_key(US, ROOK, rt);
+		nnue_sub(&nd, US, ROOK, rf);
+		nnue_add(&nd, US, ROOK, rt);
+	}
+
+	/* En passant */
+	if (m->flags == MOVE_DOUBLE_PUSH)
+		p->en_passant = from + UP;
+	else
+		p->en_passant = -1;
+
+	/* Castling rights */
+	if (from == SQ_E1) p->castling &= ~(CASTLE_WK | CASTLE_WQ);
+	if (from == SQ_E8) p->castling &= ~(CASTLE_BK | CASTLE_BQ);
+	if (from == SQ_A1 || to == SQ_A1) p->castling &= ~CASTLE_WQ;
+	if (from == SQ_H1 || to == SQ_H1) p->castling &= ~CASTLE_WK;
+	if (from == SQ_A8 || to == SQ_A8) p->castling &= ~CASTLE_BQ;
+	if (from == SQ_H8 || to == SQ_H8) p->castling &= ~CASTLE_BK;
+
+	h ^= zobrist_castling_key(p->castling);
+	if (p->en_passant >= 0)
+		h ^= zobrist_ep_key(p->en_passant & 7);
+
+	/* Clocks */
+	if (moved == PAWN || MOVE_IS_CAPTURE(m->flags))
+		p->halfmove = 0;
+	else
+		p->halfmove++;
+	if (US == BLACK) p->fullmove++;
+
+	p->white_turn = !WHITE_SIDE;
+	h ^= zobrist_side_key();
+	p->hash = h;
+	p->material_key = mk;
+	if (p->acc) {
+		nnue_apply(p->acc, p->acc + 1, &nd);
+		p->acc++;
+	}
+}
@@ -1,6 +1,7 @@
 #include "movegen.h"
 #include "attack.h"
 #include "move.h"
+#include "profile.h"
 #include <string.h>
 #include <ctype.h>
 
@@ -17,61 +18,32 @@ static void add_move(MoveList *list, int from, int to, int flags) {
 	for (Bitboard _tmp = (bb); _tmp; _tmp &= _tmp - 1) \
 		if (((sq) = __builtin_ctzll(_tmp)), 1)
 
-static void gen_pawn_moves(const Position *p, MoveList *list, Color side) {
-	Bitboard pawns   = p->pieces[side][PAWN];
-	Bitboard enemies = pieces_by_color(p, side == WHITE ? BLACK : WHITE);
-	Bitboard empty   = ~occupied(p);
-	int push_dir   = (side == WHITE) ? 8 : -8;
-	int promo_rank = (side == WHITE) ? 7 : 0;
-	int start_rank = (side == WHITE) ? 1 : 6;
-	int sq;
-
-	FOR_EACH_BIT(pawns, sq) {
-		int rank = SQ_RANK(sq);
-		int push1 = sq + push_dir;
-		if (push1 >= 0 && push1 < 64 && (empty & (1ULL << push1))) {
-			if (SQ_RANK(push1) == promo_rank) {
-				add_move(list, sq, push1, MOVE_PROMO_Q);
-				add_move(list, sq, push1, MOVE_PROMO_R);
-				add_move(list, sq, push1, MOVE_PROMO_B);
-				add_move(list, sq, push1, MOVE_PROMO_N);
-			} else {
-				add_move(list, sq, push1, MOVE_QUIET);
-			}
-			if (rank == start_rank) {
-				int push2 = sq + 2 * push_dir;
-				if (empty & (1ULL << push2))
-					add_move(list, sq, push2, MOVE_DOUBLE_PUSH);
-			}
-		}
-		Bitboard atk = pawn_attacks(sq, side);
-		Bitboard captures = atk & enemies;
-		int csq;
-		FOR_EACH_BIT(captures, csq) {
-			if (SQ_RANK(csq) == promo_rank) {
-				add_move(list, sq, csq, MOVE_PROMO_CAP_Q);
-				add_move(list, sq, csq, MOVE_PROMO_CAP_R);
-				add_move(list, sq, csq, MOVE_PROMO_CAP_B);
-				add_move(list, sq, csq, MOVE_PROMO_CAP_N);
-			} else {
-				add_move(list, sq, csq, MOVE_CAPTURE);
-			}
-		}
-		if (p->en_passant >= 0 && (atk & (1ULL << p->en_passant)))
-			add_move(list, sq, p->en_passant, MOVE_EP_CAPTURE);
+static Bitboard piece_attacks_from(PieceType pt, int sq, Bitboard occ) {
+	switch (pt) {
+	case KNIGHT: return knight_attacks(sq);
+	case BISHOP: return bishop_attacks(sq, occ);
+	case ROOK:   return rook_attacks(sq, occ);
+	case QUEEN:  return queen_attacks(sq, occ);
+	case KING:   return king_attacks(sq);
+	default:     return 0;
 	}
 }
 
-static void gen_piece_moves(const Position *p, MoveList *list, Color side,
-                            PieceType pt,
-                            Bitboard (*atk_fn)(int, Bitboard)) {
+#define WHITE_SIDE 1
+#include "movegen_side.h"
+#undef WHITE_SIDE
+#define WHITE_SIDE 0
+#include "movegen_side.h"
+#undef WHITE_SIDE
+
+static void gen_piece_moves(const Position *p, const AttackInfo *ai,
+                            MoveList *list, Color side, PieceType pt) {
 	Bitboard pcs      = p->pieces[side][pt];
 	Bitboard friendly = pieces_by_color(p, side);
 	Bitboard enemies  = pieces_by_color(p, side == WHITE ? BLACK : WHITE);
-	Bitboard occ      = occupied(p);
 	int sq;
 	FOR_EACH_BIT(pcs, sq) {
-		Bitboard atk = atk_fn(sq, occ) & ~friendly;
+		Bitboard atk = ai->piece_attacks[sq] & ~friendly;
 		int tsq;
 		FOR_EACH_BIT(atk, tsq) {
 			int flags = (enemies & (1ULL << tsq)) ? MOVE_CAPTURE : MOVE_QUIET;
@@ -80,103 +52,103 @@ static void gen_piece_moves(const Position *p, MoveList *list, Color side,
 	}
 }
 
-static void gen_knight_moves(const Position *p, MoveList *list, Color side) {
-	Bitboard knights  = p->pieces[side][KNIGHT];
-	Bitboard friendly = pieces_by_color(p, side);
-	Bitboard enemies  = pieces_by_color(p, side == WHITE ? BLACK : WHITE);
-	int sq;
-	FOR_EACH_BIT(knights, sq) {
-		Bitboard atk = knight_attacks(sq) & ~friendly;
-		int tsq;
-		FOR_EACH_BIT(atk, tsq) {
-			int flags = (enemies & (1ULL << tsq)) ? MOVE_CAPTURE : MOVE_QUIET;
-			add_move(list, sq, tsq, flags);
-		}
+static void gen_pseudo(const Position *p, const AttackInfo *ai,
+                       MoveList *list) {
+	list->count = 0;
+	Color side = p->white_turn ? WHITE : BLACK;
+	if (side == WHITE) gen_pawn_moves_white(p, list);
+	else               gen_pawn_moves_black(p, list);
+	for (int pt = KNIGHT; pt <= KING; pt++)
+		gen_piece_moves(p, ai, list, side, (PieceType)pt);
+	if (p->pieces[side][KING]) {
+		if (side == WHITE) gen_castling_white(p, ai, list);
+		else               gen_castling_black(p, ai, list);
 	}
 }
 
-static void gen_king_moves(const Position *p, MoveList *list, Color side) {
-	Bitboard king = p->pieces[side][KING];
-	if (king == 0) return;
-	Bitboard friendly = pieces_by_color(p, side);
-	Color enemy       = (side == WHITE) ? BLACK : WHITE;
-	Bitboard enemies  = pieces_by_color(p, enemy);
-	int ksq = __builtin_ctzll(king);
+void generate_pseudo_legal(const Position *p, MoveList *list) {
+	AttackInfo ai;
+	compute_attack_info(p, &ai);
+	gen_pseudo(p, &ai, list);
+}
 
-	Bitboard atk = king_attacks(ksq) & ~friendly;
-	int tsq;
-	FOR_EACH_BIT(atk, tsq) {
-		int flags = (enemies & (1ULL << tsq)) ? MOVE_CAPTURE : MOVE_QUIET;
-		add_move(list, ksq, tsq, flags);
+/* Legality from the attack maps: king moves avoid attacked squares (and
+ * slider rays through the king), evasions must capture or block a single
+ * checker, pinned pieces stay on their pin line. En passant, which can
+ * expose the king along a rank, falls back to make-and-test. */
+static bool is_legal(const Position *p, const AttackInfo *ai, const Move *m,
+                     int ksq, Color enemy) {
+	if (m->from == ksq) {
+		if (m->flags == MOVE_CASTLE_K || m->flags == MOVE_CASTLE_Q)
+			return true;
+		if (ai->by_color[enemy] & (1ULL << m->to)) return false;
+		if (!ai->checkers) return true;
+		Bitboard occ = occupied(p) ^ (1ULL << ksq);
+		return !(attackers_to(p, m->to, occ) & pieces_by_color(p, enemy));
 	}
-
-	Bitboard occ = occupied(p);
-	if (side == WHITE && !is_square_attacked(p, ksq, enemy)) {
-		if ((p->castling & CASTLE_WK) &&
-		    !(occ & ((1ULL << SQ_F1) | (1ULL << SQ_G1))) &&
-		    !is_square_attacked(p, SQ_F1, enemy) &&
-		    !is_square_attacked(p, SQ_G1, enemy))
-			add_move(list, SQ_E1, SQ_G1, MOVE_CASTLE_K);
-		if ((p->castling & CASTLE_WQ) &&
-		    !(occ & ((1ULL << SQ_B1) | (1ULL << SQ_C1) | (1ULL << SQ_D1))) &&
-		    !is_square_attacked(p, SQ_C1, enemy) &&
-		    !is_square_attacked(p, SQ_D1, enemy))
-			add_move(list, SQ_E1, SQ_C1, MOVE_CASTLE_Q);
+	if (m->flags == MOVE_EP_CAPTURE) {
+		Position test = *p;
+		make_move(&test, m);
+		return !is_square_attacked(&test, ksq, enemy);
 	}
-	if (side == BLACK && !is_square_attacked(p, ksq, enemy)) {
-		if ((p->castling & CASTLE_BK) &&
-		    !(occ & ((1ULL << SQ_F8) | (1ULL << SQ_G8))) &&
-		    !is_square_attacked(p, SQ_F8, enemy) &&
-		    !is_square_attacked(p, SQ_G8, enemy))
-			add_move(list, SQ_E8, SQ_G8, MOVE_CASTLE_K);
-		if ((p->castling & CASTLE_BQ) &&
-		    !(occ & ((1ULL << SQ_B8) | (1ULL << SQ_C8) | (1ULL << SQ_D8))) &&
-		    !is_square_attacked(p, SQ_C8, enemy) &&
-		    !is_square_attacked(p, SQ_D8, enemy))
-			add_move(list, SQ_E8, SQ_C8, MOVE_CASTLE_Q);
+	if (ai->checkers) {
+		if (ai->checkers & (ai->checkers - 1)) return false;
+		int csq = __builtin_ctzll(ai->checkers);
+		if (m->to != csq && !(between_bb(ksq, csq) & (1ULL << m->to)))
+			return false;
 	}
+	if ((ai->pinned & (1ULL << m->from))
+	    && !(line_bb(ksq, m->from) & (1ULL << m->to)))
+		return false;
+	return true;
 }
 
-void generate_pseudo_legal(const Position *p, MoveList *list) {
-	list->count = 0;
-	Color side = p->white_turn ? WHITE : BLACK;
-	gen_pawn_moves(p, list, side);
-	gen_knight_moves(p, list, side);
-	gen_piece_moves(p, list, side, BISHOP, bishop_attacks);
-	gen_piece_moves(p, list, side, ROOK, rook_attacks);
-	gen_piece_moves(p, list, side, QUEEN, queen_attacks);
-	gen_king_moves(p, list, side);
-}
-
-static void filter_legal(const Position *p, const MoveList *pseudo,
-                         MoveList *out, bool captures_only) {
+static void filter_legal(const Position *p, const AttackInfo *ai,
+                         const MoveList *pseudo, MoveList *out,
+                         bool captures_only) {
 	Color side  = p->white_turn ? WHITE : BLACK;
 	Color enemy = p->white_turn ? BLACK : WHITE;
 	out->count  = 0;
+	Bitboard king = p->pieces[side][KING];
+	if (king == 0) return;
+	int ksq = __builtin_ctzll(king);
 	for (int i = 0; i < pseudo->count; i++) {
 		if (captures_only && !MOVE_IS_CAPTURE(pseudo->moves[i].flags))
 			continue;
-		Position test = *p;
-		make_move(&test, &pseudo->moves[i]);
-		Bitboard king = test.pieces[side][KING];
-		if (king == 0) continue;
-		if (!is_square_attacked(&test, __builtin_ctzll(king), enemy)) {
+		if (is_legal(p, ai, &pseudo->moves[i], ksq, enemy)) {
 			out->moves[out->count] = pseudo->moves[i];
 			out->count++;
 		}
 	}
 }
 
-void generate_legal_moves(const Position *p, MoveList *list) {
+void generate_moves(const Position *p, const AttackInfo *ai, MoveList *list) {
 	MoveList pseudo;
-	generate_pseudo_legal(p, &pseudo);
-	filter_legal(p, &pseudo, list, false);
+	PROF_BEGIN(t);
+	gen_pseudo(p, ai, &pseudo);
+	PROF(PROF_FILTER_LEGAL, filter_legal(p, ai, &pseudo, list, false));
+	PROF_END(PROF_MOVEGEN, t);
 }
 
-void generate_legal_captures(const Position *p, MoveList *list) {
+void generate_captures(const Position *p, const AttackInfo *ai,
+                       MoveList *list) {
 	MoveList pseudo;
-	generate_pseudo_legal(p, &pseudo);
-	filter_legal(p, &pseudo, list, true);
+	PROF_BEGIN(t);
+	gen_pseudo(p, ai, &pseudo);
+	PROF(PROF_FILTER_LEGAL, filter_legal(p, ai, &pseudo, list, true));
+	PROF_END(PROF_MOVEGEN, t);
+}
+
+void generate_legal_moves(const Position *p, MoveList *list) {
+	AttackInfo ai;
+	compute_attack_info(p, &ai);
+	generate_moves(p, &ai, list);
+}
+
+void generate_legal_captures(const Position *p, MoveList *list) {
+	AttackInfo ai;
+	compute_attack_info(p, &ai);
+	generate_captures(p, &ai, list);
 }
 
 bool is_move_legal(const Position *p, int from, int to,
@@ -197,13 +169,69 @@ bool is_move_legal(const Position *p, int from, int to,
 	return false;
 }
 
+/* Builds the move from the board instead of matching it against the
+ * generated list: pseudo-legality from the attack maps, then the same
+ * legality test as the generator. Castling, once a game, goes through
+ * is_move_legal. */
+bool move_from_coords(const Position *p, int from, int to,
+                      PieceType promo_piece, Move *out) {
+	Color side  = p->white_turn ? WHITE : BLACK;
+	Color enemy = p->white_turn ? BLACK : WHITE;
+	Bitboard own = pieces_by_color(p, side);
+	Bitboard theirs = pieces_by_color(p, enemy);
+	Bitboard to_bb = 1ULL << to;
+	if (!(own & (1ULL << from)) || (own & to_bb) || !p->pieces[side][KING])
+		return false;
+	PieceType pt = piece_type_at(p, from);
+	if (pt == KING && (to - from == 2 || from - to == 2))
+		return is_move_legal(p, from, to, promo_piece, out);
+
+	AttackInfo ai;
+	compute_attack_info(p, &ai);
+	int flags = (theirs & to_bb) ? MOVE_CAPTURE : MOVE_QUIET;
+	if (pt == PAWN) {
+		int fwd = p->white_turn ? 8 : -8;
+		if (pawn_attacks(from, side) & to_bb) {
+			if (to == p->en_passant) flags = MOVE_EP_CAPTURE;
+			else if (flags != MOVE_CAPTURE) return false;
+		} else if (flags == MOVE_CAPTURE) {
+			return false;
+		} else if (to == from + 2 * fwd) {
+			if (SQ_RANK(from) != (p->white_turn ? 1 : 6)
+			    || (occupied(p) & (1ULL << (from + fwd))))
+				return false;
+			flags = MOVE_DOUBLE_PUSH;
+		} else if (to != from + fwd) {
+			return false;
+		}
+		if (SQ_RANK(to) == 0 || SQ_RANK(to) == 7) {
+			PieceType want = promo_piece == PIECE_NONE ? QUEEN : promo_piece;
+			flags = (flags == MOVE_CAPTURE ? MOVE_PROMO_CAP_N : MOVE_PROMO_N)
+			      + (int)(want - KNIGHT);
+		}
+	} else if (!(ai.piece_attacks[from] & to_bb)) {
+		return false;
+	}
+
+	Move m = { from, to, flags };
+	if (!is_legal(p, &ai, &m, __builtin_ctzll(p->pieces[side][KING]), enemy))
+		return false;
+	if (out) *out = m;
+	return true;
+}
+
 int count_legal_moves(const Position *p) {
 	MoveList list;
 	generate_legal_moves(p, &list);
 	return list.count;
 }
 
+/* A null move, as a search that could not run returns, prints as 0000 */
 void move_to_str(const Move *m, char *buf) {
+	if (m->from == m->to) {
+		strcpy(buf, "0000");
+		return;
+	}
 	buf[0] = 'a' + SQ_FILE(m->from);
 	buf[1] = '1' + SQ_RANK(m->from);
 	buf[2] = 'a' + SQ_FILE(m->to);
@@ -234,10 +262,76 @@ bool parse_move(const char *str, const Position *p, Move *m) {
 		default:  break;
 		}
 	}
-	return is_move_legal(p, from, to, promo, m);
+	return move_from_coords(p, from, to, promo, m);
 }
 
-void move_to_san(const Move *m, const Position *p, char *buf) {
+/* Checking squares for each piece type around the enemy king, and the
+ * side to move's pieces that alone block one of its sliders from it */
+void check_info(const Position *p, CheckInfo *ci) {
+	Color us   = p->white_turn ? WHITE : BLACK;
+	Color them = p->white_turn ? BLACK : WHITE;
+	memset(ci, 0, sizeof(*ci));
+	ci->ksq = -1;
+	if (!p->pieces[them][KING]) return;
+	int k = ci->ksq = __builtin_ctzll(p->pieces[them][KING]);
+	Bitboard occ = occupied(p);
+	ci->check_sq[PAWN]   = pawn_attacks(k, them);
+	ci->check_sq[KNIGHT] = knight_attacks(k);
+	ci->check_sq[BISHOP] = bishop_attacks(k, occ);
+	ci->check_sq[ROOK]   = rook_attacks(k, occ);
+	ci->check_sq[QUEEN]  = ci->check_sq[BISHOP] | ci->check_sq[ROOK];
+
+	Bitboard snipers =
+		(bishop_pseudo_attacks(k) & (p->pieces[us][BISHOP] | p->pieces[us][QUEEN]))
+		| (rook_pseudo_attacks(k) & (p->pieces[us][ROOK] | p->pieces[us][QUEEN]));
+	Bitboard ours = pieces_by_color(p, us);
+	int sq;
+	FOR_EACH_BIT(snipers, sq) {
+		Bitboard b = between_bb(k, sq) & occ;
+		if (b && !(b & (b - 1)) && (b & ours)) ci->blockers |= b;
+	}
+}
+
+/* Castling and en passant move or remove a second piece and are rare
+ * enough to test by making them */
+bool gives_check(const Position *p, const CheckInfo *ci, const Move *m) {
+	if (ci->ksq < 0) return false;
+	if (m->flags == MOVE_EP_CAPTURE || m->flags == MOVE_CASTLE_K
+	    || m->flags == MOVE_CASTLE_Q) {
+		Position test = *p;
+		make_move(&test, m);
+		return is_in_check(&test);
+	}
+	Bitboard from_bb = 1ULL << m->from, to_bb = 1ULL << m->to;
+	if ((ci->blockers & from_bb) && !(line_bb(ci->ksq, m->from) & to_bb))
+		return true;
+	if (MOVE_IS_PROMO(m->flags)) {
+		/* The pawn may have stood on the new piece's line to the king */
+		Bitboard occ = occupied(p) ^ from_bb;
+		return (piece_attacks_from(promo_type_from_flags(m->flags), m->to, occ)
+		        >> ci->ksq) & 1;
+	}
+	return (ci->check_sq[piece_type_at(p, m->from)] & to_bb) != 0;
+}
+
+/* Other pieces of the same type that can legally reach m->to. Pinned
+ * ones must stay on their pin line; if m answers a check, so does any
+ * other move to the same square. */
+static Bitboard san_rivals(const Position *p, const AttackInfo *ai,
+                           PieceType pt, const Move *m) {
+	Color side = p->white_turn ? WHITE : BLACK;
+	Bitboard rivals = p->pieces[side][pt] & ~(1ULL << m->from)
+	                & piece_attacks_from(pt, m->to, occupied(p));
+	Bitboard pinned = rivals & ai->pinned;
+	int ksq = __builtin_ctzll(p->pieces[side][KING]), sq;
+	FOR_EACH_BIT(pinned, sq)
+		if (!(line_bb(ksq, sq) & (1ULL << m->to)))
+			rivals &= ~(1ULL << sq);
+	return rivals;
+}
+
+static void san_format(const Position *p, const AttackInfo *ai,
+                       const CheckInfo *ci, const Move *m, char *buf) {
 	int idx = 0;
 
 	if (m->flags == MOVE_CASTLE_K) {
@@ -263,46 +357,55 @@ void move_to_san(const Move *m, const Position *p, char *buf) {
 			static const char pc[] = {0, 'N', 'B', 'R', 'Q', 'K'};
 			buf[idx++] = pc[pt];
 
-			/* Disambiguation */
-			MoveList legal;
-			generate_legal_moves(p, &legal);
-			bool need_file = false, need_rank = false;
-			int ambig = 0;
-			for (int i = 0; i < legal.count; i++) {
-				if (legal.moves[i].to == m->to &&
-				    legal.moves[i].from != m->from &&
-				    piece_type_at(p, legal.moves[i].from) == pt) {
-					ambig++;
-					if (SQ_FILE(legal.moves[i].from) == SQ_FILE(m->from))
-						need_rank = true;
-					else
-						need_file = true;
+			/* The file if it tells the pieces apart, else the rank,
+			 * else both */
+			Bitboard rivals = pt == KING ? 0 : san_rivals(p, ai, pt, m);
+			if (rivals) {
+				Bitboard file = 0x0101010101010101ULL << SQ_FILE(m->from);
+				Bitboard rank = 0xFFULL << (8 * SQ_RANK(m->from));
+				if (!(rivals & file)) {
+					buf[idx++] = 'a' + SQ_FILE(m->from);
+				} else if (!(rivals & rank)) {
+					buf[idx++] = '1' + SQ_RANK(m->from);
+				} else {
+					buf[idx++] = 'a' + SQ_FILE(m->from);
+					buf[idx++] = '1' + SQ_RANK(m->from);
 				}
 			}
-			if (ambig > 0) {
-				if (!need_file && !need_rank) need_file = true;
-				if (need_file) buf[idx++] = 'a' + SQ_FILE(m->from);
-				if (need_rank) buf[idx++] = '1' + SQ_RANK(m->from);
-			}
 			if (is_cap) buf[idx++] = 'x';
 			buf[idx++] = 'a' + SQ_FILE(m->to);
 			buf[idx++] = '1' + SQ_RANK(m->to);
 		}
 	}
 
-	/* Check/checkmate suffix */
-	{
+	/* Only a checking move can mate */
+	if (gives_check(p, ci, m)) {
 		Position test = *p;
 		make_move(&test, m);
-		int lc = count_legal_moves(&test);
-		if (lc == 0 && is_in_check(&test))
-			buf[idx++] = '#';
-		else if (is_in_check(&test))
-			buf[idx++] = '+';
+		buf[idx++] = count_legal_moves(&test) ? '+' : '#';
 	}
 	buf[idx] = '\0';
 }
 
+void move_to_san(const Move *m, const Position *p, char *buf) {
+	AttackInfo ai;
+	CheckInfo ci;
+	compute_attack_info(p, &ai);
+	check_info(p, &ci);
+	san_format(p, &ai, &ci, m, buf);
+}
+
+/* SAN for every move of the position's legal move list */
+void moves_to_san(const Position *p, const MoveList *list,
+                  char (*san)[SAN_MAX]) {
+	AttackInfo ai;
+	CheckInfo ci;
+	compute_attack_info(p, &ai);
+	check_info(p, &ci);
+	for (int i = 0; i < list->count; i++)
+		san_format(p, &ai, &ci, &list->moves[i], san[i]);
+}
+
 bool parse_san(const char *str, const Position *p, Move *m) {
 	if (!str || str[0] == '\0') return false;
 
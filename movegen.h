@@ -32,21 +32,39 @@ static inline PieceType promo_type_from_flags(int flags) {
 typedef struct { int from, to, flags; } Move;
 
 #define MAX_MOVES 256
+#define SAN_MAX   12   /* longest is "Qa1xb2+" */
 
 typedef struct {
 	Move moves[MAX_MOVES];
 	int count;
 } MoveList;
 
+/* What a move needs to give check: the squares each piece type checks
+ * the enemy king from, and the pieces whose move uncovers a check */
+typedef struct {
+	Bitboard check_sq[NUM_PIECE_TYPES];
+	Bitboard blockers;
+	int      ksq;   /* enemy king, -1 if none */
+} CheckInfo;
+
 void generate_pseudo_legal(const Position *p, MoveList *list);
+void generate_moves(const Position *p, const AttackInfo *ai, MoveList *list);
+void generate_captures(const Position *p, const AttackInfo *ai,
+                       MoveList *list);
 void generate_legal_moves(const Position *p, MoveList *list);
 void generate_legal_captures(const Position *p, MoveList *list);
 bool is_move_legal(const Position *p, int from, int to,
                    PieceType promo_piece, Move *out);
+bool move_from_coords(const Position *p, int from, int to,
+                      PieceType promo_piece, Move *out);
 int  count_legal_moves(const Position *p);
 void move_to_str(const Move *m, char *buf);
 bool parse_move(const char *str, const Position *p, Move *m);
+void check_info(const Position *p, CheckInfo *ci);
+bool gives_check(const Position *p, const CheckInfo *ci, const Move *m);
 void move_to_san(const Move *m, const Position *p, char *buf);
+void moves_to_san(const Position *p, const MoveList *list,
+                  char (*san)[SAN_MAX]);
 bool parse_san(const char *str, const Position *p, Move *m);
 
 #endif
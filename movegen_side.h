@@ -0,0 +1,59 @@
+/* Pawn and castling generators for one side; see side.h */
+#include "side.h"
+
+static void SIDED(gen_pawn_moves)(const Position *p, MoveList *list) {
+	Bitboard pawns   = p->pieces[US][PAWN];
+	Bitboard enemies = pieces_by_color(p, THEM);
+	Bitboard empty   = ~occupied(p);
+	int sq;
+
+	FOR_EACH_BIT(pawns, sq) {
+		int push1 = sq + UP;
+		if (push1 >= 0 && push1 < 64 && (empty & (1ULL << push1))) {
+			if (SQ_RANK(push1) == REL_RANK(7)) {
+				add_move(list, sq, push1, MOVE_PROMO_Q);
+				add_move(list, sq, push1, MOVE_PROMO_R);
+				add_move(list, sq, push1, MOVE_PROMO_B);
+				add_move(list, sq, push1, MOVE_PROMO_N);
+			} else {
+				add_move(list, sq, push1, MOVE_QUIET);
+			}
+			if (SQ_RANK(sq) == REL_RANK(1)) {
+				int push2 = sq + 2 * UP;
+				if (empty & (1ULL << push2))
+					add_move(list, sq, push2, MOVE_DOUBLE_PUSH);
+			}
+		}
+		Bitboard atk = pawn_attacks(sq, US);
+		Bitboard captures = atk & enemies;
+		int csq;
+		FOR_EACH_BIT(captures, csq) {
+			if (SQ_RANK(csq) == REL_RANK(7)) {
+				add_move(list, sq, csq, MOVE_PROMO_CAP_Q);
+				add_move(list, sq, csq, MOVE_PROMO_CAP_R);
+				add_move(list, sq, csq, MOVE_PROMO_CAP_B);
+				add_move(list, sq, csq, MOVE_PROMO_CAP_N);
+			} else {
+				add_move(list, sq, csq, MOVE_CAPTURE);
+			}
+		}
+		if (p->en_passant >= 0 && (atk & (1ULL << p->en_passant)))
+			add_move(list, sq, p->en_passant, MOVE_EP_CAPTURE);
+	}
+}
+
+static void SIDED(gen_castling)(const Position *p, const AttackInfo *ai,
+                                MoveList *list) {
+	if (ai->checkers) return;
+	Bitboard occ = occupied(p);
+	Bitboard danger = ai->by_color[THEM];
+	Bitboard b = 1ULL << REL_SQ(SQ_B1), c = 1ULL << REL_SQ(SQ_C1);
+	Bitboard d = 1ULL << REL_SQ(SQ_D1), f = 1ULL << REL_SQ(SQ_F1);
+	Bitboard g = 1ULL << REL_SQ(SQ_G1);
+	if ((p->castling & (WHITE_SIDE ? CASTLE_WK : CASTLE_BK))
+	    && !(occ & (f | g)) && !(danger & (f | g)))
+		add_move(list, REL_SQ(SQ_E1), REL_SQ(SQ_G1), MOVE_CASTLE_K);
+	if ((p->castling & (WHITE_SIDE ? CASTLE_WQ : CASTLE_BQ))
+	    && !(occ & (b | c | d)) && !(danger & (c | d)))
+		add_move(list, REL_SQ(SQ_E1), REL_SQ(SQ_C1), MOVE_CASTLE_Q);
+}
@@ -0,0 +1,170 @@
+#define _POSIX_C_SOURCE 200809L
+#include "nnue.h"
+#include "evalparams.h"
+#include "kernels.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Net file: "GCENNUE1", uint32 hidden width, then little-endian int16
+ * feature weights [768][hidden], feature biases [hidden], output weights
+ * [2 * hidden] (side to move first) and an int32 output bias. Feature
+ * index is (colour * 6 + piece) * 64 + square, seen from the perspective
+ * side: its own pieces are colour 0 and black's board is flipped.
+ */
+
+typedef struct {
+	int16_t feature_weights[NNUE_INPUTS][NNUE_HIDDEN];
+	int16_t feature_bias[NNUE_HIDDEN];
+	int16_t output_weights[2 * NNUE_HIDDEN];
+	int32_t output_bias;
+} NnueNet;
+
+static const char nnue_magic[8] = { 'G', 'C', 'E', 'N', 'N', 'U', 'E', '1' };
+
+static NnueNet net __attribute__((aligned(64)));
+static char    net_name[256];
+static bool    net_ready;
+bool nnue_enabled = false;
+
+/*
+ * The built-in net restates the material and piece-square part of the
+ * classic evaluation, king squares averaged over the game phase. One
+ * hidden unit per piece type sums value + PST of its own pieces in steps
+ * of unit[] centipawns, and the output takes the difference between the
+ * two perspectives, so the biases cancel. It keeps the engine playable
+ * until a trained net is loaded with EvalFile.
+ */
+static void build_default(void) {
+	static const int *pst[NUM_PIECE_TYPES] = {
+		pst_pawn, pst_knight, pst_bishop, pst_rook, pst_queen, NULL
+	};
+	static const int value[NUM_PIECE_TYPES] = {
+		VAL_PAWN, VAL_KNIGHT, VAL_BISHOP, VAL_ROOK, VAL_QUEEN, 0
+	};
+	/* Coarse enough that a full set of one piece type fits below QA */
+	static const int unit[NUM_PIECE_TYPES] = { 5, 5, 5, 10, 10, 5 };
+
+	memset(&net, 0, sizeof(net));
+	for (int pt = PAWN; pt <= KING; pt++) {
+		for (int sq = 0; sq < 64; sq++) {
+			int v = pt == KING ? (pst_king_mg[sq] + pst_king_eg[sq]) / 2
+			                   : value[pt] + pst[pt][sq];
+			int q = (v + (v >= 0 ? unit[pt] : -unit[pt]) / 2) / unit[pt];
+			net.feature_weights[nnue_feature(WHITE, pt, sq)][pt] = (int16_t)q;
+		}
+		int w = unit[pt] * NNUE_QA * NNUE_QB / NNUE_SCALE;
+		net.output_weights[pt] = (int16_t)w;
+		net.output_weights[NNUE_HIDDEN + pt] = (int16_t)-w;
+	}
+	net.feature_bias[KING] = 20;   /* keeps the king unit above zero */
+	snprintf(net_name, sizeof(net_name), "<default>");
+	net_ready = true;
+}
+
+/* The default net is built on first use rather than at startup */
+void nnue_init(void) {
+	if (!net_ready) build_default();
+}
+
+void nnue_use_default(void) {
+	build_default();
+}
+
+const char *nnue_net_name(void) {
+	return net_name;
+}
+
+const char *nnue_kernel(void) {
+	return kernels->simd;
+}
+
+static int16_t le16(const uint8_t *b) {
+	return (int16_t)(uint16_t)(b[0] | b[1] << 8);
+}
+
+/* The current net is kept if the file is missing or malformed */
+bool nnue_load(const char *path) {
+	const size_t n16 = (size_t)NNUE_INPUTS * NNUE_HIDDEN + 3 * NNUE_HIDDEN;
+	const size_t size = 12 + n16 * 2 + 4;
+	FILE *f = fopen(path, "rb");
+	if (!f) return false;
+	uint8_t *buf = malloc(size + 1);
+	size_t got = buf ? fread(buf, 1, size + 1, f) : 0;
+	fclose(f);
+	uint32_t hidden = got >= 12 ? (uint32_t)(buf[8] | buf[9] << 8
+	                  | buf[10] << 16 | (uint32_t)buf[11] << 24) : 0;
+	if (got != size || memcmp(buf, nnue_magic, 8) != 0
+	    || hidden != NNUE_HIDDEN) {
+		free(buf);
+		return false;
+	}
+
+	const uint8_t *b = buf + 12;
+	for (int i = 0; i < NNUE_INPUTS; i++)
+		for (int j = 0; j < NNUE_HIDDEN; j++, b += 2)
+			net.feature_weights[i][j] = le16(b);
+	for (int j = 0; j < NNUE_HIDDEN; j++, b += 2)
+		net.feature_bias[j] = le16(b);
+	for (int j = 0; j < 2 * NNUE_HIDDEN; j++, b += 2)
+		net.output_weights[j] = le16(b);
+	net.output_bias = (int32_t)(uint32_t)(b[0] | b[1] << 8 | b[2] << 16
+	                                      | (uint32_t)b[3] << 24);
+	free(buf);
+	snprintf(net_name, sizeof(net_name), "%s", path);
+	net_ready = true;
+	return true;
+}
+
+/* Index of a white-perspective feature as seen from black */
+static int flip_feature(int f) {
+	return (f ^ 56) + (f < NNUE_INPUTS / 2 ? NNUE_INPUTS / 2 : -NNUE_INPUTS / 2);
+}
+
+void nnue_refresh(Position *p) {
+	int16_t (*acc)[NNUE_HIDDEN] = p->acc->v;
+	const int16_t *rows[2][16];
+	int n = 0;
+	for (int persp = 0; persp < 2; persp++)
+		memcpy(acc[persp], net.feature_bias, sizeof(net.feature_bias));
+	for (int c = WHITE; c <= BLACK; c++)
+		for (int pt = PAWN; pt <= KING; pt++)
+			for (Bitboard bb = p->pieces[c][pt]; bb; bb &= bb - 1) {
+				int f = nnue_feature(c, pt, __builtin_ctzll(bb));
+				rows[WHITE][n] = net.feature_weights[f];
+				rows[BLACK][n] = net.feature_weights[flip_feature(f)];
+				if (++n == 16) {
+					for (int persp = 0; persp < 2; persp++)
+						kernels->acc_update(acc[persp], acc[persp], rows[persp], n, NULL, 0);
+					n = 0;
+				}
+			}
+	for (int persp = 0; persp < 2; persp++)
+		kernels->acc_update(acc[persp], acc[persp], rows[persp], n, NULL, 0);
+}
+
+void nnue_apply(const NnueAccumulator *from, NnueAccumulator *to,
+                const NnueDelta *d) {
+	const int16_t *add[2], *sub[2];
+	for (int i = 0; i < d->n_add; i++)
+		add[i] = net.feature_weights[d->add[i]];
+	for (int i = 0; i < d->n_sub; i++)
+		sub[i] = net.feature_weights[d->sub[i]];
+	kernels->acc_update(to->v[WHITE], from->v[WHITE], add, d->n_add, sub, d->n_sub);
+	for (int i = 0; i < d->n_add; i++)
+		add[i] = net.feature_weights[flip_feature(d->add[i])];
+	for (int i = 0; i < d->n_sub; i++)
+		sub[i] = net.feature_weights[flip_feature(d->sub[i])];
+	kernels->acc_update(to->v[BLACK], from->v[BLACK], add, d->n_add, sub, d->n_sub);
+}
+
+/* Score for the side to move; p must carry a current accumulator */
+int nnue_evaluate(const Position *p) {
+	int us = p->white_turn ? WHITE : BLACK;
+	const int16_t *w = net.output_weights;
+	int64_t sum = (int64_t)kernels->output_half(p->acc->v[us], w)
+	            + kernels->output_half(p->acc->v[us ^ 1], w + NNUE_HIDDEN)
+	            + net.output_bias;
+	return (int)(sum * NNUE_SCALE / (NNUE_QA * NNUE_QB));
+}
@@ -0,0 +1,53 @@
+#ifndef NNUE_H
+#define NNUE_H
+
+#include "board.h"
+
+/*
+ * Efficiently updatable evaluation network: 768 piece-square inputs per
+ * perspective -> NNUE_HIDDEN int16 accumulator per perspective -> clipped
+ * ReLU -> one output. The side to move's half comes first.
+ */
+#define NNUE_INPUTS 768
+#define NNUE_HIDDEN 128
+#define NNUE_QA     255   /* clipped ReLU ceiling */
+#define NNUE_QB     64    /* output weight scale */
+#define NNUE_SCALE  400   /* output units per QA * QB */
+
+/* A search keeps one per ply: make_move computes the child's slot from
+ * the parent's, so copying a Position copies only the pointer */
+typedef struct NnueAccumulator {
+	int16_t v[2][NNUE_HIDDEN];
+} NnueAccumulator;
+
+/* Features a move adds and removes, as white-perspective indices */
+typedef struct {
+	int add[2], sub[2];
+	int n_add, n_sub;
+} NnueDelta;
+
+static inline int nnue_feature(int c, int pt, int sq) {
+	return (c * NUM_PIECE_TYPES + pt) * 64 + sq;
+}
+
+static inline void nnue_add(NnueDelta *d, int c, int pt, int sq) {
+	d->add[d->n_add++] = nnue_feature(c, pt, sq);
+}
+
+static inline void nnue_sub(NnueDelta *d, int c, int pt, int sq) {
+	d->sub[d->n_sub++] = nnue_feature(c, pt, sq);
+}
+
+extern bool nnue_enabled;
+
+void        nnue_init(void);
+bool        nnue_load(const char *path);
+void        nnue_use_default(void);
+const char *nnue_net_name(void);
+const char *nnue_kernel(void);
+void        nnue_refresh(Position *p);
+void        nnue_apply(const NnueAccumulator *from, NnueAccumulator *to,
+                       const NnueDelta *d);
+int         nnue_evaluate(const Position *p);
+
+#endif
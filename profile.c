@@ -0,0 +1,38 @@
+#include "profile.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef GCE_PROFILE
+__thread ProfCounter prof_counters[PROF_COUNT];
+
+static const char *prof_names[PROF_COUNT] = {
+	"search", "movegen", "  filter_legal", "attack_info", "make_move",
+	"evaluate", "  material", "  pst", "  pawns", "  king", "  pieces",
+	"  nnue", "tt_probe", "tt_store"
+};
+#endif
+
+void profile_reset(void) {
+#ifdef GCE_PROFILE
+	memset(prof_counters, 0, sizeof(prof_counters));
+#endif
+}
+
+void profile_report(const char *prefix) {
+#ifdef GCE_PROFILE
+	uint64_t total = prof_counters[PROF_SEARCH].ticks;
+	printf("%s%-15s %12s %16s %12s %8s\n", prefix, "profile", "calls",
+	       PROF_UNIT, "per call", "% search");
+	for (int i = 0; i < PROF_COUNT; i++) {
+		const ProfCounter *c = &prof_counters[i];
+		if (!c->calls) continue;
+		printf("%s%-15s %12llu %16llu %12.1f %8.1f\n", prefix, prof_names[i],
+		       (unsigned long long)c->calls, (unsigned long long)c->ticks,
+		       (double)c->ticks / (double)c->calls,
+		       total ? 100.0 * (double)c->ticks / (double)total : 0.0);
+	}
+	fflush(stdout);
+#else
+	(void)prefix;
+#endif
+}
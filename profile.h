@@ -0,0 +1,61 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+
+/*
+ * Hot-path profiling, compiled in with -DGCE_PROFILE. Each thread counts
+ * calls and time (TSC cycles on x86, nanoseconds elsewhere) of the
+ * functions below; times are inclusive, so indented rows of the report
+ * are part of the row above. Without the flag the macros vanish.
+ */
+enum {
+	PROF_SEARCH, PROF_MOVEGEN, PROF_FILTER_LEGAL, PROF_ATTACK_INFO,
+	PROF_MAKE_MOVE, PROF_EVALUATE, PROF_EVAL_MATERIAL, PROF_EVAL_PST,
+	PROF_EVAL_PAWNS, PROF_EVAL_KING, PROF_EVAL_PIECES, PROF_EVAL_NNUE,
+	PROF_TT_PROBE, PROF_TT_STORE,
+	PROF_COUNT
+};
+
+typedef struct {
+	uint64_t calls, ticks;
+} ProfCounter;
+
+#ifdef GCE_PROFILE
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PROF_UNIT "cycles"
+static inline uint64_t prof_now(void) {
+	return __rdtsc();
+}
+#else
+#include <time.h>
+#define PROF_UNIT "ns"
+static inline uint64_t prof_now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+#endif
+
+extern __thread ProfCounter prof_counters[PROF_COUNT];
+
+#define PROF_ENABLED 1
+#define PROF_BEGIN(t)   uint64_t t = prof_now()
+#define PROF_END(id, t) (prof_counters[id].calls++, \
+                         prof_counters[id].ticks += prof_now() - (t))
+#else
+#define PROF_ENABLED 0
+#define PROF_BEGIN(t)   ((void)0)
+#define PROF_END(id, t) ((void)0)
+#endif
+
+/* Time one statement */
+#define PROF(id, stmt) \
+	do { PROF_BEGIN(prof_t_); stmt; PROF_END(id, prof_t_); } while (0)
+
+/* Both act on the calling thread's counters */
+void profile_reset(void);
+void profile_report(const char *prefix);   /* one line per counter */
+
+#endif
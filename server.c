@@ -0,0 +1,411 @@
+#define _POSIX_C_SOURCE 200809L
+#include "server.h"
+#include "board.h"
+#include "movegen.h"
+#include "engine.h"
+#include "uci.h"
+#include "kernels.h"
+#include <stdio.h>
+
+#ifdef __linux__
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+/*
+ * Multi-session UCI server. One epoll thread reads commands from every
+ * client on a Unix socket; searches run on a fixed pool of worker
+ * threads that share the engine's transposition table. Each session has
+ * at most one search queued or running, so the FIFO job queue serves
+ * sessions round-robin. Sockets are non-blocking: replies are queued
+ * per session and whatever the socket does not take at once is sent on
+ * EPOLLOUT, so a client that stops reading stalls nobody else.
+ */
+
+#define SERVER_MAX_EVENTS 64
+#define SERVER_READ_CHUNK 4096
+#define SERVER_MAX_OUTPUT (1 << 20)   /* unread output before a hang-up */
+
+typedef struct Session {
+	int             fd, ep;
+	pthread_mutex_t write_lock;
+	/* Guarded by write_lock */
+	char           *out;          /* output the socket has not taken */
+	size_t          out_len, out_cap;
+	bool            want_out;     /* registered for EPOLLOUT */
+	char           *buf;          /* input not yet terminated by '\n' */
+	size_t          len, cap;
+	Position        pos;
+	volatile int    stop;
+	/* Guarded by server.lock */
+	bool            searching;
+	bool            closed;
+	int             refs;
+	struct Session *next;
+	Position        job_pos;
+	int             job_depth;
+	int64_t         job_time;
+	int64_t         job_queued;
+} Session;
+
+static struct {
+	pthread_mutex_t lock;
+	pthread_cond_t  ready;
+	Session        *head, *tail;
+} server = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, NULL };
+
+static int64_t server_time_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/* Sends what the socket takes without blocking and asks for EPOLLOUT
+ * while anything is left. Needs write_lock. */
+static void session_flush(Session *s) {
+	size_t off = 0;
+	while (off < s->out_len) {
+		ssize_t w = send(s->fd, s->out + off, s->out_len - off, MSG_NOSIGNAL);
+		if (w < 0 && errno == EINTR) continue;
+		if (w < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+			off = s->out_len;   /* peer gone; the read side closes it */
+		if (w <= 0) break;
+		off += (size_t)w;
+	}
+	memmove(s->out, s->out + off, s->out_len - off);
+	s->out_len -= off;
+
+	bool want = s->out_len > 0;
+	if (want != s->want_out) {
+		struct epoll_event ev;
+		ev.events = want ? EPOLLIN | EPOLLOUT : EPOLLIN;
+		ev.data.ptr = s;
+		epoll_ctl(s->ep, EPOLL_CTL_MOD, s->fd, &ev);
+		s->want_out = want;
+	}
+}
+
+/* Queues a line and sends what it can; never blocks, so the epoll
+ * thread may reply directly */
+static void session_write(Session *s, const char *line) {
+	size_t n = strlen(line);
+	pthread_mutex_lock(&s->write_lock);
+	if (s->out_len + n + 1 > SERVER_MAX_OUTPUT) {
+		/* The client stopped reading: hang up and let the epoll
+		 * thread close the session */
+		s->stop = 1;
+		shutdown(s->fd, SHUT_RDWR);
+		pthread_mutex_unlock(&s->write_lock);
+		return;
+	}
+	if (s->out_len + n + 1 > s->out_cap) {
+		size_t cap = s->out_cap ? s->out_cap : SERVER_READ_CHUNK;
+		while (cap < s->out_len + n + 1) cap *= 2;
+		char *nb = realloc(s->out, cap);
+		if (!nb) {
+			pthread_mutex_unlock(&s->write_lock);
+			return;
+		}
+		s->out = nb;
+		s->out_cap = cap;
+	}
+	memcpy(s->out + s->out_len, line, n);
+	s->out[s->out_len + n] = '\n';
+	s->out_len += n + 1;
+	session_flush(s);
+	pthread_mutex_unlock(&s->write_lock);
+}
+
+static void session_writable(Session *s) {
+	pthread_mutex_lock(&s->write_lock);
+	session_flush(s);
+	pthread_mutex_unlock(&s->write_lock);
+}
+
+static void session_info(void *ctx, const char *line) {
+	session_write((Session *)ctx, line);
+}
+
+/* Drop one reference; the last one closes the socket. Needs server.lock. */
+static void session_release(Session *s) {
+	if (--s->refs > 0) return;
+	close(s->fd);
+	pthread_mutex_destroy(&s->write_lock);
+	free(s->out);
+	free(s->buf);
+	free(s);
+}
+
+static void *server_worker(void *arg) {
+	(void)arg;
+	SearchState *st = malloc(sizeof(SearchState));
+	if (!st) return NULL;
+	search_state_init(st, NULL);
+
+	for (;;) {
+		pthread_mutex_lock(&server.lock);
+		while (!server.head)
+			pthread_cond_wait(&server.ready, &server.lock);
+		Session *s = server.head;
+		server.head = s->next;
+		if (!server.head) server.tail = NULL;
+		bool closed = s->closed;
+		pthread_mutex_unlock(&server.lock);
+
+		char line[32];
+		if (!closed) {
+			/* Time spent in the queue comes out of the move's budget */
+			int64_t limit = s->job_time;
+			if (limit > 0) {
+				limit -= server_time_ms() - s->job_queued;
+				if (limit < 1) limit = 1;
+			}
+			st->stop = &s->stop;
+			st->info_fn = session_info;
+			st->info_ctx = s;
+			Move best, pv[MAX_PLY];
+			engine_search_state(st, &s->job_pos, s->job_depth, limit,
+			                    true, &best);
+			uci_bestmove_line(line, &best, pv, search_state_pv(st, pv));
+		}
+
+		/* Clear the flag before replying so the client's next go is taken */
+		pthread_mutex_lock(&server.lock);
+		s->searching = false;
+		pthread_mutex_unlock(&server.lock);
+		if (!closed) session_write(s, line);
+
+		pthread_mutex_lock(&server.lock);
+		session_release(s);
+		pthread_mutex_unlock(&server.lock);
+	}
+	return NULL;
+}
+
+static void session_go(Session *s, const char *line) {
+	int depth;
+	int64_t limit;
+	uci_parse_go(line, &s->pos, &depth, &limit);
+
+	MoveList legal;
+	generate_legal_moves(&s->pos, &legal);
+	if (legal.count == 0) {
+		session_write(s, "bestmove 0000");
+		return;
+	}
+
+	pthread_mutex_lock(&server.lock);
+	if (s->searching) {
+		pthread_mutex_unlock(&server.lock);
+		session_write(s, "info string search already running");
+		return;
+	}
+	s->stop = 0;
+	s->job_pos = s->pos;
+	s->job_depth = depth;
+	s->job_time = limit;
+	s->job_queued = server_time_ms();
+	s->searching = true;
+	s->refs++;
+	s->next = NULL;
+	if (server.tail) server.tail->next = s;
+	else server.head = s;
+	server.tail = s;
+	pthread_cond_signal(&server.ready);
+	pthread_mutex_unlock(&server.lock);
+}
+
+/* Returns false when the client asked to quit */
+static bool session_command(Session *s, char *line) {
+	line[strcspn(line, "\r")] = '\0';
+	if (line[0] == '\0') return true;
+
+	if (strcmp(line, "uci") == 0) {
+		char id[64];
+		snprintf(id, sizeof(id), "id name GCE (%s)", kernels_name());
+		session_write(s, id);
+		session_write(s, "id author GCE Team");
+		session_write(s, "uciok");
+	} else if (strcmp(line, "isready") == 0) {
+		session_write(s, "readyok");
+	} else if (strcmp(line, "ucinewgame") == 0) {
+		/* The table is shared with other sessions, so it is kept */
+		init_position(&s->pos);
+	} else if (strncmp(line, "position", 8) == 0 &&
+	           (line[8] == '\0' || line[8] == ' ')) {
+		uci_parse_position(&s->pos, line);
+	} else if (strncmp(line, "go", 2) == 0 &&
+	           (line[2] == '\0' || line[2] == ' ')) {
+		session_go(s, line);
+	} else if (strcmp(line, "stop") == 0) {
+		s->stop = 1;
+	} else if (strcmp(line, "quit") == 0) {
+		return false;
+	}
+	return true;
+}
+
+static void session_close(int ep, Session *s) {
+	epoll_ctl(ep, EPOLL_CTL_DEL, s->fd, NULL);
+	s->stop = 1;
+	pthread_mutex_lock(&server.lock);
+	s->closed = true;
+	session_release(s);
+	pthread_mutex_unlock(&server.lock);
+}
+
+static void session_open(int ep, int fd) {
+	Session *s = calloc(1, sizeof(Session));
+	if (!s) {
+		close(fd);
+		return;
+	}
+	s->fd = fd;
+	s->ep = ep;
+	s->refs = 1;
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+	pthread_mutex_init(&s->write_lock, NULL);
+	init_position(&s->pos);
+	struct epoll_event ev;
+	ev.events = EPOLLIN;
+	ev.data.ptr = s;
+	if (epoll_ctl(ep, EPOLL_CTL_ADD, fd, &ev) < 0) {
+		pthread_mutex_destroy(&s->write_lock);
+		free(s);
+		close(fd);
+	}
+}
+
+static void session_readable(int ep, Session *s) {
+	char chunk[SERVER_READ_CHUNK];
+	ssize_t r = read(s->fd, chunk, sizeof(chunk));
+	if (r < 0 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK))
+		return;
+	if (r <= 0) {
+		session_close(ep, s);
+		return;
+	}
+	if (s->len + (size_t)r + 1 > s->cap) {
+		size_t cap = s->cap ? s->cap : SERVER_READ_CHUNK;
+		while (cap < s->len + (size_t)r + 1) cap *= 2;
+		char *nb = realloc(s->buf, cap);
+		if (!nb) {
+			session_close(ep, s);
+			return;
+		}
+		s->buf = nb;
+		s->cap = cap;
+	}
+	memcpy(s->buf + s->len, chunk, (size_t)r);
+	s->len += (size_t)r;
+
+	size_t start = 0;
+	for (size_t i = 0; i < s->len; i++) {
+		if (s->buf[i] != '\n') continue;
+		s->buf[i] = '\0';
+		if (!session_command(s, s->buf + start)) {
+			session_close(ep, s);
+			return;
+		}
+		start = i + 1;
+	}
+	memmove(s->buf, s->buf + start, s->len - start);
+	s->len -= start;
+}
+
+int server_run(const char *socket_path, int threads) {
+	if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if (threads <= 0) threads = 1;
+	signal(SIGPIPE, SIG_IGN);
+
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+		fprintf(stderr, "socket path too long: %s\n", socket_path);
+		return 1;
+	}
+	strcpy(addr.sun_path, socket_path);
+
+	int lfd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (lfd < 0) {
+		perror("socket");
+		return 1;
+	}
+	unlink(socket_path);
+	if (bind(lfd, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+	    listen(lfd, 128) < 0) {
+		perror(socket_path);
+		close(lfd);
+		return 1;
+	}
+
+	int ep = epoll_create1(0);
+	struct epoll_event ev;
+	ev.events = EPOLLIN;
+	ev.data.ptr = NULL;
+	if (ep < 0 || epoll_ctl(ep, EPOLL_CTL_ADD, lfd, &ev) < 0) {
+		perror("epoll");
+		close(lfd);
+		return 1;
+	}
+
+	for (int i = 0; i < threads; i++) {
+		pthread_t tid;
+		if (pthread_create(&tid, NULL, server_worker, NULL) != 0) {
+			perror("pthread_create");
+			return 1;
+		}
+		pthread_detach(tid);
+	}
+
+	printf("GCE server listening on %s (%d search threads)\n",
+	       socket_path, threads);
+	fflush(stdout);
+
+	struct epoll_event events[SERVER_MAX_EVENTS];
+	for (;;) {
+		int n = epoll_wait(ep, events, SERVER_MAX_EVENTS, -1);
+		if (n < 0) {
+			if (errno == EINTR) continue;
+			perror("epoll_wait");
+			break;
+		}
+		for (int i = 0; i < n; i++) {
+			if (events[i].data.ptr == NULL) {
+				int fd = accept(lfd, NULL, NULL);
+				if (fd >= 0) session_open(ep, fd);
+			} else {
+				/* Reading may free the session, so write first */
+				Session *s = events[i].data.ptr;
+				if (events[i].events & EPOLLOUT) session_writable(s);
+				if (events[i].events & ~(uint32_t)EPOLLOUT)
+					session_readable(ep, s);
+			}
+		}
+	}
+	close(ep);
+	close(lfd);
+	unlink(socket_path);
+	return 1;
+}
+
+#else
+
+int server_run(const char *socket_path, int threads) {
+	(void)socket_path;
+	(void)threads;
+	fprintf(stderr, "Server mode requires Linux (epoll)\n");
+	return 1;
+}
+
+#endif
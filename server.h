@@ -0,0 +1,6 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+int server_run(const char *socket_path, int threads);
+
+#endif
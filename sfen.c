@@ -0,0 +1,133 @@
+#define _POSIX_C_SOURCE 200809L
+#include "sfen.h"
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* Records are read in place from mapped files, so the layout must not
+ * pick up padding */
+typedef char sfen_record_size_check[sizeof(SfenRecord) == SFEN_RECORD_SIZE ? 1 : -1];
+
+void sfen_pack(const Position *p, PackedPos *out) {
+	memset(out, 0, sizeof(*out));
+	uint8_t code[64];
+	Bitboard occ = 0;
+	for (int c = WHITE; c <= BLACK; c++)
+		for (int pt = PAWN; pt <= KING; pt++)
+			for (Bitboard b = p->pieces[c][pt]; b; b &= b - 1) {
+				int sq = __builtin_ctzll(b);
+				code[sq] = (uint8_t)(c << 3 | pt);
+				occ |= 1ULL << sq;
+			}
+	for (int i = 0; i < 8; i++)
+		out->occupied[i] = (uint8_t)(occ >> (8 * i));
+
+	int n = 0;
+	for (Bitboard b = occ; b && n < 32; b &= b - 1, n++)
+		out->pieces[n / 2] |= (uint8_t)(code[__builtin_ctzll(b)] << (4 * (n & 1)));
+
+	out->side_castle = (uint8_t)((p->white_turn ? 0 : 1) | (p->castling & 0xF) << 1);
+	int ep = p->en_passant >= 0 ? SQ_FILE(p->en_passant) + 1 : 0;
+	int fullmove = p->fullmove < 4095 ? p->fullmove : 4095;
+	out->ep_fullmove = (uint8_t)(ep | (fullmove >> 8) << 4);
+	out->halfmove = (uint8_t)(p->halfmove < 255 ? p->halfmove : 255);
+	out->fullmove = (uint8_t)(fullmove & 0xFF);
+}
+
+#define BACK_RANKS 0xFF000000000000FFULL
+
+/* Rebuilds a full Position, hash keys included. False on a malformed
+ * record: bad piece codes, not exactly one king per side, pawns on the
+ * back ranks, or an en passant square without the pawn that just
+ * double-pushed past it. */
+bool sfen_unpack(const PackedPos *pp, Position *p) {
+	memset(p, 0, sizeof(*p));
+	Bitboard occ = 0;
+	for (int i = 0; i < 8; i++)
+		occ |= (Bitboard)pp->occupied[i] << (8 * i);
+	if (__builtin_popcountll(occ) > 32) return false;
+
+	int n = 0;
+	for (Bitboard b = occ; b; b &= b - 1, n++) {
+		int code = pp->pieces[n / 2] >> (4 * (n & 1)) & 0xF;
+		if ((code & 7) > KING) return false;
+		p->pieces[code >> 3][code & 7] |= b & -b;
+	}
+
+	p->white_turn = !(pp->side_castle & 1);
+	p->castling = (uint8_t)(pp->side_castle >> 1 & 0xF);
+	int ep = pp->ep_fullmove & 0xF;
+	if (ep > 8) return false;
+	p->en_passant = ep ? (p->white_turn ? 40 : 16) + ep - 1 : -1;
+
+	for (int c = WHITE; c <= BLACK; c++)
+		if (__builtin_popcountll(p->pieces[c][KING]) != 1) return false;
+	if ((p->pieces[WHITE][PAWN] | p->pieces[BLACK][PAWN]) & BACK_RANKS)
+		return false;
+	if (ep) {
+		/* The pushed pawn is just past the square; the square and
+		 * the one the pawn came from are empty */
+		int sq = p->en_passant, step = p->white_turn ? -8 : 8;
+		Color pusher = p->white_turn ? BLACK : WHITE;
+		if (!(p->pieces[pusher][PAWN] & (1ULL << (sq + step)))
+		    || (occ & (1ULL << sq | 1ULL << (sq - step))))
+			return false;
+	}
+	p->halfmove = pp->halfmove;
+	p->fullmove = (pp->ep_fullmove >> 4) << 8 | pp->fullmove;
+	p->hash = compute_hash(p);
+	p->material_key = compute_material_key(p);
+	return true;
+}
+
+void sfen_record(const Position *p, int score, int ply, SfenRecord *out) {
+	sfen_pack(p, &out->pos);
+	if (score > 32000) score = 32000;
+	if (score < -32000) score = -32000;
+	uint16_t s = (uint16_t)(int16_t)score;
+	out->score[0] = (uint8_t)(s & 0xFF);
+	out->score[1] = (uint8_t)(s >> 8);
+	out->result = 0;
+	out->ply = (uint8_t)(ply < 255 ? ply : 255);
+}
+
+int sfen_score(const SfenRecord *r) {
+	return (int16_t)(uint16_t)(r->score[0] | r->score[1] << 8);
+}
+
+/* A trailing partial record, as left by an interrupted writer, is
+ * ignored */
+bool sfen_open(SfenFile *f, const char *path) {
+	f->records = NULL;
+	f->count = 0;
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) return false;
+	struct stat st;
+	if (fstat(fd, &st) < 0) {
+		close(fd);
+		return false;
+	}
+	size_t count = (size_t)st.st_size / SFEN_RECORD_SIZE;
+	if (count > 0) {
+		void *m = mmap(NULL, count * SFEN_RECORD_SIZE, PROT_READ, MAP_PRIVATE,
+		               fd, 0);
+		if (m == MAP_FAILED) {
+			close(fd);
+			return false;
+		}
+		posix_madvise(m, count * SFEN_RECORD_SIZE, POSIX_MADV_SEQUENTIAL);
+		f->records = m;
+		f->count = count;
+	}
+	close(fd);
+	return true;
+}
+
+void sfen_close(SfenFile *f) {
+	if (f->records)
+		munmap((void *)f->records, f->count * SFEN_RECORD_SIZE);
+	f->records = NULL;
+	f->count = 0;
+}
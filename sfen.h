@@ -0,0 +1,45 @@
+#ifndef SFEN_H
+#define SFEN_H
+
+#include "board.h"
+#include <stddef.h>
+
+/*
+ * Packed training position, 28 bytes. Multi-byte fields are stored
+ * little-endian byte by byte, so files are portable between hosts.
+ */
+typedef struct {
+	uint8_t occupied[8];   /* occupancy bitboard */
+	uint8_t pieces[16];    /* one nibble (colour << 3 | type) per occupied
+	                          square in a1..h8 order, low nibble first */
+	uint8_t side_castle;   /* bit 0: black to move, bits 1-4: castling */
+	uint8_t ep_fullmove;   /* bits 0-3: ep file + 1, bits 4-7: fullmove >> 8 */
+	uint8_t halfmove;
+	uint8_t fullmove;      /* fullmove & 0xFF */
+} PackedPos;
+
+/* Self-play training record, 32 bytes */
+typedef struct {
+	PackedPos pos;
+	uint8_t   score[2];    /* int16 search score, side to move's view */
+	int8_t    result;      /* 1 win, 0 draw, -1 loss for the side to move */
+	uint8_t   ply;         /* game ply, saturated at 255 */
+} SfenRecord;
+
+#define SFEN_RECORD_SIZE 32
+
+/* Read-only memory-mapped record file; records are used in place */
+typedef struct {
+	const SfenRecord *records;
+	size_t            count;
+} SfenFile;
+
+void sfen_pack(const Position *p, PackedPos *out);
+bool sfen_unpack(const PackedPos *pp, Position *p);
+void sfen_record(const Position *p, int score, int ply, SfenRecord *out);
+int  sfen_score(const SfenRecord *r);
+
+bool sfen_open(SfenFile *f, const char *path);
+void sfen_close(SfenFile *f);
+
+#endif
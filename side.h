@@ -0,0 +1,34 @@
+/*
+ * Per-side constants for code templates. A template includes this file
+ * first and is itself included twice, after "#define WHITE_SIDE 1" and
+ * after "#define WHITE_SIDE 0", so every colour test folds to a
+ * constant. No include guard on purpose.
+ */
+#undef US
+#undef THEM
+#undef SIDED
+#undef UP
+#undef REL_SQ
+#undef REL_RANK
+#undef BACKMOST
+#undef FORWARD_RANKS
+
+#if WHITE_SIDE
+#define US                WHITE
+#define THEM              BLACK
+#define SIDED(name)       name##_white
+#define UP                8
+#define BACKMOST(bb)      __builtin_ctzll(bb)
+#define FORWARD_RANKS(sq) ((~0ULL << ((sq) & 56)) << 8)
+#else
+#define US                BLACK
+#define THEM              WHITE
+#define SIDED(name)       name##_black
+#define UP                (-8)
+#define BACKMOST(bb)      (63 - __builtin_clzll(bb))
+#define FORWARD_RANKS(sq) ((1ULL << ((sq) & 56)) - 1)
+#endif
+
+/* Square or rank as seen from US: a1 and rank 0 are on its back rank */
+#define REL_SQ(sq)        ((sq) ^ (WHITE_SIDE ? 0 : 56))
+#define REL_RANK(r)       ((r) ^ (WHITE_SIDE ? 0 : 7))
@@ -0,0 +1,89 @@
+#include "stats.h"
+#include <stdio.h>
+
+static double pct(uint64_t part, uint64_t whole) {
+	return whole ? 100.0 * (double)part / (double)whole : 0.0;
+}
+
+/* Nodes of iteration d over those of d - 1, or 0 when unknown */
+static double branching(const SearchStats *st, int d) {
+	if (d < 2 || d > st->iterations) return 0.0;
+	uint64_t prev = st->iter_nodes[d - 1] - (d >= 3 ? st->iter_nodes[d - 2] : 0);
+	uint64_t cur  = st->iter_nodes[d] - st->iter_nodes[d - 1];
+	return prev ? (double)cur / (double)prev : 0.0;
+}
+
+/* One line for "info string", latest iteration's branching factor */
+int stats_line(const SearchStats *st, uint64_t nodes, char *out) {
+	return sprintf(out, "stats seldepth %d tthit %.1f%% ttcut %.1f%% "
+	               "firstcut %.1f%% nullcut %.1f%% lmrre %.1f%% qnodes %.1f%% "
+	               "ebf %.2f",
+	               st->seldepth, pct(st->tt_hits, st->tt_probes),
+	               pct(st->tt_cutoffs, st->tt_probes),
+	               pct(st->first_move_fail_highs, st->fail_highs),
+	               pct(st->null_cutoffs, st->null_tries),
+	               pct(st->lmr_researches, st->lmr_searches),
+	               pct(st->qnodes, nodes), branching(st, st->iterations));
+}
+
+int stats_json(const SearchStats *st, uint64_t nodes, char *out) {
+	int n = sprintf(out, "{\"nodes\":%llu,\"qnodes\":%llu,\"seldepth\":%d,"
+	                "\"tt_probes\":%llu,\"tt_hits\":%llu,\"tt_cutoffs\":%llu,"
+	                "\"fail_highs\":%llu,\"first_move_fail_highs\":%llu,"
+	                "\"null_tries\":%llu,\"null_cutoffs\":%llu,"
+	                "\"lmr_searches\":%llu,\"lmr_researches\":%llu,\"ebf\":[",
+	                (unsigned long long)nodes, (unsigned long long)st->qnodes,
+	                st->seldepth,
+	                (unsigned long long)st->tt_probes,
+	                (unsigned long long)st->tt_hits,
+	                (unsigned long long)st->tt_cutoffs,
+	                (unsigned long long)st->fail_highs,
+	                (unsigned long long)st->first_move_fail_highs,
+	                (unsigned long long)st->null_tries,
+	                (unsigned long long)st->null_cutoffs,
+	                (unsigned long long)st->lmr_searches,
+	                (unsigned long long)st->lmr_researches);
+	for (int d = 2; d <= st->iterations; d++)
+		n += sprintf(out + n, "%s%.2f", d > 2 ? "," : "", branching(st, d));
+	return n + sprintf(out + n, "]}");
+}
+
+void stats_print(const SearchStats *st, uint64_t nodes) {
+	printf("Nodes:          %llu (%.1f%% quiescence)\n",
+	       (unsigned long long)nodes, pct(st->qnodes, nodes));
+	printf("Seldepth:       %d\n", st->seldepth);
+	printf("TT hits:        %.1f%% of %llu probes, %.1f%% cut off\n",
+	       pct(st->tt_hits, st->tt_probes), (unsigned long long)st->tt_probes,
+	       pct(st->tt_cutoffs, st->tt_probes));
+	printf("First-move cut: %.1f%% of %llu fail-highs\n",
+	       pct(st->first_move_fail_highs, st->fail_highs),
+	       (unsigned long long)st->fail_highs);
+	printf("Null move:      %.1f%% of %llu tries cut off\n",
+	       pct(st->null_cutoffs, st->null_tries),
+	       (unsigned long long)st->null_tries);
+	printf("LMR re-search:  %.1f%% of %llu reduced moves\n",
+	       pct(st->lmr_researches, st->lmr_searches),
+	       (unsigned long long)st->lmr_searches);
+	printf("Branching:     ");
+	for (int d = 2; d <= st->iterations; d++)
+		printf(" %d:%.2f", d, branching(st, d));
+	printf("\n\n");
+}
+
+void stats_add(SearchStats *sum, const SearchStats *st) {
+	sum->qnodes                += st->qnodes;
+	sum->tt_probes             += st->tt_probes;
+	sum->tt_hits               += st->tt_hits;
+	sum->tt_cutoffs            += st->tt_cutoffs;
+	sum->fail_highs            += st->fail_highs;
+	sum->first_move_fail_highs += st->first_move_fail_highs;
+	sum->null_tries            += st->null_tries;
+	sum->null_cutoffs          += st->null_cutoffs;
+	sum->lmr_searches          += st->lmr_searches;
+	sum->lmr_researches        += st->lmr_researches;
+	if (st->seldepth > sum->seldepth) sum->seldepth = st->seldepth;
+	/* Per-depth totals, so searches that stopped early weigh less */
+	for (int d = 1; d <= st->iterations; d++)
+		sum->iter_nodes[d] += st->iter_nodes[d];
+	if (st->iterations > sum->iterations) sum->iterations = st->iterations;
+}
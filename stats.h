@@ -0,0 +1,30 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include "engine.h"
+
+/*
+ * Search statistics. The counters in SearchStats are only touched when
+ * the engine is built with -DGCE_STATS ("make CFLAGS+=-DGCE_STATS");
+ * otherwise the STAT_* macros vanish and the search runs unchanged.
+ */
+#ifdef GCE_STATS
+#define STATS_ENABLED 1
+#define STAT_INC(s, f)    ((s)->stats.f++)
+#define STAT_MAX(s, f, v) ((s)->stats.f < (v) ? (void)((s)->stats.f = (v)) : (void)0)
+#else
+#define STATS_ENABLED 0
+#define STAT_INC(s, f)    ((void)0)
+#define STAT_MAX(s, f, v) ((void)0)
+#endif
+
+/* stats_line and stats_json return the length written; out needs
+ * STATS_BUF_SIZE bytes */
+#define STATS_BUF_SIZE 2048
+
+int  stats_line(const SearchStats *st, uint64_t nodes, char *out);
+int  stats_json(const SearchStats *st, uint64_t nodes, char *out);
+void stats_print(const SearchStats *st, uint64_t nodes);
+void stats_add(SearchStats *sum, const SearchStats *st);
+
+#endif
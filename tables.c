@@ -0,0 +1,4203 @@
+/* Generated by gentables; do not edit */
+#include "tables.h"
+
+const Bitboard pawn_attack_table[2][64] = {
+	{
+		0x0000000000000200ULL, 0x0000000000000500ULL, 0x0000000000000a00ULL, 0x0000000000001400ULL,
+		0x0000000000002800ULL, 0x0000000000005000ULL, 0x000000000000a000ULL, 0x0000000000004000ULL,
+		0x0000000000020000ULL, 0x0000000000050000ULL, 0x00000000000a0000ULL, 0x0000000000140000ULL,
+		0x0000000000280000ULL, 0x0000000000500000ULL, 0x0000000000a00000ULL, 0x0000000000400000ULL,
+		0x0000000002000000ULL, 0x0000000005000000ULL, 0x000000000a000000ULL, 0x0000000014000000ULL,
+		0x0000000028000000ULL, 0x0000000050000000ULL, 0x00000000a0000000ULL, 0x0000000040000000ULL,
+		0x0000000200000000ULL, 0x0000000500000000ULL, 0x0000000a00000000ULL, 0x0000001400000000ULL,
+		0x0000002800000000ULL, 0x0000005000000000ULL, 0x000000a000000000ULL, 0x0000004000000000ULL,
+		0x0000020000000000ULL, 0x0000050000000000ULL, 0x00000a0000000000ULL, 0x0000140000000000ULL,
+		0x0000280000000000ULL, 0x0000500000000000ULL, 0x0000a00000000000ULL, 0x0000400000000000ULL,
+		0x0002000000000000ULL, 0x0005000000000000ULL, 0x000a000000000000ULL, 0x0014000000000000ULL,
+		0x0028000000000000ULL, 0x0050000000000000ULL, 0x00a0000000000000ULL, 0x0040000000000000ULL,
+		0x0200000000000000ULL, 0x0500000000000000ULL, 0x0a00000000000000ULL, 0x1400000000000000ULL,
+		0x2800000000000000ULL, 0x5000000000000000ULL, 0xa000000000000000ULL, 0x4000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000002ULL, 0x0000000000000005ULL, 0x000000000000000aULL, 0x0000000000000014ULL,
+		0x0000000000000028ULL, 0x0000000000000050ULL, 0x00000000000000a0ULL, 0x0000000000000040ULL,
+		0x0000000000000200ULL, 0x0000000000000500ULL, 0x0000000000000a00ULL, 0x0000000000001400ULL,
+		0x0000000000002800ULL, 0x0000000000005000ULL, 0x000000000000a000ULL, 0x0000000000004000ULL,
+		0x0000000000020000ULL, 0x0000000000050000ULL, 0x00000000000a0000ULL, 0x0000000000140000ULL,
+		0x0000000000280000ULL, 0x0000000000500000ULL, 0x0000000000a00000ULL, 0x0000000000400000ULL,
+		0x0000000002000000ULL, 0x0000000005000000ULL, 0x000000000a000000ULL, 0x0000000014000000ULL,
+		0x0000000028000000ULL, 0x0000000050000000ULL, 0x00000000a0000000ULL, 0x0000000040000000ULL,
+		0x0000000200000000ULL, 0x0000000500000000ULL, 0x0000000a00000000ULL, 0x0000001400000000ULL,
+		0x0000002800000000ULL, 0x0000005000000000ULL, 0x000000a000000000ULL, 0x0000004000000000ULL,
+		0x0000020000000000ULL, 0x0000050000000000ULL, 0x00000a0000000000ULL, 0x0000140000000000ULL,
+		0x0000280000000000ULL, 0x0000500000000000ULL, 0x0000a00000000000ULL, 0x0000400000000000ULL,
+		0x0002000000000000ULL, 0x0005000000000000ULL, 0x000a000000000000ULL, 0x0014000000000000ULL,
+		0x0028000000000000ULL, 0x0050000000000000ULL, 0x00a0000000000000ULL, 0x0040000000000000ULL
+	}
+};
+
+const Bitboard knight_attack_table[64] = {
+	0x0000000000020400ULL, 0x0000000000050800ULL, 0x00000000000a1100ULL, 0x0000000000142200ULL,
+	0x0000000000284400ULL, 0x0000000000508800ULL, 0x0000000000a01000ULL, 0x0000000000402000ULL,
+	0x0000000002040004ULL, 0x0000000005080008ULL, 0x000000000a110011ULL, 0x0000000014220022ULL,
+	0x0000000028440044ULL, 0x0000000050880088ULL, 0x00000000a0100010ULL, 0x0000000040200020ULL,
+	0x0000000204000402ULL, 0x0000000508000805ULL, 0x0000000a1100110aULL, 0x0000001422002214ULL,
+	0x0000002844004428ULL, 0x0000005088008850ULL, 0x000000a0100010a0ULL, 0x0000004020002040ULL,
+	0x0000020400040200ULL, 0x0000050800080500ULL, 0x00000a1100110a00ULL, 0x0000142200221400ULL,
+	0x0000284400442800ULL, 0x0000508800885000ULL, 0x0000a0100010a000ULL, 0x0000402000204000ULL,
+	0x0002040004020000ULL, 0x0005080008050000ULL, 0x000a1100110a0000ULL, 0x0014220022140000ULL,
+	0x0028440044280000ULL, 0x0050880088500000ULL, 0x00a0100010a00000ULL, 0x0040200020400000ULL,
+	0x0204000402000000ULL, 0x0508000805000000ULL, 0x0a1100110a000000ULL, 0x1422002214000000ULL,
+	0x2844004428000000ULL, 0x5088008850000000ULL, 0xa0100010a0000000ULL, 0x4020002040000000ULL,
+	0x0400040200000000ULL, 0x0800080500000000ULL, 0x1100110a00000000ULL, 0x2200221400000000ULL,
+	0x4400442800000000ULL, 0x8800885000000000ULL, 0x100010a000000000ULL, 0x2000204000000000ULL,
+	0x0004020000000000ULL, 0x0008050000000000ULL, 0x00110a0000000000ULL, 0x0022140000000000ULL,
+	0x0044280000000000ULL, 0x0088500000000000ULL, 0x0010a00000000000ULL, 0x0020400000000000ULL
+};
+
+const Bitboard king_attack_table[64] = {
+	0x0000000000000302ULL, 0x0000000000000705ULL, 0x0000000000000e0aULL, 0x0000000000001c14ULL,
+	0x0000000000003828ULL, 0x0000000000007050ULL, 0x000000000000e0a0ULL, 0x000000000000c040ULL,
+	0x0000000000030203ULL, 0x0000000000070507ULL, 0x00000000000e0a0eULL, 0x00000000001c141cULL,
+	0x0000000000382838ULL, 0x0000000000705070ULL, 0x0000000000e0a0e0ULL, 0x0000000000c040c0ULL,
+	0x0000000003020300ULL, 0x0000000007050700ULL, 0x000000000e0a0e00ULL, 0x000000001c141c00ULL,
+	0x0000000038283800ULL, 0x0000000070507000ULL, 0x00000000e0a0e000ULL, 0x00000000c040c000ULL,
+	0x0000000302030000ULL, 0x0000000705070000ULL, 0x0000000e0a0e0000ULL, 0x0000001c141c0000ULL,
+	0x0000003828380000ULL, 0x0000007050700000ULL, 0x000000e0a0e00000ULL, 0x000000c040c00000ULL,
+	0x0000030203000000ULL, 0x0000070507000000ULL, 0x00000e0a0e000000ULL, 0x00001c141c000000ULL,
+	0x0000382838000000ULL, 0x0000705070000000ULL, 0x0000e0a0e0000000ULL, 0x0000c040c0000000ULL,
+	0x0003020300000000ULL, 0x0007050700000000ULL, 0x000e0a0e00000000ULL, 0x001c141c00000000ULL,
+	0x0038283800000000ULL, 0x0070507000000000ULL, 0x00e0a0e000000000ULL, 0x00c040c000000000ULL,
+	0x0302030000000000ULL, 0x0705070000000000ULL, 0x0e0a0e0000000000ULL, 0x1c141c0000000000ULL,
+	0x3828380000000000ULL, 0x7050700000000000ULL, 0xe0a0e00000000000ULL, 0xc040c00000000000ULL,
+	0x0203000000000000ULL, 0x0507000000000000ULL, 0x0a0e000000000000ULL, 0x141c000000000000ULL,
+	0x2838000000000000ULL, 0x5070000000000000ULL, 0xa0e0000000000000ULL, 0x40c0000000000000ULL
+};
+
+const Bitboard bishop_pseudo_table[64] = {
+	0x8040201008040200ULL, 0x0080402010080500ULL, 0x0000804020110a00ULL, 0x0000008041221400ULL,
+	0x0000000182442800ULL, 0x0000010204885000ULL, 0x000102040810a000ULL, 0x0102040810204000ULL,
+	0x4020100804020002ULL, 0x8040201008050005ULL, 0x00804020110a000aULL, 0x0000804122140014ULL,
+	0x0000018244280028ULL, 0x0001020488500050ULL, 0x0102040810a000a0ULL, 0x0204081020400040ULL,
+	0x2010080402000204ULL, 0x4020100805000508ULL, 0x804020110a000a11ULL, 0x0080412214001422ULL,
+	0x0001824428002844ULL, 0x0102048850005088ULL, 0x02040810a000a010ULL, 0x0408102040004020ULL,
+	0x1008040200020408ULL, 0x2010080500050810ULL, 0x4020110a000a1120ULL, 0x8041221400142241ULL,
+	0x0182442800284482ULL, 0x0204885000508804ULL, 0x040810a000a01008ULL, 0x0810204000402010ULL,
+	0x0804020002040810ULL, 0x1008050005081020ULL, 0x20110a000a112040ULL, 0x4122140014224180ULL,
+	0x8244280028448201ULL, 0x0488500050880402ULL, 0x0810a000a0100804ULL, 0x1020400040201008ULL,
+	0x0402000204081020ULL, 0x0805000508102040ULL, 0x110a000a11204080ULL, 0x2214001422418000ULL,
+	0x4428002844820100ULL, 0x8850005088040201ULL, 0x10a000a010080402ULL, 0x2040004020100804ULL,
+	0x0200020408102040ULL, 0x0500050810204080ULL, 0x0a000a1120408000ULL, 0x1400142241800000ULL,
+	0x2800284482010000ULL, 0x5000508804020100ULL, 0xa000a01008040201ULL, 0x4000402010080402ULL,
+	0x0002040810204080ULL, 0x0005081020408000ULL, 0x000a112040800000ULL, 0x0014224180000000ULL,
+	0x0028448201000000ULL, 0x0050880402010000ULL, 0x00a0100804020100ULL, 0x0040201008040201ULL
+};
+
+const Bitboard rook_pseudo_table[64] = {
+	0x01010101010101feULL, 0x02020202020202fdULL, 0x04040404040404fbULL, 0x08080808080808f7ULL,
+	0x10101010101010efULL, 0x20202020202020dfULL, 0x40404040404040bfULL, 0x808080808080807fULL,
+	0x010101010101fe01ULL, 0x020202020202fd02ULL, 0x040404040404fb04ULL, 0x080808080808f708ULL,
+	0x101010101010ef10ULL, 0x202020202020df20ULL, 0x404040404040bf40ULL, 0x8080808080807f80ULL,
+	0x0101010101fe0101ULL, 0x0202020202fd0202ULL, 0x0404040404fb0404ULL, 0x0808080808f70808ULL,
+	0x1010101010ef1010ULL, 0x2020202020df2020ULL, 0x4040404040bf4040ULL, 0x80808080807f8080ULL,
+	0x01010101fe010101ULL, 0x02020202fd020202ULL, 0x04040404fb040404ULL, 0x08080808f7080808ULL,
+	0x10101010ef101010ULL, 0x20202020df202020ULL, 0x40404040bf404040ULL, 0x808080807f808080ULL,
+	0x010101fe01010101ULL, 0x020202fd02020202ULL, 0x040404fb04040404ULL, 0x080808f708080808ULL,
+	0x101010ef10101010ULL, 0x202020df20202020ULL, 0x404040bf40404040ULL, 0x8080807f80808080ULL,
+	0x0101fe0101010101ULL, 0x0202fd0202020202ULL, 0x0404fb0404040404ULL, 0x0808f70808080808ULL,
+	0x1010ef1010101010ULL, 0x2020df2020202020ULL, 0x4040bf4040404040ULL, 0x80807f8080808080ULL,
+	0x01fe010101010101ULL, 0x02fd020202020202ULL, 0x04fb040404040404ULL, 0x08f7080808080808ULL,
+	0x10ef101010101010ULL, 0x20df202020202020ULL, 0x40bf404040404040ULL, 0x807f808080808080ULL,
+	0xfe01010101010101ULL, 0xfd02020202020202ULL, 0xfb04040404040404ULL, 0xf708080808080808ULL,
+	0xef10101010101010ULL, 0xdf20202020202020ULL, 0xbf40404040404040ULL, 0x7f80808080808080ULL
+};
+
+const Bitboard between_table[64][64] = {
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL, 0x0000000000000006ULL,
+		0x000000000000000eULL, 0x000000000000001eULL, 0x000000000000003eULL, 0x000000000000007eULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000100ULL, 0x0000000000000000ULL, 0x0000000000000200ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000040200ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000001010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000101010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000001008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000010101010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000201008040200ULL, 0x0000000000000000ULL,
+		0x0001010101010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040201008040200ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000004ULL,
+		0x000000000000000cULL, 0x000000000000001cULL, 0x000000000000003cULL, 0x000000000000007cULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000200ULL, 0x0000000000000000ULL, 0x0000000000000400ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000020200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000080400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000002020200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000010080400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000202020200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002010080400ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000020202020200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000402010080400ULL,
+		0x0000000000000000ULL, 0x0002020202020200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000008ULL, 0x0000000000000018ULL, 0x0000000000000038ULL, 0x0000000000000078ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000200ULL, 0x0000000000000000ULL, 0x0000000000000400ULL, 0x0000000000000000ULL,
+		0x0000000000000800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000040400ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000100800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004040400ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020100800ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000404040400ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020100800ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040404040400ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004040404040400ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000006ULL, 0x0000000000000004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000010ULL, 0x0000000000000030ULL, 0x0000000000000070ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000400ULL, 0x0000000000000000ULL, 0x0000000000000800ULL,
+		0x0000000000000000ULL, 0x0000000000001000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000020400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000080800ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000201000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008080800ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040201000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000808080800ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080808080800ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080808080800ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x000000000000000eULL, 0x000000000000000cULL, 0x0000000000000008ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000020ULL, 0x0000000000000060ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000800ULL, 0x0000000000000000ULL,
+		0x0000000000001000ULL, 0x0000000000000000ULL, 0x0000000000002000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000040800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000402000ULL,
+		0x0000000002040800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000010101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000001010101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000101010101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0010101010101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x000000000000001eULL, 0x000000000000001cULL, 0x0000000000000018ULL, 0x0000000000000010ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000040ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000001000ULL,
+		0x0000000000000000ULL, 0x0000000000002000ULL, 0x0000000000000000ULL, 0x0000000000004000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000081000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000202000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000004081000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000020202000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000204081000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000002020202000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000202020202000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0020202020202000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x000000000000003eULL, 0x000000000000003cULL, 0x0000000000000038ULL, 0x0000000000000030ULL,
+		0x0000000000000020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000002000ULL, 0x0000000000000000ULL, 0x0000000000004000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000102000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000404000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008102000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040404000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000408102000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004040404000ULL, 0x0000000000000000ULL,
+		0x0000020408102000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000404040404000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404040404000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x000000000000007eULL, 0x000000000000007cULL, 0x0000000000000078ULL, 0x0000000000000070ULL,
+		0x0000000000000060ULL, 0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000000000008000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000204000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000808000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010204000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000080808000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000810204000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080808000ULL,
+		0x0000000000000000ULL, 0x0000040810204000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000808080808000ULL,
+		0x0002040810204000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080808080808000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000200ULL, 0x0000000000000600ULL,
+		0x0000000000000e00ULL, 0x0000000000001e00ULL, 0x0000000000003e00ULL, 0x0000000000007e00ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000010000ULL, 0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000001010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004020000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000101010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000804020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000010101010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000100804020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001010101010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100804020000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000400ULL,
+		0x0000000000000c00ULL, 0x0000000000001c00ULL, 0x0000000000003c00ULL, 0x0000000000007c00ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000000000ULL, 0x0000000000040000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000002020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000202020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000001008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000020202020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000201008040000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0002020202020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040201008040000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000800ULL, 0x0000000000001800ULL, 0x0000000000003800ULL, 0x0000000000007800ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000020000ULL, 0x0000000000000000ULL, 0x0000000000040000ULL, 0x0000000000000000ULL,
+		0x0000000000080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004040000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000010080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000404040000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002010080000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040404040000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000402010080000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004040404040000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000600ULL, 0x0000000000000400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000001000ULL, 0x0000000000003000ULL, 0x0000000000007000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000040000ULL, 0x0000000000000000ULL, 0x0000000000080000ULL,
+		0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000002040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008080000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020100000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000808080000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020100000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080808080000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080808080000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000e00ULL, 0x0000000000000c00ULL, 0x0000000000000800ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000002000ULL, 0x0000000000006000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000080000ULL, 0x0000000000000000ULL,
+		0x0000000000100000ULL, 0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000004080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040200000ULL,
+		0x0000000204080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000001010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000101010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0010101010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000001e00ULL, 0x0000000000001c00ULL, 0x0000000000001800ULL, 0x0000000000001000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000004000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL,
+		0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000000000ULL, 0x0000000000400000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008100000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000020200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000408100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000002020200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000020408100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000202020200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0020202020200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000003e00ULL, 0x0000000000003c00ULL, 0x0000000000003800ULL, 0x0000000000003000ULL,
+		0x0000000000002000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000200000ULL, 0x0000000000000000ULL, 0x0000000000400000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010200000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040400000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000810200000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004040400000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000040810200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000404040400000ULL, 0x0000000000000000ULL,
+		0x0002040810200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404040400000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000007e00ULL, 0x0000000000007c00ULL, 0x0000000000007800ULL, 0x0000000000007000ULL,
+		0x0000000000006000ULL, 0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000400000ULL, 0x0000000000000000ULL, 0x0000000000800000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000020400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000080800000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001020400000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080800000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000081020400000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000808080800000ULL,
+		0x0000000000000000ULL, 0x0004081020400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080808080800000ULL
+	},
+	{
+		0x0000000000000100ULL, 0x0000000000000000ULL, 0x0000000000000200ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000060000ULL,
+		0x00000000000e0000ULL, 0x00000000001e0000ULL, 0x00000000003e0000ULL, 0x00000000007e0000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000001000000ULL, 0x0000000000000000ULL, 0x0000000002000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000101000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000402000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000010101000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000080402000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001010101000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0010080402000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000200ULL, 0x0000000000000000ULL, 0x0000000000000400ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000040000ULL,
+		0x00000000000c0000ULL, 0x00000000001c0000ULL, 0x00000000003c0000ULL, 0x00000000007c0000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000002000000ULL, 0x0000000000000000ULL, 0x0000000004000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000202000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000804000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000020202000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000100804000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0002020202000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100804000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000200ULL, 0x0000000000000000ULL, 0x0000000000000400ULL, 0x0000000000000000ULL,
+		0x0000000000000800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000080000ULL, 0x0000000000180000ULL, 0x0000000000380000ULL, 0x0000000000780000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000002000000ULL, 0x0000000000000000ULL, 0x0000000004000000ULL, 0x0000000000000000ULL,
+		0x0000000008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000404000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000001008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040404000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000201008000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004040404000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040201008000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000400ULL, 0x0000000000000000ULL, 0x0000000000000800ULL,
+		0x0000000000000000ULL, 0x0000000000001000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000060000ULL, 0x0000000000040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000300000ULL, 0x0000000000700000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000004000000ULL, 0x0000000000000000ULL, 0x0000000008000000ULL,
+		0x0000000000000000ULL, 0x0000000010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000204000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000808000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002010000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080808000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000402010000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080808000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000800ULL, 0x0000000000000000ULL,
+		0x0000000000001000ULL, 0x0000000000000000ULL, 0x0000000000002000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00000000000e0000ULL, 0x00000000000c0000ULL, 0x0000000000080000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000600000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008000000ULL, 0x0000000000000000ULL,
+		0x0000000010000000ULL, 0x0000000000000000ULL, 0x0000000020000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000408000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000001010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020000000ULL,
+		0x0000020408000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000101010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0010101010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000001000ULL,
+		0x0000000000000000ULL, 0x0000000000002000ULL, 0x0000000000000000ULL, 0x0000000000004000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00000000001e0000ULL, 0x00000000001c0000ULL, 0x0000000000180000ULL, 0x0000000000100000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000400000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010000000ULL,
+		0x0000000000000000ULL, 0x0000000020000000ULL, 0x0000000000000000ULL, 0x0000000040000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000810000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000002020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000040810000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000202020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0002040810000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0020202020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000002000ULL, 0x0000000000000000ULL, 0x0000000000004000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00000000003e0000ULL, 0x00000000003c0000ULL, 0x0000000000380000ULL, 0x0000000000300000ULL,
+		0x0000000000200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000020000000ULL, 0x0000000000000000ULL, 0x0000000040000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001020000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004040000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000081020000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000404040000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0004081020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404040000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000000000008000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00000000007e0000ULL, 0x00000000007c0000ULL, 0x0000000000780000ULL, 0x0000000000700000ULL,
+		0x0000000000600000ULL, 0x0000000000400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000040000000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000002040000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000102040000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000808080000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008102040000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080808080000000ULL
+	},
+	{
+		0x0000000000010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000020400ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000010000ULL, 0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002000000ULL, 0x0000000006000000ULL,
+		0x000000000e000000ULL, 0x000000001e000000ULL, 0x000000003e000000ULL, 0x000000007e000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000100000000ULL, 0x0000000000000000ULL, 0x0000000200000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000010100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040200000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001010100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0008040200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000020200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000040800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000000000ULL, 0x0000000000040000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004000000ULL,
+		0x000000000c000000ULL, 0x000000001c000000ULL, 0x000000003c000000ULL, 0x000000007c000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000200000000ULL, 0x0000000000000000ULL, 0x0000000400000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000020200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000080400000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0002020200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0010080400000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000040400ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000081000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000020000ULL, 0x0000000000000000ULL, 0x0000000000040000ULL, 0x0000000000000000ULL,
+		0x0000000000080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000002000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000008000000ULL, 0x0000000018000000ULL, 0x0000000038000000ULL, 0x0000000078000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000200000000ULL, 0x0000000000000000ULL, 0x0000000400000000ULL, 0x0000000000000000ULL,
+		0x0000000800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040400000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000100800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004040400000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100800000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000080800ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000102000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000040000ULL, 0x0000000000000000ULL, 0x0000000000080000ULL,
+		0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000006000000ULL, 0x0000000004000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000010000000ULL, 0x0000000030000000ULL, 0x0000000070000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000400000000ULL, 0x0000000000000000ULL, 0x0000000800000000ULL,
+		0x0000000000000000ULL, 0x0000001000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000020400000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080800000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000201000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080800000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040201000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000080400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000204000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000080000ULL, 0x0000000000000000ULL,
+		0x0000000000100000ULL, 0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x000000000e000000ULL, 0x000000000c000000ULL, 0x0000000008000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020000000ULL, 0x0000000060000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000800000000ULL, 0x0000000000000000ULL,
+		0x0000001000000000ULL, 0x0000000000000000ULL, 0x0000002000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000040800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000101000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000402000000000ULL,
+		0x0002040800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0010101000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100800ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000202000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL,
+		0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000000000ULL, 0x0000000000400000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x000000001e000000ULL, 0x000000001c000000ULL, 0x0000000018000000ULL, 0x0000000010000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001000000000ULL,
+		0x0000000000000000ULL, 0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000004000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000081000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000202000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0004081000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0020202000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000201000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000404000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000200000ULL, 0x0000000000000000ULL, 0x0000000000400000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x000000003e000000ULL, 0x000000003c000000ULL, 0x0000000038000000ULL, 0x0000000030000000ULL,
+		0x0000000020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000004000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000102000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000404000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008102000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000402000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000808000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000400000ULL, 0x0000000000000000ULL, 0x0000000000800000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x000000007e000000ULL, 0x000000007c000000ULL, 0x0000000078000000ULL, 0x0000000070000000ULL,
+		0x0000000060000000ULL, 0x0000000040000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000004000000000ULL, 0x0000000000000000ULL, 0x0000008000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000204000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000808000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010204000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080808000000000ULL
+	},
+	{
+		0x0000000001010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000002040800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000001010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002040000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000001000000ULL, 0x0000000000000000ULL, 0x0000000002000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000200000000ULL, 0x0000000600000000ULL,
+		0x0000000e00000000ULL, 0x0000001e00000000ULL, 0x0000003e00000000ULL, 0x0000007e00000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000010000000000ULL, 0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001010000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004020000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000002020200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000004081000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000002020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000004080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000002000000ULL, 0x0000000000000000ULL, 0x0000000004000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000400000000ULL,
+		0x0000000c00000000ULL, 0x0000001c00000000ULL, 0x0000003c00000000ULL, 0x0000007c00000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000000000000ULL, 0x0000040000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0002020000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0008040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004040400ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008102000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004040000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000008100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000002000000ULL, 0x0000000000000000ULL, 0x0000000004000000ULL, 0x0000000000000000ULL,
+		0x0000000008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000800000000ULL, 0x0000001800000000ULL, 0x0000003800000000ULL, 0x0000007800000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000020000000000ULL, 0x0000000000000000ULL, 0x0000040000000000ULL, 0x0000000000000000ULL,
+		0x0000080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004040000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0010080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008080800ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010204000ULL,
+		0x0000000004020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008080000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010200000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000004000000ULL, 0x0000000000000000ULL, 0x0000000008000000ULL,
+		0x0000000000000000ULL, 0x0000000010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000600000000ULL, 0x0000000400000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000001000000000ULL, 0x0000003000000000ULL, 0x0000007000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000040000000000ULL, 0x0000000000000000ULL, 0x0000080000000000ULL,
+		0x0000000000000000ULL, 0x0000100000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0002040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000010101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020400000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008000000ULL, 0x0000000000000000ULL,
+		0x0000000010000000ULL, 0x0000000000000000ULL, 0x0000000020000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000e00000000ULL, 0x0000000c00000000ULL, 0x0000000800000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002000000000ULL, 0x0000006000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080000000000ULL, 0x0000000000000000ULL,
+		0x0000100000000000ULL, 0x0000000000000000ULL, 0x0000200000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0004080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0010100000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040200000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000010080400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000020202000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010080000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000020200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010000000ULL,
+		0x0000000000000000ULL, 0x0000000020000000ULL, 0x0000000000000000ULL, 0x0000000040000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000001e00000000ULL, 0x0000001c00000000ULL, 0x0000001800000000ULL, 0x0000001000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100000000000ULL,
+		0x0000000000000000ULL, 0x0000200000000000ULL, 0x0000000000000000ULL, 0x0000400000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008100000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0020200000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020100800ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040404000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020100000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040400000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000020000000ULL, 0x0000000000000000ULL, 0x0000000040000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000003e00000000ULL, 0x0000003c00000000ULL, 0x0000003800000000ULL, 0x0000003000000000ULL,
+		0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000200000000000ULL, 0x0000000000000000ULL, 0x0000400000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010200000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040400000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040201000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000080808000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000080800000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000040000000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000007e00000000ULL, 0x0000007c00000000ULL, 0x0000007800000000ULL, 0x0000007000000000ULL,
+		0x0000006000000000ULL, 0x0000004000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000800000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0020400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080800000000000ULL
+	},
+	{
+		0x0000000101010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000204081000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000101010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000204080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000101000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000204000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000100000000ULL, 0x0000000000000000ULL, 0x0000000200000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000060000000000ULL,
+		0x00000e0000000000ULL, 0x00001e0000000000ULL, 0x00003e0000000000ULL, 0x00007e0000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001000000000000ULL, 0x0000000000000000ULL, 0x0002000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000202020200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000408102000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000202020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000408100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000202000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000408000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000200000000ULL, 0x0000000000000000ULL, 0x0000000400000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040000000000ULL,
+		0x00000c0000000000ULL, 0x00001c0000000000ULL, 0x00003c0000000000ULL, 0x00007c0000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0002000000000000ULL, 0x0000000000000000ULL, 0x0004000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000404040400ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000810204000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000404040000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000810200000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000404000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000810000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000200000000ULL, 0x0000000000000000ULL, 0x0000000400000000ULL, 0x0000000000000000ULL,
+		0x0000000800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000020000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000080000000000ULL, 0x0000180000000000ULL, 0x0000380000000000ULL, 0x0000780000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0002000000000000ULL, 0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL,
+		0x0008000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000808080800ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000808080000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001020400000ULL,
+		0x0000000402000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000808000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001020000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000400000000ULL, 0x0000000000000000ULL, 0x0000000800000000ULL,
+		0x0000000000000000ULL, 0x0000001000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000060000000000ULL, 0x0000040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000100000000000ULL, 0x0000300000000000ULL, 0x0000700000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL, 0x0008000000000000ULL,
+		0x0000000000000000ULL, 0x0010000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000001010101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000804020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000001010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000804000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000001010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002040000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000800000000ULL, 0x0000000000000000ULL,
+		0x0000001000000000ULL, 0x0000000000000000ULL, 0x0000002000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00000e0000000000ULL, 0x00000c0000000000ULL, 0x0000080000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000200000000000ULL, 0x0000600000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008000000000000ULL, 0x0000000000000000ULL,
+		0x0010000000000000ULL, 0x0000000000000000ULL, 0x0020000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000001008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000002020202000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000001008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000002020200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001008000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000002020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001000000000ULL,
+		0x0000000000000000ULL, 0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000004000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00001e0000000000ULL, 0x00001c0000000000ULL, 0x0000180000000000ULL, 0x0000100000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000400000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010000000000000ULL,
+		0x0000000000000000ULL, 0x0020000000000000ULL, 0x0000000000000000ULL, 0x0040000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000002010080400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004040404000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002010080000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004040400000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002010000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004040000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000004000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00003e0000000000ULL, 0x00003c0000000000ULL, 0x0000380000000000ULL, 0x0000300000000000ULL,
+		0x0000200000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0020000000000000ULL, 0x0000000000000000ULL, 0x0040000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020100800ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080808000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020100000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080800000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000004020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000004000000000ULL, 0x0000000000000000ULL, 0x0000008000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00007e0000000000ULL, 0x00007c0000000000ULL, 0x0000780000000000ULL, 0x0000700000000000ULL,
+		0x0000600000000000ULL, 0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0040000000000000ULL, 0x0000000000000000ULL, 0x0080000000000000ULL
+	},
+	{
+		0x0000010101010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000020408102000ULL, 0x0000000000000000ULL,
+		0x0000010101010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000020408100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000010101000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000020408000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000010100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000020400000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000010000000000ULL, 0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002000000000000ULL, 0x0006000000000000ULL,
+		0x000e000000000000ULL, 0x001e000000000000ULL, 0x003e000000000000ULL, 0x007e000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000020202020200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040810204000ULL,
+		0x0000000000000000ULL, 0x0000020202020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040810200000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000020202000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000040810000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000020200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000040800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000000000000ULL, 0x0000040000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004000000000000ULL,
+		0x000c000000000000ULL, 0x001c000000000000ULL, 0x003c000000000000ULL, 0x007c000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040404040400ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040404040000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000081020400000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040404000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000081020000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040400000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000081000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000020000000000ULL, 0x0000000000000000ULL, 0x0000040000000000ULL, 0x0000000000000000ULL,
+		0x0000080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0002000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0008000000000000ULL, 0x0018000000000000ULL, 0x0038000000000000ULL, 0x0078000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080808080800ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080808080000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080808000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000102040000000ULL,
+		0x0000040200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080800000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000102000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000040000000000ULL, 0x0000000000000000ULL, 0x0000080000000000ULL,
+		0x0000000000000000ULL, 0x0000100000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0006000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0010000000000000ULL, 0x0030000000000000ULL, 0x0070000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000101010101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000101010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000080402000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000101010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000080400000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000101000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000204000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080000000000ULL, 0x0000000000000000ULL,
+		0x0000100000000000ULL, 0x0000000000000000ULL, 0x0000200000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x000e000000000000ULL, 0x000c000000000000ULL, 0x0008000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020000000000000ULL, 0x0060000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000202020202000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000100804020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000202020200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000100804000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000202020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100800000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000202000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100000000000ULL,
+		0x0000000000000000ULL, 0x0000200000000000ULL, 0x0000000000000000ULL, 0x0000400000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x001e000000000000ULL, 0x001c000000000000ULL, 0x0018000000000000ULL, 0x0010000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000201008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000404040404000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000201008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000404040400000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000201008000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000404040000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000201000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000404000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000200000000000ULL, 0x0000000000000000ULL, 0x0000400000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x003e000000000000ULL, 0x003c000000000000ULL, 0x0038000000000000ULL, 0x0030000000000000ULL,
+		0x0020000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000402010080400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000808080808000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000402010080000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000808080800000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000402010000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000808080000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000402000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000808000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000800000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x007e000000000000ULL, 0x007c000000000000ULL, 0x0078000000000000ULL, 0x0070000000000000ULL,
+		0x0060000000000000ULL, 0x0040000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0001010101010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002040810204000ULL,
+		0x0001010101010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002040810200000ULL, 0x0000000000000000ULL,
+		0x0001010101000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0002040810000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001010100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0002040800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001010000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002040000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001000000000000ULL, 0x0000000000000000ULL, 0x0002000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0200000000000000ULL, 0x0600000000000000ULL,
+		0x0e00000000000000ULL, 0x1e00000000000000ULL, 0x3e00000000000000ULL, 0x7e00000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0002020202020200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0002020202020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004081020400000ULL,
+		0x0000000000000000ULL, 0x0002020202000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004081020000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0002020200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0004081000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0002020000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0004080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0002000000000000ULL, 0x0000000000000000ULL, 0x0004000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0400000000000000ULL,
+		0x0c00000000000000ULL, 0x1c00000000000000ULL, 0x3c00000000000000ULL, 0x7c00000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004040404040400ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004040404040000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004040404000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008102040000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004040400000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008102000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004040000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0008100000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0002000000000000ULL, 0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL,
+		0x0008000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0200000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0800000000000000ULL, 0x1800000000000000ULL, 0x3800000000000000ULL, 0x7800000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080808080800ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080808080000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080808000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080800000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010204000000000ULL,
+		0x0004020000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010200000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL, 0x0008000000000000ULL,
+		0x0000000000000000ULL, 0x0010000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0600000000000000ULL, 0x0400000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x1000000000000000ULL, 0x3000000000000000ULL, 0x7000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0010101010101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0010101010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0010101010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0008040200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0010101000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0008040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0010100000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020400000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008000000000000ULL, 0x0000000000000000ULL,
+		0x0010000000000000ULL, 0x0000000000000000ULL, 0x0020000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0e00000000000000ULL, 0x0c00000000000000ULL, 0x0800000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000000000000000ULL, 0x6000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0020202020202000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0020202020200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0010080402000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0020202020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0010080400000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0020202000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010080000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0020200000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010000000000000ULL,
+		0x0000000000000000ULL, 0x0020000000000000ULL, 0x0000000000000000ULL, 0x0040000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1e00000000000000ULL, 0x1c00000000000000ULL, 0x1800000000000000ULL, 0x1000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404040404000ULL, 0x0000000000000000ULL,
+		0x0020100804020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404040400000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0020100804000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404040000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100800000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040400000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0020000000000000ULL, 0x0000000000000000ULL, 0x0040000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x3e00000000000000ULL, 0x3c00000000000000ULL, 0x3800000000000000ULL, 0x3000000000000000ULL,
+		0x2000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0040201008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080808080808000ULL,
+		0x0000000000000000ULL, 0x0040201008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080808080800000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040201008000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080808080000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040201000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080808000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0040200000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080800000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0040000000000000ULL, 0x0000000000000000ULL, 0x0080000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x7e00000000000000ULL, 0x7c00000000000000ULL, 0x7800000000000000ULL, 0x7000000000000000ULL,
+		0x6000000000000000ULL, 0x4000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	}
+};
+
+const Bitboard line_table[64][64] = {
+	{
+		0x0000000000000000ULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL,
+		0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL,
+		0x0101010101010101ULL, 0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL
+	},
+	{
+		0x00000000000000ffULL, 0x0000000000000000ULL, 0x00000000000000ffULL, 0x00000000000000ffULL,
+		0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL,
+		0x0000000000000102ULL, 0x0202020202020202ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0080402010080402ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0080402010080402ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x00000000000000ffULL, 0x00000000000000ffULL, 0x0000000000000000ULL, 0x00000000000000ffULL,
+		0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL,
+		0x0000000000000000ULL, 0x0000000000010204ULL, 0x0404040404040404ULL, 0x0000804020100804ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000010204ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000804020100804ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000804020100804ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x0000000000000000ULL,
+		0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001020408ULL, 0x0808080808080808ULL,
+		0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000001020408ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000001020408ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008040201008ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008040201008ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL,
+		0x0000000000000000ULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000102040810ULL,
+		0x1010101010101010ULL, 0x0000000080402010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000102040810ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000080402010ULL,
+		0x0000000102040810ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL,
+		0x00000000000000ffULL, 0x0000000000000000ULL, 0x00000000000000ffULL, 0x00000000000000ffULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000010204081020ULL, 0x2020202020202020ULL, 0x0000000000804020ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000804020ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL,
+		0x00000000000000ffULL, 0x00000000000000ffULL, 0x0000000000000000ULL, 0x00000000000000ffULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0001020408102040ULL, 0x4040404040404040ULL, 0x0000000000008040ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001020408102040ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL
+	},
+	{
+		0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL,
+		0x00000000000000ffULL, 0x00000000000000ffULL, 0x00000000000000ffULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL
+	},
+	{
+		0x0101010101010101ULL, 0x0000000000000102ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL,
+		0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL,
+		0x0101010101010101ULL, 0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL
+	},
+	{
+		0x8040201008040201ULL, 0x0202020202020202ULL, 0x0000000000010204ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x000000000000ff00ULL, 0x0000000000000000ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL,
+		0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL,
+		0x0000000000010204ULL, 0x0202020202020202ULL, 0x8040201008040201ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x8040201008040201ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0080402010080402ULL, 0x0404040404040404ULL, 0x0000000001020408ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x0000000000000000ULL, 0x000000000000ff00ULL,
+		0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL,
+		0x0000000000000000ULL, 0x0000000001020408ULL, 0x0404040404040404ULL, 0x0080402010080402ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000001020408ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0080402010080402ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL, 0x0808080808080808ULL,
+		0x0000000102040810ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x0000000000000000ULL,
+		0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000102040810ULL, 0x0808080808080808ULL,
+		0x0000804020100804ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000102040810ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000804020100804ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000102040810ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008040201008ULL,
+		0x1010101010101010ULL, 0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL,
+		0x0000000000000000ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+		0x1010101010101010ULL, 0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000008040201008ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008040201008ULL,
+		0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000080402010ULL, 0x2020202020202020ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+		0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL,
+		0x000000000000ff00ULL, 0x0000000000000000ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001020408102040ULL, 0x2020202020202020ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000080402010ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000804020ULL, 0x4040404040404040ULL, 0x0102040810204080ULL,
+		0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL,
+		0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x0000000000000000ULL, 0x000000000000ff00ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0102040810204080ULL, 0x4040404040404040ULL, 0x0000000000804020ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0102040810204080ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000008040ULL, 0x8080808080808080ULL,
+		0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL,
+		0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x000000000000ff00ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL
+	},
+	{
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000010204ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000010204ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL,
+		0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL,
+		0x0101010101010101ULL, 0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2010080402010000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000001020408ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x4020100804020100ULL, 0x0202020202020202ULL, 0x0000000001020408ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000ff0000ULL, 0x0000000000000000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL,
+		0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL,
+		0x0000000001020408ULL, 0x0202020202020202ULL, 0x4020100804020100ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL
+	},
+	{
+		0x8040201008040201ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000102040810ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x8040201008040201ULL, 0x0404040404040404ULL, 0x0000000102040810ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000000000ULL, 0x0000000000ff0000ULL,
+		0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL,
+		0x0000000000000000ULL, 0x0000000102040810ULL, 0x0404040404040404ULL, 0x8040201008040201ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000102040810ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL, 0x0808080808080808ULL,
+		0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000000000ULL,
+		0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL, 0x0808080808080808ULL,
+		0x0080402010080402ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+		0x1010101010101010ULL, 0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL,
+		0x0000000000000000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+		0x1010101010101010ULL, 0x0000804020100804ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000804020100804ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+		0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008040201008ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000008040201008ULL, 0x2020202020202020ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+		0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL,
+		0x0000000000ff0000ULL, 0x0000000000000000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0102040810204080ULL, 0x2020202020202020ULL, 0x0000008040201008ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000008040201008ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000080402010ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000080402010ULL, 0x4040404040404040ULL, 0x0204081020408000ULL,
+		0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL,
+		0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000000000ULL, 0x0000000000ff0000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0204081020408000ULL, 0x4040404040404040ULL, 0x0000000080402010ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0204081020408000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000804020ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000804020ULL, 0x8080808080808080ULL,
+		0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL,
+		0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000ff0000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL
+	},
+	{
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001020408ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000001020408ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000001020408ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL,
+		0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL,
+		0x0101010101010101ULL, 0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x1008040201000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1008040201000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000102040810ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000102040810ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x2010080402010000ULL, 0x0202020202020202ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00000000ff000000ULL, 0x0000000000000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL,
+		0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL,
+		0x0000000102040810ULL, 0x0202020202020202ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x2010080402010000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x4020100804020100ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x4020100804020100ULL, 0x0404040404040404ULL, 0x0000010204081020ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x0000000000000000ULL, 0x00000000ff000000ULL,
+		0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL,
+		0x0000000000000000ULL, 0x0000010204081020ULL, 0x0404040404040404ULL, 0x4020100804020100ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000010204081020ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL
+	},
+	{
+		0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL, 0x0808080808080808ULL,
+		0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x0000000000000000ULL,
+		0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL, 0x0808080808080808ULL,
+		0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL,
+		0x1010101010101010ULL, 0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL,
+		0x0000000000000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+		0x1010101010101010ULL, 0x0080402010080402ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL,
+		0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000804020100804ULL, 0x2020202020202020ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+		0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL,
+		0x00000000ff000000ULL, 0x0000000000000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0204081020408000ULL, 0x2020202020202020ULL, 0x0000804020100804ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008040201008ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000008040201008ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000008040201008ULL, 0x4040404040404040ULL, 0x0408102040800000ULL,
+		0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL,
+		0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x0000000000000000ULL, 0x00000000ff000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0408102040800000ULL, 0x4040404040404040ULL, 0x0000008040201008ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0408102040800000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000080402010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000080402010ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000080402010ULL, 0x8080808080808080ULL,
+		0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL,
+		0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x00000000ff000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0810204080000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0810204080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL
+	},
+	{
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000102040810ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000102040810ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000102040810ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL,
+		0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL,
+		0x0101010101010101ULL, 0x0804020100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0804020100000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1008040201000000ULL, 0x0202020202020202ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x000000ff00000000ULL, 0x0000000000000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL,
+		0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL,
+		0x0000010204081020ULL, 0x0202020202020202ULL, 0x1008040201000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x1008040201000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x2010080402010000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2010080402010000ULL, 0x0404040404040404ULL, 0x0001020408102040ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x0000000000000000ULL, 0x000000ff00000000ULL,
+		0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL,
+		0x0000000000000000ULL, 0x0001020408102040ULL, 0x0404040404040404ULL, 0x2010080402010000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001020408102040ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+		0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL, 0x0808080808080808ULL,
+		0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x0000000000000000ULL,
+		0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL, 0x0808080808080808ULL,
+		0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL
+	},
+	{
+		0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL,
+		0x1010101010101010ULL, 0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL,
+		0x0000000000000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+		0x1010101010101010ULL, 0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0080402010080402ULL, 0x2020202020202020ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+		0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL,
+		0x000000ff00000000ULL, 0x0000000000000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0408102040800000ULL, 0x2020202020202020ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0080402010080402ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000804020100804ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000804020100804ULL, 0x4040404040404040ULL, 0x0810204080000000ULL,
+		0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL,
+		0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x0000000000000000ULL, 0x000000ff00000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0810204080000000ULL, 0x4040404040404040ULL, 0x0000804020100804ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0810204080000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008040201008ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000008040201008ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008040201008ULL, 0x8080808080808080ULL,
+		0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL,
+		0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x000000ff00000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x1020408000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x1020408000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1020408000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL
+	},
+	{
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL,
+		0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL,
+		0x0101010101010101ULL, 0x0402010000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0402010000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0804020100000000ULL, 0x0202020202020202ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000ff0000000000ULL, 0x0000000000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL,
+		0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL,
+		0x0001020408102040ULL, 0x0202020202020202ULL, 0x0804020100000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1008040201000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x1008040201000000ULL, 0x0404040404040404ULL, 0x0102040810204080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000000000000000ULL, 0x0000ff0000000000ULL,
+		0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL,
+		0x0000000000000000ULL, 0x0102040810204080ULL, 0x0404040404040404ULL, 0x1008040201000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0102040810204080ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+		0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x2010080402010000ULL, 0x0808080808080808ULL,
+		0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000000000000000ULL,
+		0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL, 0x0808080808080808ULL,
+		0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+		0x1010101010101010ULL, 0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL,
+		0x0000000000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+		0x1010101010101010ULL, 0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL
+	},
+	{
+		0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x8040201008040201ULL, 0x2020202020202020ULL, 0x0810204080000000ULL, 0x0000000000000000ULL,
+		0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL,
+		0x0000ff0000000000ULL, 0x0000000000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0810204080000000ULL, 0x2020202020202020ULL, 0x8040201008040201ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x8040201008040201ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0080402010080402ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0080402010080402ULL, 0x4040404040404040ULL, 0x1020408000000000ULL,
+		0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL,
+		0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000000000000000ULL, 0x0000ff0000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x1020408000000000ULL, 0x4040404040404040ULL, 0x0080402010080402ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1020408000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000804020100804ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000804020100804ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL, 0x8080808080808080ULL,
+		0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL,
+		0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000ff0000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x2040800000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2040800000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL
+	},
+	{
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL,
+		0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL,
+		0x0101010101010101ULL, 0x0201000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0402010000000000ULL, 0x0202020202020202ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00ff000000000000ULL, 0x0000000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL,
+		0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL,
+		0x0102040810204080ULL, 0x0202020202020202ULL, 0x0402010000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0804020100000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0804020100000000ULL, 0x0404040404040404ULL, 0x0204081020408000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x0000000000000000ULL, 0x00ff000000000000ULL,
+		0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL,
+		0x0000000000000000ULL, 0x0204081020408000ULL, 0x0404040404040404ULL, 0x0804020100000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+		0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x1008040201000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x1008040201000000ULL, 0x0808080808080808ULL,
+		0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x0000000000000000ULL,
+		0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL, 0x0808080808080808ULL,
+		0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0810204080000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2010080402010000ULL,
+		0x1010101010101010ULL, 0x0810204080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL,
+		0x0000000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+		0x1010101010101010ULL, 0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x1020408000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x4020100804020100ULL, 0x2020202020202020ULL, 0x1020408000000000ULL, 0x0000000000000000ULL,
+		0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL,
+		0x00ff000000000000ULL, 0x0000000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1020408000000000ULL, 0x2020202020202020ULL, 0x4020100804020100ULL, 0x0000000000000000ULL
+	},
+	{
+		0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x8040201008040201ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x8040201008040201ULL, 0x4040404040404040ULL, 0x2040800000000000ULL,
+		0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL,
+		0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x0000000000000000ULL, 0x00ff000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2040800000000000ULL, 0x4040404040404040ULL, 0x8040201008040201ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0080402010080402ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080402010080402ULL, 0x8080808080808080ULL,
+		0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL,
+		0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x00ff000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4080000000000000ULL, 0x8080808080808080ULL
+	},
+	{
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0101010101010101ULL, 0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL,
+		0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0201000000000000ULL, 0x0202020202020202ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0xff00000000000000ULL, 0x0000000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL,
+		0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0402010000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+		0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0402010000000000ULL, 0x0404040404040404ULL, 0x0408102040800000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0xff00000000000000ULL, 0xff00000000000000ULL, 0x0000000000000000ULL, 0xff00000000000000ULL,
+		0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+		0x0804020100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0804020100000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+		0x0000000000000000ULL, 0x0810204080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020100000000ULL, 0x0808080808080808ULL,
+		0x0810204080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL, 0x0000000000000000ULL,
+		0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1020408000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x1008040201000000ULL, 0x0000000000000000ULL,
+		0x1010101010101010ULL, 0x0000000000000000ULL, 0x1020408000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1008040201000000ULL,
+		0x1010101010101010ULL, 0x1020408000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL,
+		0x0000000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2010080402010000ULL,
+		0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL, 0x2040800000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x2010080402010000ULL, 0x2020202020202020ULL, 0x2040800000000000ULL, 0x0000000000000000ULL,
+		0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL,
+		0xff00000000000000ULL, 0x0000000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL
+	},
+	{
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x4020100804020100ULL, 0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x4020100804020100ULL, 0x4040404040404040ULL, 0x4080000000000000ULL,
+		0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL,
+		0xff00000000000000ULL, 0xff00000000000000ULL, 0x0000000000000000ULL, 0xff00000000000000ULL
+	},
+	{
+		0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x8040201008040201ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040201008040201ULL, 0x8080808080808080ULL,
+		0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL,
+		0xff00000000000000ULL, 0xff00000000000000ULL, 0xff00000000000000ULL, 0x0000000000000000ULL
+	}
+};
+
+const uint64_t zobrist_piece[2][6][64] = {
+	{
+		{
+			0x584245480fc0b161ULL, 0x34b86187e9594843ULL, 0x23d2be368df78a13ULL, 0xfa529fce6fc281c7ULL,
+			0xa1dca399798d9504ULL, 0x92a7e6c704e74f2eULL, 0x9e0d4de64eb88a30ULL, 0xf9ac9dbbd3097724ULL,
+			0xcae5403911822ccaULL, 0x2fbd2babf2955a13ULL, 0x0178939b83aa9467ULL, 0xfb7fed217d9a388fULL,
+			0xecf848ea8082cf3eULL, 0x41b88b64a697c520ULL, 0x3f67d29677dba2aaULL, 0x2814c5462757ff6fULL,
+			0x42827bb957a96b51ULL, 0x7a337f8379b8cdc7ULL, 0x38c2871553f82d9cULL, 0xb29168fef7693ac7ULL,
+			0xc84e445c8575b972ULL, 0xbe73f3254b3f4e80ULL, 0x287b3ba30790901dULL, 0xc45e2a979b42167dULL,
+			0x81968c317c1cad11ULL, 0x555b9a2e6c7bf00bULL, 0xf04ecbb29a08652bULL, 0xfaee0ac2cfc25f21ULL,
+			0x44f8ddc0969033dfULL, 0xc2e72518bd3a0478ULL, 0x53bdbe465eae6e70ULL, 0xdb4cf7f5e91eaeacULL,
+			0x19be0f26e150b8f1ULL, 0x14bfb9eee42205c0ULL, 0x21058206124531cbULL, 0x05fb98e77bc4a968ULL,
+			0x04eb1b1825407a3aULL, 0x78599b2922cf344eULL, 0xc7b68d92d68279a6ULL, 0xabf0e7e7b52fd4d5ULL,
+			0xa4a39f34f7521e3cULL, 0xc151982463fcb500ULL, 0x8f573b1f5a620c6aULL, 0x1b03c242983c92f2ULL,
+			0x6f42068baed81757ULL, 0x84a04f63281892b9ULL, 0xe83f4642a1832ddcULL, 0xf85abf3798bedc87ULL,
+			0xc79333e8c25460feULL, 0x4f47e25b65a937bfULL, 0x9d8da8434bf86a10ULL, 0xbda8b6d003bf1ec4ULL,
+			0x0db10c840c5551f9ULL, 0xb050b859f112a51aULL, 0xc4fb94825f5a86d0ULL, 0xa6a8b3e8d22587ddULL,
+			0xb44a76c80d3f9b92ULL, 0x586412e3a1fb4025ULL, 0xf7aef6c94fa61fe5ULL, 0x4822de07e2760a9aULL,
+			0xdfde84cbb17d000fULL, 0xf55acfbdeac019cfULL, 0xfdf46c5436520a3cULL, 0x5e0880bc09aba128ULL
+		},
+		{
+			0x3197e16117a1bc6aULL, 0xa404a0cb4148a592ULL, 0xd69ad1d1b1e31059ULL, 0xc1fdb6bdc83de039ULL,
+			0xc08e5a006ba0b5b9ULL, 0x9c6ce001e0c9ba92ULL, 0x0b2dc9c97cfacd67ULL, 0x2c45dda38b66813dULL,
+			0x09f3c4798309a37fULL, 0x6a7f01e199fa8ff9ULL, 0xe2215f903cd9a4a6ULL, 0x3536c200e283fe6fULL,
+			0x8b744b0538d28253ULL, 0x899e6954f167d397ULL, 0x79106890c8e319f0ULL, 0x9e35107af50ca3c3ULL,
+			0x48cf952a833e2a44ULL, 0x9a91a93352da4710ULL, 0xf73538f6a530379eULL, 0x279bbe80e2667071ULL,
+			0x3bf85de8b59280d1ULL, 0xb3bd614b3363b190ULL, 0x41f9389f2e3d12f3ULL, 0x77e372155557b416ULL,
+			0x2f8f222b616edefeULL, 0x7f68b5124e427cc3ULL, 0xbb5e0290e42da8faULL, 0x77a8f10861c68d2bULL,
+			0xb4cf4ccc84e12af1ULL, 0xbe3c7010e93474e4ULL, 0x13860723417da50dULL, 0x856173bd9639bd07ULL,
+			0x73b0454c8ba06fbdULL, 0xb4ce0926371f6022ULL, 0x41b5bb007c691662ULL, 0xc8f097d47d841cceULL,
+			0xc3166397f90fe777ULL, 0xa464865ae318c579ULL, 0x3fdd950c9d268ab3ULL, 0x712cc7750a240b66ULL,
+			0x2dea32415dbe5af0ULL, 0xd0ffaa5e4f479a45ULL, 0x331ca99f99152431ULL, 0xaf738bd8039a2239ULL,
+			0xeaccb8196128b83dULL, 0x6b1c169282d9460dULL, 0x5c95a8dd96ced7c1ULL, 0xe43d8f6d70f29a2eULL,
+			0x57180ad1acc4349aULL, 0x2081cb300ce5da73ULL, 0x13a7d8b034caed07ULL, 0x924acae48982d91dULL,
+			0x2446816b0cda3befULL, 0x9be0615083809458ULL, 0x5d604591d6c98370ULL, 0xe2153563ef86cc76ULL,
+			0x30341aca28b81c6eULL, 0xb8cea7a5fecfb7d6ULL, 0xb47b8c06ca571d39ULL, 0x83bdc0a10b25dd43ULL,
+			0x5fd2c5df779ea639ULL, 0xf5920d4490753535ULL, 0x61bbaf08c680321fULL, 0x111ce033da3455bbULL
+		},
+		{
+			0xd087da07dd8233d0ULL, 0x7479466b73a1c3b7ULL, 0xdc93aace6ea08df0ULL, 0x4f3164152a36b0ebULL,
+			0x2ed611765547874aULL, 0xb9f31ba22d6d9ac4ULL, 0x7a5552a160eb70f1ULL, 0x292391900248ba50ULL,
+			0x3e52fcabd960bf24ULL, 0x70158abaafad375aULL, 0x75237458603cfbb4ULL, 0x4ac1a9c69e32ef43ULL,
+			0x6eef0c4eb6e73a5dULL, 0xa036fd38f3ddc369ULL, 0xfe655acac87982afULL, 0xa2129c7a07083a6aULL,
+			0x3e3a8ba9d779f09eULL, 0x33d9e755ad46e4ffULL, 0x679c222de6d6b6f6ULL, 0xb98b911a125e661bULL,
+			0xcfd178b7050e3c17ULL, 0xcf4bc9356457c5afULL, 0xc9e878c32013e1e4ULL, 0x3e8c41d6a0d93f27ULL,
+			0x4617c0815501a499ULL, 0x7491a3566071a190ULL, 0x73775050a94d26d3ULL, 0xe7a840eb2f30685eULL,
+			0x70e43fb88663df0eULL, 0xe4a921d822191b30ULL, 0xc2b36f2bfd71e506ULL, 0xd7412801c4ca874cULL,
+			0xd6d6d8af278f4142ULL, 0x79945e56ecb84f40ULL, 0x8e36f3f3b926efdeULL, 0x7b5581f7e1169581ULL,
+			0x9ca098ad6815f8eaULL, 0x31234e89db90a99bULL, 0x7a63e36d252e8e08ULL, 0xb08c914bc72e5114ULL,
+			0x661a0050c07ac8b6ULL, 0x568274d28710d0a7ULL, 0x30d9ec048db238c6ULL, 0x93d09136f551ad37ULL,
+			0xc6f251eebe2ca3adULL, 0xbf98e13c1f59b1aaULL, 0x9add126ed7ac2849ULL, 0xeaf5210ae0b24259ULL,
+			0xe584f6b7b092909dULL, 0x32edf62cccbc32fcULL, 0xf3f84788d7447599ULL, 0x654a7d53ef20bb32ULL,
+			0xabd8efda7a3e76c4ULL, 0x78f6f8c2f9dd3b29ULL, 0x53cc22bc7a3b6b1fULL, 0xe375584c95643a09ULL,
+			0x2e079777727b503dULL, 0x8ac47b527bf609ddULL, 0xd52caf3486a4328eULL, 0x17742a77f222196bULL,
+			0xd0290d41195f6799ULL, 0xa80e6cb81e6b1f16ULL, 0xde05734e0e22cca8ULL, 0xa752edde057aa331ULL
+		},
+		{
+			0x054b9856c7d0ba37ULL, 0xf2f6d04364317683ULL, 0xabd6c1556928d4aeULL, 0x5a4ab21c4e546e87ULL,
+			0x5f53f5a66137879aULL, 0xce43d63d0ccd4e15ULL, 0x4b7aa7c00fd7f1c9ULL, 0x5950ab6c9cd90c6aULL,
+			0xc9a9e6db9bcae4f2ULL, 0x158b753d99ac0dbbULL, 0x44d28fd2beeb5b60ULL, 0x067d1de7618055d6ULL,
+			0x40e3f9ed0416e0fdULL, 0xf41beaafa341527cULL, 0x8da88ec399accfd8ULL, 0xa553c4a32cd96047ULL,
+			0x8088cfda365e2347ULL, 0x4446cda68c50aec1ULL, 0x6ce07963ff039fdcULL, 0x5e16894d5427efe3ULL,
+			0x353d289e4b7038fcULL, 0xe969e5dd63ed678dULL, 0x0e1ef0367286fe02ULL, 0xcd8cce2206e0337eULL,
+			0x6b27e6fe25beec98ULL, 0x32cd05b6055fb741ULL, 0xf670a236388ef86fULL, 0xf029597594f21e5fULL,
+			0x12c9e5131bd18da3ULL, 0x8cfca107b4c12678ULL, 0xc68cb16cdb463a34ULL, 0x80a0402162b8bb40ULL,
+			0xc0e816d8ad571a36ULL, 0x095e306f5989f982ULL, 0x371cc8014f96caf1ULL, 0x1f203bfa87ad7b24ULL,
+			0xb3ddb8e9e73c68d2ULL, 0x0ec5e8e2bff46483ULL, 0xaa7a1a679216cc8aULL, 0xe30e87d406368393ULL,
+			0xedaa08cc27406a54ULL, 0x7b922f819d5eff80ULL, 0x8e3af44552d5a27fULL, 0xa454880d34a176fbULL,
+			0x3cb7d451fde6ead6ULL, 0xe7c465c05ffb5283ULL, 0x466c0163820c64e6ULL, 0x244c64db41d385afULL,
+			0xec7744f1a1cca964ULL, 0x40b3eb3a76e5e936ULL, 0x24f50004589caf64ULL, 0x45ffa5d47c9ecf3aULL,
+			0xf001f475d27b7c24ULL, 0x6e5fc1aecf3c03dcULL, 0x0fb577cbc46f0cdbULL, 0x8ebfc427a1bb8402ULL,
+			0xfa36a743978db38aULL, 0xfeb1e36751650a6dULL, 0xa5ea7cc891bafb39ULL, 0xfbe3eaa2f05e608fULL,
+			0x303a07ae512b1f8eULL, 0xd40e1b6ef0dd6a31ULL, 0x12b26cbf4e6a7ca5ULL, 0xc36a0582a7c5211cULL
+		},
+		{
+			0x496c0a1a2f5d6c5eULL, 0xeb63d2c863df0106ULL, 0xc60562fe99f03e84ULL, 0x63c83a9ae0eefff9ULL,
+			0xc4c63295c9e3fc46ULL, 0x47ec68b1317bea3eULL, 0xbf695b4bd470526aULL, 0xd6248a84851d684eULL,
+			0xa3dc3e9a6478811eULL, 0xfda5d196b18bf79cULL, 0x144928658e008773ULL, 0x140ab930a0a93abdULL,
+			0xab556d9d03e16788ULL, 0x061edae663c04747ULL, 0xf99e3d4ebbecf609ULL, 0x35850328582d8da5ULL,
+			0x04b0aca98db61ffeULL, 0xbd4d378fe8574c41ULL, 0x7daba4a9aeeed299ULL, 0xd181d4ff8eac897cULL,
+			0xd8088e1855600f6eULL, 0xef226bf495c4d4f0ULL, 0x22656e3655f66159ULL, 0x493ff21c7f58fbdbULL,
+			0xbc0b98cb373bdcecULL, 0x792cf3ae34951055ULL, 0xe83a5833f1d88f35ULL, 0x1ef3bdb85728536bULL,
+			0x15f1f1cc95e5b90dULL, 0xccf276b5e0ff913fULL, 0x855e0ec4c547c1ddULL, 0x728e514dd73a991eULL,
+			0xf12d065f06496bacULL, 0x07f3258e239c927bULL, 0xabf8f15ee18e559fULL, 0xa2d361e26883cef4ULL,
+			0x2a2518541dadf469ULL, 0x0191041b4be495c1ULL, 0xb22a64610fba0caaULL, 0xed61cc7b46d51233ULL,
+			0x2696375c0ef454d7ULL, 0x7a624f23521a69beULL, 0x61b4970d3ac9f2edULL, 0xc6dac30e580d7a48ULL,
+			0x63b9af4a0dd2f2bcULL, 0xc8a7296943907859ULL, 0x07e3e11da7d06ee9ULL, 0xd1af1ffecdb15474ULL,
+			0xfdbc8a272149abdcULL, 0x51858ee6970c4f8bULL, 0x3ce7cf3ebb68d5d4ULL, 0xf44c1540e46ff17fULL,
+			0xf5b4c137a2ce915dULL, 0x4f40490d5a7afb3fULL, 0x05e023a8c3052109ULL, 0x22e9fe6b65fc490bULL,
+			0xaafc51f863b69359ULL, 0x96e98249bcc0083fULL, 0x4e99c9c2d16267efULL, 0xd6dc51803164b8e0ULL,
+			0x4252716b6c164991ULL, 0xc9c70e0c34ea2142ULL, 0x235621c79923e580ULL, 0xf82c4bf7a6cec24bULL
+		},
+		{
+			0x45105ea57864ad0fULL, 0xbecc04773134c795ULL, 0xf11472bedc21eb5aULL, 0x236c0778e8903e0cULL,
+			0x9a786940006f1d70ULL, 0x0540399246929f4aULL, 0x2933bf00c4b928f4ULL, 0x5fdf9c11012ee7a5ULL,
+			0xa39c6f8f5235f32aULL, 0x93b5a1d25b10124cULL, 0xcd0a86b37b3b2168ULL, 0x3ce83e57ad7c0d2aULL,
+			0x278b376e23e0ffb0ULL, 0x3c0c0e29bcf0d24fULL, 0xeb3b382c49a2402bULL, 0x15d2af32ed726e6bULL,
+			0x7647a88579107077ULL, 0xd101da49635ead57ULL, 0x240180fdb803a5cdULL, 0x031265d4d4af71c6ULL,
+			0x1248df7a85a89ea5ULL, 0x8814d27184e0c6d8ULL, 0xbc2ed92f25a9b155ULL, 0x300764a9094a1777ULL,
+			0x1f3df76c3601be99ULL, 0x020d62ed2e993ba4ULL, 0x626c8d4cb45860d3ULL, 0xd1c2ff953e9684d2ULL,
+			0xfec2fb56db66dd5bULL, 0x401f99e2388e2621ULL, 0x80d9ae2b3fe8922dULL, 0x54fdf3a951646849ULL,
+			0x7b30679df26792d9ULL, 0xcbe91a1b3544cbbcULL, 0xb9eebe9c913d2d2bULL, 0xc325d300b9937db1ULL,
+			0xe6c228a89d9d170aULL, 0x884a8768564aafa4ULL, 0x5c6241c8e64f53fbULL, 0xc305f7eba910539cULL,
+			0x9a9b13861853143bULL, 0xf740c36edb87dcd3ULL, 0x6aaf7a95130987aaULL, 0xc27db433b7f13e25ULL,
+			0x1e822363e127f519ULL, 0x5da8a08e28dddcb3ULL, 0x67976784eff92bcaULL, 0xe16f4fa5eb2f6b1dULL,
+			0x82c1c9a52356528bULL, 0xb4aa6abe0f093ceeULL, 0x581d7d823cebd517ULL, 0x369491e0363fa77dULL,
+			0x29f2dca2c3b3a773ULL, 0xe13875bbe7c97cfdULL, 0xc0f08cdcaf4e7144ULL, 0x4ec7d84f72e83ca6ULL,
+			0xe05909525b28055fULL, 0x8997cedaf01ee295ULL, 0x635d35d12a34da10ULL, 0x7901e29ef15c37a4ULL,
+			0x7440a243d0d1e6cbULL, 0xf31a7648705c97c6ULL, 0x01ce14715bb31f69ULL, 0xbc34d32430008317ULL
+		}
+	},
+	{
+		{
+			0xcd0025cb2780a7d1ULL, 0xaf58b981a0a072deULL, 0x000557c20ed045bbULL, 0x73c080e3e18bebf0ULL,
+			0xe94d36b339820027ULL, 0x814499cba4bbede7ULL, 0x3f55d7ec674d03fcULL, 0x93c492ca014ae6fbULL,
+			0xd313df1bc0c2adf6ULL, 0x253a62e0b80c952dULL, 0x1ba168f226726747ULL, 0x921a76fb76ddb249ULL,
+			0xf95d903bf7cfbb6dULL, 0xfdf352593a155f5bULL, 0x9d74484a2097c325ULL, 0xf8d524c5628485e3ULL,
+			0x7bfca03df18c9428ULL, 0x3e441faf75cf8700ULL, 0x9923c2bf1839d80eULL, 0x73406f078302683eULL,
+			0xc2efdd6a4745a36eULL, 0x1863fd35919e33a8ULL, 0xec3a731190dae5cfULL, 0x400d427f5e73c3c4ULL,
+			0xb056a46ceec15543ULL, 0x7b9dd40463b3e729ULL, 0x051a94122e266aa7ULL, 0x97dd7d1d91d06fb2ULL,
+			0x5d7d948514c463edULL, 0x36d1ab60c35cb06aULL, 0x93604f9be4ef538aULL, 0xb16610665dd92fadULL,
+			0x6f598bd36fb8d6b2ULL, 0x1d4fdae0aaba4b9fULL, 0x378ef034fd9e38c8ULL, 0x16eb16bc598036b9ULL,
+			0xbdba6b6436c1b894ULL, 0x71f9b3c6441a9ee5ULL, 0xb4694260f8d9b298ULL, 0xb29f65ee76eda7fdULL,
+			0x8255a549e27223f2ULL, 0xf6fa32b55f2a7b35ULL, 0x3108a0ba356a4283ULL, 0x96e37e5bfe4c56c6ULL,
+			0x5bf8f16a2fabbfebULL, 0x7ab2d23a824e7254ULL, 0xf25b3c4e5dfcfbb0ULL, 0x30c51001fd81ee47ULL,
+			0xd83de27d9b7f9c5bULL, 0x0fda2dfa676315a3ULL, 0x1d59f86d9f4cdb48ULL, 0xe436fb482dd190feULL,
+			0xb936b6ec634fcc5fULL, 0xb6d5cf13d9ffa407ULL, 0xb9a1310f003bba8fULL, 0x3feb1fa37bf08e3aULL,
+			0xc0deeffb93afa1a6ULL, 0xa071281dd59e5765ULL, 0x6b6ef113665a128bULL, 0xbde12c655c9f646eULL,
+			0x20afe61c5f3e8126ULL, 0xb7944528934c75a4ULL, 0x54900a69975d044fULL, 0x5090e585a8b54d87ULL
+		},
+		{
+			0x6cdc5e3d6abfa6dcULL, 0x6fcd523d967aee91ULL, 0x2e67a94c10279f0cULL, 0xb4c4531d54659332ULL,
+			0x521f3dfd6ce7d494ULL, 0x16497bf22923be3dULL, 0x9812b4185e5bd601ULL, 0xf65599090108c1edULL,
+			0xe54ac2545f5b0b2eULL, 0x2e22c9a92d32b6b8ULL, 0xf05709f39eb87dd5ULL, 0x40ea189168fcd86eULL,
+			0x883419c81aaafa5eULL, 0x0a4bfe7d8f3ef82aULL, 0xfb658e32fa2fcf5aULL, 0x679d4d53e14b0644ULL,
+			0x719bb61976108148ULL, 0x548388013461f24aULL, 0x766889a9d660e32eULL, 0x77950b2153412968ULL,
+			0x514b0a0a06f4f13aULL, 0x8ce83d851d521658ULL, 0xd4682d5f49ce2474ULL, 0x57bcc35a0a22253cULL,
+			0x947cc92b2ef4ae76ULL, 0x321bbf3465181aaaULL, 0xd69658f3c8bfc01fULL, 0x7efcc01d4863585fULL,
+			0xc8b4959fd370692fULL, 0x98ef1afc7993223dULL, 0x928cf73bd79d2b39ULL, 0xb9d49eec1c41ff2fULL,
+			0x34e0d89845c15711ULL, 0x40ac687a4c0331ffULL, 0x034bdb688ed0a85cULL, 0x76997afec2f49e0cULL,
+			0x06bf0ccbf9f77430ULL, 0x98cdc5add0ef96d8ULL, 0x3ea60baebd9afff5ULL, 0x0967c8e4f734974aULL,
+			0xb0c76282b8de6ce4ULL, 0x6bca94a295d2693dULL, 0xce05a91cac1a22afULL, 0x9a1ddfd86dcb5d2aULL,
+			0x1e2e97004642c110ULL, 0xc8b81e4f8f780092ULL, 0xd2189096e6529413ULL, 0x700243b6a64f55fbULL,
+			0xc4a71a821949d590ULL, 0x49885c6031ca223bULL, 0xe75bdc21761858bfULL, 0x07e93eecf669a7ceULL,
+			0xb2b7cb4b0f174701ULL, 0x64b07f8da7a689cfULL, 0xfa48400b2a4a571cULL, 0x9dbc7fd9ed0c84b2ULL,
+			0x8b9ad63f6f17f13bULL, 0xd3abd58fca20f019ULL, 0x996c9f856cf997b9ULL, 0x1e75df1b3f1eaad6ULL,
+			0x8fcfa2a8df96e203ULL, 0x633ce38ae9df2f07ULL, 0xb52bf9830f15b099ULL, 0x952d5bb841049db8ULL
+		},
+		{
+			0xf05921121610fa83ULL, 0xfffcc7b39e3e1bb6ULL, 0x25fdcaf821f04a01ULL, 0x8b2cc299b14b0ad5ULL,
+			0x05ea683aa2b18980ULL, 0x845473595f808a93ULL, 0x461b1e8682c34f46ULL, 0x9706f4b8e64dd858ULL,
+			0xde41b459142c55e8ULL, 0xeef94ca9c92a7743ULL, 0x9c2d90fcb817936dULL, 0xe98d0e2c38f8c70bULL,
+			0x789a94926ed39445ULL, 0xbba9d03d8839822dULL, 0xfb5ca7e179deda69ULL, 0xfce9e666acecdd9dULL,
+			0x329cfbff47fdc366ULL, 0x06f529fabcae2160ULL, 0x77aaa675ec372522ULL, 0x84ab0ec0695243e8ULL,
+			0x2f620f37cfb31d6fULL, 0x9001a1a1ae6cc095ULL, 0x5bf42361d6ba9c54ULL, 0x8d2cf9f110e27c6cULL,
+			0xee83f5f8c2f92394ULL, 0xb9e5c6f1c0e0b4d3ULL, 0x131992bc4f22217aULL, 0x2fd1f1584c6b7bb8ULL,
+			0x0b901f900fc4434fULL, 0xbcda7711a6b0f809ULL, 0x955c5ec541b0bbb9ULL, 0xe0849fca9976148eULL,
+			0x1d6011dda51e1b27ULL, 0x3b0c275887140ed1ULL, 0x4d321c5217dbb28cULL, 0x528d48867e9b26e9ULL,
+			0x82dddcbea5ba8ae4ULL, 0x010b52066aedc6f1ULL, 0x7b57c34a67ef813cULL, 0x67690367da9b913eULL,
+			0xa002701e92d5299cULL, 0xaddcde12761764cfULL, 0x6d90da86083799c6ULL, 0x41426e4574134775ULL,
+			0xa61ef0ceabb21cbbULL, 0x2f101819f5713642ULL, 0x2dbe78c6b54204aeULL, 0x2507b34afe726b27ULL,
+			0xb07345bcf612a631ULL, 0x7ce5edea01eb2f3dULL, 0xf9c38905e6829623ULL, 0x6e8ecde2e8b07bcfULL,
+			0x5df6e9d91ff608f8ULL, 0x22ab731a2486dae9ULL, 0x039a73ad701c4d1cULL, 0x495f4a8cc140b286ULL,
+			0x3f4df27d3a785263ULL, 0x2330f930e05a5a07ULL, 0xad8d7068c2aa8f73ULL, 0xd25cb829253866adULL,
+			0x1abd44cb0ffe1d20ULL, 0x69bd26fbf7f6a91aULL, 0xf592cd95ad0042c8ULL, 0xdcf3a4e22e89f04dULL
+		},
+		{
+			0xd4ddd3b3d77b50edULL, 0x926af6367e043d0cULL, 0x0e3f4928f8baf676ULL, 0x23f3d0e2650cde1aULL,
+			0xdfaab11f7b7e0126ULL, 0x1102f894b36474a4ULL, 0xd2c7d533e711154dULL, 0xfd35a6e5ee7dc427ULL,
+			0xdb42cdb5ae8ad66fULL, 0xa2d9ebcb4da9b803ULL, 0x186acfc3913a8bb3ULL, 0x702f8b07ed047264ULL,
+			0x50d9b356ea8e6380ULL, 0x77c859bc163d9f47ULL, 0x359c81f0f9ecd5b9ULL, 0x130828ca7d394252ULL,
+			0x9d7a5a104775e456ULL, 0x93222e4ab234da1eULL, 0x8abeccb7d971f42aULL, 0x9c63cf806ebf5d42ULL,
+			0x2ffeb1e94ced3378ULL, 0xc6b819ea6d6b371eULL, 0x79d155d0487fe6f0ULL, 0x47019df741b2a53dULL,
+			0x62032554c9512f37ULL, 0xd8a8cddb503ca0a9ULL, 0xc1b77bd0daf1d3a8ULL, 0xda0f00c4495bda0fULL,
+			0x779a7e00f0880e7bULL, 0x9189719a13ebe0a7ULL, 0x31c405c15c6cfea6ULL, 0x1c3e626ec7894edbULL,
+			0x6a06fef7c4828a86ULL, 0xd865039886dfee13ULL, 0x062dc4b297f5b50fULL, 0x7d07934d425cfda5ULL,
+			0x409147d7ca6f8d1eULL, 0xbb757690a4b3d584ULL, 0x4c098bbc75e1532fULL, 0x8f90477d2ba9ba49ULL,
+			0xbde9047eba235b7dULL, 0xa165574061f8628bULL, 0x8809672d326e508eULL, 0x94616bfce6d16fafULL,
+			0x2dfdc7ad0bd2c6b0ULL, 0x78178d5f63d8cf3dULL, 0xbb637c70110d11e3ULL, 0x9c1e840336571300ULL,
+			0xf21f5032bdd37d26ULL, 0x7326b221676b525cULL, 0x13cb7184b2ca93f8ULL, 0x5d24a6fbaacaf8dfULL,
+			0x80634470c5e6baeeULL, 0xe5d7934992a80c1bULL, 0xaf2c8844df8b3ac3ULL, 0x897dfcd72b4efc76ULL,
+			0x9991c5def135bc0eULL, 0x3ff723bd9fd514f6ULL, 0xf8f8f705358f435fULL, 0x25fb09a9606d6a19ULL,
+			0x3798b087a9ae168dULL, 0x8bb94a6b9c6949e0ULL, 0x009b21eabed9e373ULL, 0x11d4f9b83958ec75ULL
+		},
+		{
+			0xfd223c51c345e0edULL, 0x13bf4f7ced7ef06cULL, 0x1d49595db80d968cULL, 0x610f4e13ef8baea1ULL,
+			0xdad617533c1331bcULL, 0x086df911092ef8dfULL, 0x392838b65a4572eeULL, 0x22709df80ee6838bULL,
+			0x37952d490fb2cc4cULL, 0x7a5425885d3f3ad4ULL, 0x37ff2e51065371a1ULL, 0x1a9dd9e960b39f02ULL,
+			0xc8ca6efe1c0d78bcULL, 0x88551edcd6e6cd4dULL, 0x19c987abe87ff397ULL, 0x2fcc3f134d4109b0ULL,
+			0xbd523f49d5e9e7a3ULL, 0x1cb072607997bcacULL, 0x1989d3945ab438d5ULL, 0x7f5a1e58d3ddc5e4ULL,
+			0x70be7d442369876fULL, 0x17de579d9ee16fa1ULL, 0xa385df6ffa0f653eULL, 0xf8846565a26df474ULL,
+			0x75d4193f29e2b29cULL, 0xc0e8e967d8bc50f9ULL, 0xe8d6fe58de363618ULL, 0x8bd997dc9c2cdc74ULL,
+			0x38f32b0b843518ccULL, 0xa35d05ffbe98c1fdULL, 0x6c74c81ca1962f3eULL, 0x91b1c3e421790ce0ULL,
+			0x1217f08d1b16c6f9ULL, 0x534e67d4f6267534ULL, 0xbf4fa101f14df4deULL, 0xcbd57e852e2798b7ULL,
+			0xc5236de16a071a46ULL, 0x558fea9a41b945f2ULL, 0x9e5d7c4224270bf9ULL, 0x14d803127f8e9baeULL,
+			0x6467ef3f3190ad19ULL, 0x8a8d75e8ea7dea03ULL, 0x34943b51fbbdf117ULL, 0x42c5ea06577e2f35ULL,
+			0xab2aa9d33debbe2bULL, 0x2009c28791948397ULL, 0x1dc1551f3545af50ULL, 0xdaada98d0fb2f00eULL,
+			0x0f947e4b0bcc566eULL, 0xcb446d0bce879542ULL, 0xfb8dca5d9f878ae8ULL, 0xa8ff9d504bfd3ffdULL,
+			0x25ec58b2865e9ac2ULL, 0x5774b3300942d777ULL, 0xee68516abd396f19ULL, 0xfc0d9b37fcf5fb87ULL,
+			0x2b359064326211b0ULL, 0x5003256d5392b993ULL, 0x90c5a7520ae99820ULL, 0x57e1f6ffa1be4310ULL,
+			0x94778cd20e23fb96ULL, 0x483eadeb6e7199e1ULL, 0x13f2e84b52d32292ULL, 0xa44c5ccdd4426057ULL
+		},
+		{
+			0xb4986b7931d61157ULL, 0xff364bef657108b5ULL, 0x5638bdd1092767e4ULL, 0x729985ecae46502bULL,
+			0xf2a80113401db64bULL, 0x08ead3b028f77fe7ULL, 0x8c3eda088b3588d8ULL, 0x3e20f84d4dc8d5c9ULL,
+			0x27c47ce9939b1622ULL, 0x5106757c15a1e88eULL, 0xd6d9d5e5295f48dfULL, 0x99e301a71ed8218eULL,
+			0x635588008646324dULL, 0xb40292e6ca5d8d69ULL, 0x09e6b534b9614c33ULL, 0x9a47e1d16510e26bULL,
+			0x0b6209b7ed71396fULL, 0xf123ae61387260ddULL, 0x291d037f8c39135cULL, 0xa65aa90133fa367aULL,
+			0x065d69deb0f31c96ULL, 0x4f4ed7316c991f2fULL, 0xc22dbc93064006d1ULL, 0x3293c2cd95af129cULL,
+			0x836eeabe50616bb9ULL, 0xfb63612bd7b0672eULL, 0xb9bc562c78230c60ULL, 0x662bb9a2ed6c5278ULL,
+			0xa6b3281d505514dcULL, 0x04105945cec109f5ULL, 0x2d9f391c796c56a6ULL, 0x5592efe25f49e78bULL,
+			0xfaf893bc9877f684ULL, 0xd4381a6772b83869ULL, 0xed6a3764f1ec7259ULL, 0xe2c63ebbf4a21cfdULL,
+			0xe004b208675bc784ULL, 0x1d9486b6fb82110bULL, 0x36b2b4d55b0237e9ULL, 0xfffca003a448e9c6ULL,
+			0x316c75263f28c995ULL, 0xf9fa630a1ada5d46ULL, 0x98d3f1b10328787cULL, 0xd3c75208cb27b78cULL,
+			0xb6008ca1d26b9be3ULL, 0x99d96f2ad07dd414ULL, 0x2fca0d1a7552aabcULL, 0x4cdb11bd019720e9ULL,
+			0xff689c6ed39114e8ULL, 0xf41d1d4cd16c0cc1ULL, 0x8bc4cac41b65c498ULL, 0xf0ce9459a0932911ULL,
+			0x74178f7f843c6b03ULL, 0x9afc7d9a9f64b315ULL, 0x75307a02db721f33ULL, 0xf8d84264ee3f57cdULL,
+			0x1d4d7382b68b7a22ULL, 0x0c69a3e036d0a456ULL, 0x2485224df722d09eULL, 0x8aecf9461b1572bfULL,
+			0x714e4a00d31c179aULL, 0x20f9625a85268935ULL, 0xa19c07cbfa662967ULL, 0x45cbd01e88de5cf5ULL
+		}
+	}
+};
+
+const uint64_t zobrist_side = 0x1db9028bb3de7d0cULL;
+
+const uint64_t zobrist_castling[16] = {
+	0x75a09d17996b02f6ULL, 0xb3037369de21a973ULL, 0xf4adf58f1d1bd6e1ULL, 0x16885010cd10790cULL,
+	0xa6f0124a92499afeULL, 0xc0f77e2b4ac2764bULL, 0xc9d7b75be2cd0067ULL, 0x5a6a3e1c810a63a7ULL,
+	0xe75190a94ba47ea0ULL, 0xb5b2cf5f43429e5dULL, 0xc773682926ea2c21ULL, 0xebf9b73c2bdad039ULL,
+	0xc0e3f05f688c4bd9ULL, 0x257d351d7628850eULL, 0xcf068a67794c5784ULL, 0xfd7e2d33320dae2bULL
+};
+
+const uint64_t zobrist_ep[8] = {
+	0xcf613e6adda95fb7ULL, 0x9355ae72482300c8ULL, 0x87a7586c2df874c9ULL, 0x7ca28227a9e79660ULL,
+	0x5b5560ceef05c14cULL, 0xbe0a3350381e19ceULL, 0x11e64d98702b967dULL, 0x0bd198d9c4c3fe11ULL
+};
+
+const uint32_t kpk_table[6144] = {
+	0xfffffcfcu, 0xfffeffffu, 0xfffff8f8u, 0xfffeffffu,
+	0xfffff1f1u, 0xfffeffffu, 0xffffe3e3u, 0xfffeffffu,
+	0xffffc7c7u, 0xfffeffffu, 0xffff8f8fu, 0xfffeffffu,
+	0xffff1f1fu, 0xfffeffffu, 0xffff3f3fu, 0xfffeffffu,
+	0xfffcfcfcu, 0xfffeffffu, 0xfff8f8f8u, 0xfffeffffu,
+	0xfff1f1f1u, 0xfffeffffu, 0xffe3e3e3u, 0xfffeffffu,
+	0xffc7c7c7u, 0xfffeffffu, 0xff8f8f8fu, 0xfffeffffu,
+	0xff1f1f1fu, 0xfffeffffu, 0xff3f3f3fu, 0xfffeffffu,
+	0xfcfcfcffu, 0xfffeffffu, 0xf8f8f8ffu, 0xfffeffffu,
+	0xf1f1f1ffu, 0xfffeffffu, 0xe3e3e3ffu, 0xfffeffffu,
+	0xc7c7c7ffu, 0xfffeffffu, 0x8f8f8fffu, 0xfffeffffu,
+	0x1f1f1fffu, 0xfffeffffu, 0x3f3f3fffu, 0xfffeffffu,
+	0xfcfcffffu, 0xfffefffcu, 0xf8f8ffffu, 0xfffefff8u,
+	0xf1f1ffffu, 0xfffefff1u, 0xe3e3ffffu, 0xfffeffe3u,
+	0xc7c7ffffu, 0xfffeffc7u, 0x8f8fffffu, 0xfffeff8fu,
+	0x1f1fffffu, 0xfffeff1fu, 0x3f3fffffu, 0xfffeff3fu,
+	0xfcffffffu, 0xfffefcfcu, 0xf8ffffffu, 0xfffef8f8u,
+	0xf1ffffffu, 0xfffef1f1u, 0xe3ffffffu, 0xfffee3e3u,
+	0xc7ffffffu, 0xfffec7c7u, 0x8fffffffu, 0xfffe8f8fu,
+	0x1fffffffu, 0xfffe1f1fu, 0x3fffffffu, 0xfffe3f3fu,
+	0xffffffffu, 0xfffcfcfcu, 0xffffffffu, 0xfff8f8f8u,
+	0xffffffffu, 0xfff0f1f1u, 0xffffffffu, 0xffe2e3e3u,
+	0xffffffffu, 0xffc6c7c7u, 0xffffffffu, 0xff8e8f8fu,
+	0xffffffffu, 0xff1e1f1fu, 0xffffffffu, 0xff3e3f3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0xffffffffu, 0xf0f0f1ffu, 0xffffffffu, 0xe3e2e3ffu,
+	0xffffffffu, 0xc7c6c7ffu, 0xffffffffu, 0x8f8e8fffu,
+	0xffffffffu, 0x1f1e1fffu, 0xffffffffu, 0x3f3e3fffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0xffffffffu, 0xf0f0ffffu, 0xffffffffu, 0xe3e2ffffu,
+	0xffffffffu, 0xc7c6ffffu, 0xffffffffu, 0x8f8effffu,
+	0xffffffffu, 0x1f1effffu, 0xffffffffu, 0x3f3effffu,
+	0xfffffcfcu, 0xfffeffffu, 0xfffff8f8u, 0xfffeffffu,
+	0xfffff1f1u, 0xfffeffffu, 0xffffe3e3u, 0xfffeffffu,
+	0xffffc7c7u, 0xfffeffffu, 0xffff8f8fu, 0xfffeffffu,
+	0xffff1f1fu, 0xfffeffffu, 0xffff3f3fu, 0xfffeffffu,
+	0xfffcfcfcu, 0xfffeffffu, 0xfff8f8f8u, 0xfffeffffu,
+	0xfff1f1f1u, 0xfffeffffu, 0xffe3e3e3u, 0xfffeffffu,
+	0xffc7c7c7u, 0xfffeffffu, 0xff8f8f8fu, 0xfffeffffu,
+	0xff1f1f1fu, 0xfffeffffu, 0xff3f3f3fu, 0xfffeffffu,
+	0xfcfcfcffu, 0xfffeffffu, 0xf8f8f8ffu, 0xfffeffffu,
+	0xf1f1f1ffu, 0xfffeffffu, 0xe3e3e3ffu, 0xfffeffffu,
+	0xc7c7c7ffu, 0xfffeffffu, 0x8f8f8fffu, 0xfffeffffu,
+	0x1f1f1fffu, 0xfffeffffu, 0x3f3f3fffu, 0xfffeffffu,
+	0xfcfcffffu, 0xfffefffcu, 0xf8f8ffffu, 0xfffefff8u,
+	0xf1f1ffffu, 0xfffefff1u, 0xe3e3ffffu, 0xfffeffe3u,
+	0xc7c7ffffu, 0xfffeffc7u, 0x8f8fffffu, 0xfffeff8fu,
+	0x1f1fffffu, 0xfffeff1fu, 0x3f3fffffu, 0xfffeff3fu,
+	0xfcffffffu, 0xfffefcfcu, 0xf8ffffffu, 0xfffef8f8u,
+	0xf1ffffffu, 0xfffef1f1u, 0xe3ffffffu, 0xfffee3e3u,
+	0xc7ffffffu, 0xfffec7c7u, 0x8fffffffu, 0xfffe8f8fu,
+	0x1fffffffu, 0xfffe1f1fu, 0x3fffffffu, 0xfffe3f3fu,
+	0x00000000u, 0x03000000u, 0x00000000u, 0x02000000u,
+	0x00000000u, 0x06000100u, 0xffffffffu, 0xfee2e3e3u,
+	0xffffffffu, 0xffc6c7c7u, 0xffffffffu, 0xff8e8f8fu,
+	0xffffffffu, 0xff1e1f1fu, 0xffffffffu, 0xff3e3f3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000100u, 0xffffffffu, 0xe2e2e3ffu,
+	0xffffffffu, 0xc7c6c7ffu, 0xffffffffu, 0x8f8e8fffu,
+	0xffffffffu, 0x1f1e1fffu, 0xffffffffu, 0x3f3e3fffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000700u, 0xffffffffu, 0xe2e2ffffu,
+	0xffffffffu, 0xc7c6ffffu, 0xffffffffu, 0x8f8effffu,
+	0xffffffffu, 0x1f1effffu, 0xffffffffu, 0x3f3effffu,
+	0xfffffcfcu, 0xfffdffffu, 0xfffff8f8u, 0xfffdffffu,
+	0xfffff1f1u, 0xfffdffffu, 0xffffe3e3u, 0xfffdffffu,
+	0xffffc7c7u, 0xfffdffffu, 0xffff8f8fu, 0xfffdffffu,
+	0xffff1f1fu, 0xfffdffffu, 0xffff3f3fu, 0xfffdffffu,
+	0xfffcfcfcu, 0xfffdffffu, 0xfff8f8f8u, 0xfffdffffu,
+	0xfff1f1f1u, 0xfffdffffu, 0xffe3e3e3u, 0xfffdffffu,
+	0xffc7c7c7u, 0xfffdffffu, 0xff8f8f8fu, 0xfffdffffu,
+	0xff1f1f1fu, 0xfffdffffu, 0xff3f3f3fu, 0xfffdffffu,
+	0xfcfcfcffu, 0xfffdffffu, 0xf8f8f8ffu, 0xfffdffffu,
+	0xf1f1f1ffu, 0xfffdffffu, 0xe3e3e3ffu, 0xfffdffffu,
+	0xc7c7c7ffu, 0xfffdffffu, 0x8f8f8fffu, 0xfffdffffu,
+	0x1f1f1fffu, 0xfffdffffu, 0x3f3f3fffu, 0xfffdffffu,
+	0xfcfcffffu, 0xfffdfffcu, 0xf8f8ffffu, 0xfffdfff8u,
+	0xf1f1ffffu, 0xfffdfff1u, 0xe3e3ffffu, 0xfffdffe3u,
+	0xc7c7ffffu, 0xfffdffc7u, 0x8f8fffffu, 0xfffdff8fu,
+	0x1f1fffffu, 0xfffdff1fu, 0x3f3fffffu, 0xfffdff3fu,
+	0xfcffffffu, 0xfffdfcfcu, 0xf8ffffffu, 0xfffdf8f8u,
+	0xf1ffffffu, 0xfffdf1f1u, 0xe3ffffffu, 0xfffde3e3u,
+	0xc7ffffffu, 0xfffdc7c7u, 0x8fffffffu, 0xfffd8f8fu,
+	0x1fffffffu, 0xfffd1f1fu, 0x3fffffffu, 0xfffd3f3fu,
+	0xffffffffu, 0xfffcfcfcu, 0xffffffffu, 0xfff8f8f8u,
+	0xffffffffu, 0xfff1f1f1u, 0xffffffffu, 0xffe1e3e3u,
+	0xffffffffu, 0xffc5c7c7u, 0xffffffffu, 0xff8d8f8fu,
+	0xffffffffu, 0xff1d1f1fu, 0xffffffffu, 0xff3d3f3fu,
+	0x00000000u, 0x0c0c0c00u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x01010100u, 0xffffffffu, 0xe3e1e3ffu,
+	0xffffffffu, 0xc7c5c7ffu, 0xffffffffu, 0x8f8d8fffu,
+	0xffffffffu, 0x1f1d1fffu, 0xffffffffu, 0x3f3d3fffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00080a0fu,
+	0x00000000u, 0x00000000u, 0xffffffffu, 0xe3e1ffffu,
+	0xffffffffu, 0xc7c5ffffu, 0xffffffffu, 0x8f8dffffu,
+	0xffffffffu, 0x1f1dffffu, 0xffffffffu, 0x3f3dffffu,
+	0xfffffcfcu, 0xfffdffffu, 0xfffff8f8u, 0xfffdffffu,
+	0xfffff1f1u, 0xfffdffffu, 0xffffe3e3u, 0xfffdffffu,
+	0xffffc7c7u, 0xfffdffffu, 0xffff8f8fu, 0xfffdffffu,
+	0xffff1f1fu, 0xfffdffffu, 0xffff3f3fu, 0xfffdffffu,
+	0xfffcfcfcu, 0xfffdffffu, 0xfff8f8f8u, 0xfffdffffu,
+	0xfff1f1f1u, 0xfffdffffu, 0xffe3e3e3u, 0xfffdffffu,
+	0xffc7c7c7u, 0xfffdffffu, 0xff8f8f8fu, 0xfffdffffu,
+	0xff1f1f1fu, 0xfffdffffu, 0xff3f3f3fu, 0xfffdffffu,
+	0xfcfcfcffu, 0xfffdffffu, 0xf8f8f8ffu, 0xfffdffffu,
+	0xf1f1f1ffu, 0xfffdffffu, 0xe3e3e3ffu, 0xfffdffffu,
+	0xc7c7c7ffu, 0xfffdffffu, 0x8f8f8fffu, 0xfffdffffu,
+	0x1f1f1fffu, 0xfffdffffu, 0x3f3f3fffu, 0xfffdffffu,
+	0xfcfcffffu, 0xfffdfffcu, 0xf8f8ffffu, 0xfffdfff8u,
+	0xf1f1ffffu, 0xfffdfff1u, 0xe3e3ffffu, 0xfffdffe3u,
+	0xc7c7ffffu, 0xfffdffc7u, 0x8f8fffffu, 0xfffdff8fu,
+	0x1f1fffffu, 0xfffdff1fu, 0x3f3fffffu, 0xfffdff3fu,
+	0xfcffffffu, 0xfffdfcfcu, 0xf8ffffffu, 0xfffdf8f8u,
+	0xf1ffffffu, 0xfffdf1f1u, 0xe3ffffffu, 0xfffde3e3u,
+	0xc7ffffffu, 0xfffdc7c7u, 0x8fffffffu, 0xfffd8f8fu,
+	0x1fffffffu, 0xfffd1f1fu, 0x3fffffffu, 0xfffd3f3fu,
+	0x00000000u, 0x07040400u, 0x00000000u, 0x07000000u,
+	0x00000000u, 0x07010100u, 0x00000000u, 0x0f010300u,
+	0xffffffffu, 0xffc5c7c7u, 0xffffffffu, 0xff8d8f8fu,
+	0xffffffffu, 0xff1d1f1fu, 0xffffffffu, 0xff3d3f3fu,
+	0x00000000u, 0x04040000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x01010000u, 0x00000000u, 0x03010300u,
+	0xffffffffu, 0xc7c5c7ffu, 0xffffffffu, 0x8f8d8fffu,
+	0xffffffffu, 0x1f1d1fffu, 0xffffffffu, 0x3f3d3fffu,
+	0x00000000u, 0x04040200u, 0x00000000u, 0x00000500u,
+	0x00000000u, 0x01010200u, 0x00000000u, 0x03010f00u,
+	0xffffffffu, 0xc7c5ffffu, 0xffffffffu, 0x8f8dffffu,
+	0xffffffffu, 0x1f1dffffu, 0xffffffffu, 0x3f3dffffu,
+	0xfffffcfcu, 0xfffbffffu, 0xfffff8f8u, 0xfffbffffu,
+	0xfffff1f1u, 0xfffbffffu, 0xffffe3e3u, 0xfffbffffu,
+	0xffffc7c7u, 0xfffbffffu, 0xffff8f8fu, 0xfffbffffu,
+	0xffff1f1fu, 0xfffbffffu, 0xffff3f3fu, 0xfffbffffu,
+	0xfffcfcfcu, 0xfffbffffu, 0xfff8f8f8u, 0xfffbffffu,
+	0xfff1f1f1u, 0xfffbffffu, 0xffe3e3e3u, 0xfffbffffu,
+	0xffc7c7c7u, 0xfffbffffu, 0xff8f8f8fu, 0xfffbffffu,
+	0xff1f1f1fu, 0xfffbffffu, 0xff3f3f3fu, 0xfffbffffu,
+	0xfcfcfcffu, 0xfffbffffu, 0xf8f8f8ffu, 0xfffbffffu,
+	0xf1f1f1ffu, 0xfffbffffu, 0xe3e3e3ffu, 0xfffbffffu,
+	0xc7c7c7ffu, 0xfffbffffu, 0x8f8f8fffu, 0xfffbffffu,
+	0x1f1f1fffu, 0xfffbffffu, 0x3f3f3fffu, 0xfffbffffu,
+	0xfcfcffffu, 0xfffbfffcu, 0xf8f8ffffu, 0xfffbfff8u,
+	0xf1f1ffffu, 0xfffbfff1u, 0xe3e3ffffu, 0xfffbffe3u,
+	0xc7c7ffffu, 0xfffbffc7u, 0x8f8fffffu, 0xfffbff8fu,
+	0x1f1fffffu, 0xfffbff1fu, 0x3f3fffffu, 0xfffbff3fu,
+	0xfcffffffu, 0xfffbfcfcu, 0xf8ffffffu, 0xfffbf8f8u,
+	0xf1ffffffu, 0xfffbf1f1u, 0xe3ffffffu, 0xfffbe3e3u,
+	0xc7ffffffu, 0xfffbc7c7u, 0x8fffffffu, 0xfffb8f8fu,
+	0x1fffffffu, 0xfffb1f1fu, 0x3fffffffu, 0xfffb3f3fu,
+	0xffffffffu, 0xfff8fcfcu, 0xffffffffu, 0xfff8f8f8u,
+	0xffffffffu, 0xfff1f1f1u, 0xffffffffu, 0xffe3e3e3u,
+	0xffffffffu, 0xffc3c7c7u, 0xffffffffu, 0xff8b8f8fu,
+	0xffffffffu, 0xff1b1f1fu, 0xffffffffu, 0xff3b3f3fu,
+	0xffffffffu, 0xfcf8fcffu, 0x00000000u, 0x18181800u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x03030300u,
+	0xffffffffu, 0xc7c3c7ffu, 0xffffffffu, 0x8f8b8fffu,
+	0xffffffffu, 0x1f1b1fffu, 0xffffffffu, 0x3f3b3fffu,
+	0xffffffffu, 0xfcf8ffffu, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x0011151fu, 0x00000000u, 0x00000000u,
+	0xffffffffu, 0xc7c3ffffu, 0xffffffffu, 0x8f8bffffu,
+	0xffffffffu, 0x1f1bffffu, 0xffffffffu, 0x3f3bffffu,
+	0xfffffcfcu, 0xfffbffffu, 0xfffff8f8u, 0xfffbffffu,
+	0xfffff1f1u, 0xfffbffffu, 0xffffe3e3u, 0xfffbffffu,
+	0xffffc7c7u, 0xfffbffffu, 0xffff8f8fu, 0xfffbffffu,
+	0xffff1f1fu, 0xfffbffffu, 0xffff3f3fu, 0xfffbffffu,
+	0xfffcfcfcu, 0xfffbffffu, 0xfff8f8f8u, 0xfffbffffu,
+	0xfff1f1f1u, 0xfffbffffu, 0xffe3e3e3u, 0xfffbffffu,
+	0xffc7c7c7u, 0xfffbffffu, 0xff8f8f8fu, 0xfffbffffu,
+	0xff1f1f1fu, 0xfffbffffu, 0xff3f3f3fu, 0xfffbffffu,
+	0xfcfcfcffu, 0xfffbffffu, 0xf8f8f8ffu, 0xfffbffffu,
+	0xf1f1f1ffu, 0xfffbffffu, 0xe3e3e3ffu, 0xfffbffffu,
+	0xc7c7c7ffu, 0xfffbffffu, 0x8f8f8fffu, 0xfffbffffu,
+	0x1f1f1fffu, 0xfffbffffu, 0x3f3f3fffu, 0xfffbffffu,
+	0xfcfcffffu, 0xfffbfffcu, 0xf8f8ffffu, 0xfffbfff8u,
+	0xf1f1ffffu, 0xfffbfff1u, 0xe3e3ffffu, 0xfffbffe3u,
+	0xc7c7ffffu, 0xfffbffc7u, 0x8f8fffffu, 0xfffbff8fu,
+	0x1f1fffffu, 0xfffbff1fu, 0x3f3fffffu, 0xfffbff3fu,
+	0xfcffffffu, 0xfffbfcfcu, 0xf8ffffffu, 0xfffbf8f8u,
+	0xf1ffffffu, 0xfffbf1f1u, 0xe3ffffffu, 0xfffbe3e3u,
+	0xc7ffffffu, 0xfffbc7c7u, 0x8fffffffu, 0xfffb8f8fu,
+	0x1fffffffu, 0xfffb1f1fu, 0x3fffffffu, 0xfffb3f3fu,
+	0x00000000u, 0x1f181c00u, 0x00000000u, 0x0e080800u,
+	0x00000000u, 0x0e000000u, 0x00000000u, 0x0e020200u,
+	0x00000000u, 0x1f030700u, 0xffffffffu, 0xff8b8f8fu,
+	0xffffffffu, 0xff1b1f1fu, 0xffffffffu, 0xff3b3f3fu,
+	0x00000000u, 0x1c181c00u, 0x00000000u, 0x08080000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x02020000u,
+	0x00000000u, 0x07030700u, 0xffffffffu, 0x8f8b8fffu,
+	0xffffffffu, 0x1f1b1fffu, 0xffffffffu, 0x3f3b3fffu,
+	0x00000000u, 0x1c181c00u, 0x00000000u, 0x08080400u,
+	0x00000000u, 0x00000a00u, 0x00000000u, 0x02020400u,
+	0x00000000u, 0x07031f00u, 0xffffffffu, 0x8f8bffffu,
+	0xffffffffu, 0x1f1bffffu, 0xffffffffu, 0x3f3bffffu,
+	0xfffffcfcu, 0xfff7ffffu, 0xfffff8f8u, 0xfff7ffffu,
+	0xfffff1f1u, 0xfff7ffffu, 0xffffe3e3u, 0xfff7ffffu,
+	0xffffc7c7u, 0xfff7ffffu, 0xffff8f8fu, 0xfff7ffffu,
+	0xffff1f1fu, 0xfff7ffffu, 0xffff3f3fu, 0xfff7ffffu,
+	0xfffcfcfcu, 0xfff7ffffu, 0xfff8f8f8u, 0xfff7ffffu,
+	0xfff1f1f1u, 0xfff7ffffu, 0xffe3e3e3u, 0xfff7ffffu,
+	0xffc7c7c7u, 0xfff7ffffu, 0xff8f8f8fu, 0xfff7ffffu,
+	0xff1f1f1fu, 0xfff7ffffu, 0xff3f3f3fu, 0xfff7ffffu,
+	0xfcfcfcffu, 0xfff7ffffu, 0xf8f8f8ffu, 0xfff7ffffu,
+	0xf1f1f1ffu, 0xfff7ffffu, 0xe3e3e3ffu, 0xfff7ffffu,
+	0xc7c7c7ffu, 0xfff7ffffu, 0x8f8f8fffu, 0xfff7ffffu,
+	0x1f1f1fffu, 0xfff7ffffu, 0x3f3f3fffu, 0xfff7ffffu,
+	0xfcfcffffu, 0xfff7fffcu, 0xf8f8ffffu, 0xfff7fff8u,
+	0xf1f1ffffu, 0xfff7fff1u, 0xe3e3ffffu, 0xfff7ffe3u,
+	0xc7c7ffffu, 0xfff7ffc7u, 0x8f8fffffu, 0xfff7ff8fu,
+	0x1f1fffffu, 0xfff7ff1fu, 0x3f3fffffu, 0xfff7ff3fu,
+	0xfcffffffu, 0xfff7fcfcu, 0xf8ffffffu, 0xfff7f8f8u,
+	0xf1ffffffu, 0xfff7f1f1u, 0xe3ffffffu, 0xfff7e3e3u,
+	0xc7ffffffu, 0xfff7c7c7u, 0x8fffffffu, 0xfff78f8fu,
+	0x1fffffffu, 0xfff71f1fu, 0x3fffffffu, 0xfff73f3fu,
+	0xffffffffu, 0xfff4fcfcu, 0xffffffffu, 0xfff0f8f8u,
+	0xffffffffu, 0xfff1f1f1u, 0xffffffffu, 0xffe3e3e3u,
+	0xffffffffu, 0xffc7c7c7u, 0xffffffffu, 0xff878f8fu,
+	0xffffffffu, 0xff171f1fu, 0xffffffffu, 0xff373f3fu,
+	0xffffffffu, 0xfcf4fcffu, 0xffffffffu, 0xf8f0f8ffu,
+	0x00000000u, 0x30303000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x06060600u, 0xffffffffu, 0x8f878fffu,
+	0xffffffffu, 0x1f171fffu, 0xffffffffu, 0x3f373fffu,
+	0xffffffffu, 0xfcf4ffffu, 0xffffffffu, 0xf8f0ffffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00222a3eu,
+	0x00000000u, 0x00000000u, 0xffffffffu, 0x8f87ffffu,
+	0xffffffffu, 0x1f17ffffu, 0xffffffffu, 0x3f37ffffu,
+	0xfffffcfcu, 0xfff7ffffu, 0xfffff8f8u, 0xfff7ffffu,
+	0xfffff1f1u, 0xfff7ffffu, 0xffffe3e3u, 0xfff7ffffu,
+	0xffffc7c7u, 0xfff7ffffu, 0xffff8f8fu, 0xfff7ffffu,
+	0xffff1f1fu, 0xfff7ffffu, 0xffff3f3fu, 0xfff7ffffu,
+	0xfffcfcfcu, 0xfff7ffffu, 0xfff8f8f8u, 0xfff7ffffu,
+	0xfff1f1f1u, 0xfff7ffffu, 0xffe3e3e3u, 0xfff7ffffu,
+	0xffc7c7c7u, 0xfff7ffffu, 0xff8f8f8fu, 0xfff7ffffu,
+	0xff1f1f1fu, 0xfff7ffffu, 0xff3f3f3fu, 0xfff7ffffu,
+	0xfcfcfcffu, 0xfff7ffffu, 0xf8f8f8ffu, 0xfff7ffffu,
+	0xf1f1f1ffu, 0xfff7ffffu, 0xe3e3e3ffu, 0xfff7ffffu,
+	0xc7c7c7ffu, 0xfff7ffffu, 0x8f8f8fffu, 0xfff7ffffu,
+	0x1f1f1fffu, 0xfff7ffffu, 0x3f3f3fffu, 0xfff7ffffu,
+	0xfcfcffffu, 0xfff7fffcu, 0xf8f8ffffu, 0xfff7fff8u,
+	0xf1f1ffffu, 0xfff7fff1u, 0xe3e3ffffu, 0xfff7ffe3u,
+	0xc7c7ffffu, 0xfff7ffc7u, 0x8f8fffffu, 0xfff7ff8fu,
+	0x1f1fffffu, 0xfff7ff1fu, 0x3f3fffffu, 0xfff7ff3fu,
+	0xfcffffffu, 0xfff7fcfcu, 0xf8ffffffu, 0xfff7f8f8u,
+	0xf1ffffffu, 0xfff7f1f1u, 0xe3ffffffu, 0xfff7e3e3u,
+	0xc7ffffffu, 0xfff7c7c7u, 0x8fffffffu, 0xfff78f8fu,
+	0x1fffffffu, 0xfff71f1fu, 0x3fffffffu, 0xfff73f3fu,
+	0xffffffffu, 0xfff4fcfcu, 0x00000000u, 0x3e303800u,
+	0x00000000u, 0x1c101000u, 0x00000000u, 0x1c000000u,
+	0x00000000u, 0x1c040400u, 0x00000000u, 0x3e060e00u,
+	0xffffffffu, 0xff171f1fu, 0xffffffffu, 0xff373f3fu,
+	0xffffffffu, 0xfcf4fcffu, 0x00000000u, 0x38303800u,
+	0x00000000u, 0x10100000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x04040000u, 0x00000000u, 0x0e060e00u,
+	0xffffffffu, 0x1f171fffu, 0xffffffffu, 0x3f373fffu,
+	0xffffffffu, 0xfcf4ffffu, 0x00000000u, 0x38303e00u,
+	0x00000000u, 0x10100800u, 0x00000000u, 0x00001400u,
+	0x00000000u, 0x04040800u, 0x00000000u, 0x0e063e00u,
+	0xffffffffu, 0x1f17ffffu, 0xffffffffu, 0x3f37ffffu,
+	0xfffffcfcu, 0xfffffeffu, 0xfffff8f8u, 0xfffffeffu,
+	0xfffff1f1u, 0xfffffeffu, 0xffffe3e3u, 0xfffffeffu,
+	0xffffc7c7u, 0xfffffeffu, 0xffff8f8fu, 0xfffffeffu,
+	0xffff1f1fu, 0xfffffeffu, 0xffff3f3fu, 0xfffffeffu,
+	0xfffcfcfcu, 0xfffffeffu, 0xfff8f8f8u, 0xfffffeffu,
+	0xfff1f1f1u, 0xfffffeffu, 0xffe3e3e3u, 0xfffffeffu,
+	0xffc7c7c7u, 0xfffffeffu, 0xff8f8f8fu, 0xfffffeffu,
+	0xff1f1f1fu, 0xfffffeffu, 0xff3f3f3fu, 0xfffffeffu,
+	0xfcfcfcffu, 0xfffffeffu, 0xf8f8f8ffu, 0xfffffeffu,
+	0xf1f1f1ffu, 0xfffffeffu, 0xe3e3e3ffu, 0xfffffeffu,
+	0xc7c7c7ffu, 0xfffffeffu, 0x8f8f8fffu, 0xfffffeffu,
+	0x1f1f1fffu, 0xfffffeffu, 0x3f3f3fffu, 0xfffffeffu,
+	0xfcfcffffu, 0xfffffefcu, 0xf8f8ffffu, 0xfffffef8u,
+	0xf1f1ffffu, 0xfffffef1u, 0xe3e3ffffu, 0xfffffee3u,
+	0xc7c7ffffu, 0xfffffec7u, 0x8f8fffffu, 0xfffffe8fu,
+	0x1f1fffffu, 0xfffffe1fu, 0x3f3fffffu, 0xfffffe3fu,
+	0xfcffffffu, 0xfffffcfcu, 0xf8ffffffu, 0xfffff8f8u,
+	0xf1ffffffu, 0xfffff0f1u, 0xe3ffffffu, 0xffffe2e3u,
+	0xc7ffffffu, 0xffffc6c7u, 0x8fffffffu, 0xffff8e8fu,
+	0x1fffffffu, 0xffff1e1fu, 0x3fffffffu, 0xffff3e3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x02000000u,
+	0x00000000u, 0x07010000u, 0xffffffffu, 0xffe3e2e3u,
+	0xffffffffu, 0xffc7c6c7u, 0xffffffffu, 0xff8f8e8fu,
+	0xffffffffu, 0xff1f1e1fu, 0xffffffffu, 0xff3f3e3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0xffffffffu, 0xe3e3e2ffu,
+	0xffffffffu, 0xc7c7c6ffu, 0xffffffffu, 0x8f8f8effu,
+	0xffffffffu, 0x1f1f1effu, 0xffffffffu, 0x3f3f3effu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000600u, 0xffffffffu, 0xe3e3feffu,
+	0xffffffffu, 0xc7c7feffu, 0xffffffffu, 0x8f8ffeffu,
+	0xffffffffu, 0x1f1ffeffu, 0xffffffffu, 0x3f3ffeffu,
+	0xfffffcfcu, 0xfffffeffu, 0xfffff8f8u, 0xfffffeffu,
+	0xfffff1f1u, 0xfffffeffu, 0xffffe3e3u, 0xfffffeffu,
+	0xffffc7c7u, 0xfffffeffu, 0xffff8f8fu, 0xfffffeffu,
+	0xffff1f1fu, 0xfffffeffu, 0xffff3f3fu, 0xfffffeffu,
+	0xfffcfcfcu, 0xfffffeffu, 0xfff8f8f8u, 0xfffffeffu,
+	0xfff1f1f1u, 0xfffffeffu, 0xffe3e3e3u, 0xfffffeffu,
+	0xffc7c7c7u, 0xfffffeffu, 0xff8f8f8fu, 0xfffffeffu,
+	0xff1f1f1fu, 0xfffffeffu, 0xff3f3f3fu, 0xfffffeffu,
+	0xfcfcfcffu, 0xfffffeffu, 0xf8f8f8ffu, 0xfffffeffu,
+	0xf1f1f1ffu, 0xfffffeffu, 0xe3e3e3ffu, 0xfffffeffu,
+	0xc7c7c7ffu, 0xfffffeffu, 0x8f8f8fffu, 0xfffffeffu,
+	0x1f1f1fffu, 0xfffffeffu, 0x3f3f3fffu, 0xfffffeffu,
+	0xfcfcffffu, 0xfffffefcu, 0xf8f8ffffu, 0xfffffef8u,
+	0xf1f1ffffu, 0xfffffef1u, 0xe3e3ffffu, 0xfffffee3u,
+	0xc7c7ffffu, 0xfffffec7u, 0x8f8fffffu, 0xfffffe8fu,
+	0x1f1fffffu, 0xfffffe1fu, 0x3f3fffffu, 0xfffffe3fu,
+	0x00000000u, 0x00030000u, 0x00000000u, 0x00030000u,
+	0x00000000u, 0x02070000u, 0x00000000u, 0x070f0202u,
+	0xc7ffffffu, 0xffffc6c7u, 0x8fffffffu, 0xffff8e8fu,
+	0x1fffffffu, 0xffff1e1fu, 0x3fffffffu, 0xffff3e3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x02000000u, 0x00000000u, 0x06020200u,
+	0xffffffffu, 0xffc7c6c7u, 0xffffffffu, 0xff8f8e8fu,
+	0xffffffffu, 0xff1f1e1fu, 0xffffffffu, 0xff3f3e3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x02020200u,
+	0xffffffffu, 0xc7c7c6ffu, 0xffffffffu, 0x8f8f8effu,
+	0xffffffffu, 0x1f1f1effu, 0xffffffffu, 0x3f3f3effu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x02020600u,
+	0xffffffffu, 0xc7c7feffu, 0xffffffffu, 0x8f8ffeffu,
+	0xffffffffu, 0x1f1ffeffu, 0xffffffffu, 0x3f3ffeffu,
+	0xfffffcfcu, 0xfffffdffu, 0xfffff8f8u, 0xfffffdffu,
+	0xfffff1f1u, 0xfffffdffu, 0xffffe3e3u, 0xfffffdffu,
+	0xffffc7c7u, 0xfffffdffu, 0xffff8f8fu, 0xfffffdffu,
+	0xffff1f1fu, 0xfffffdffu, 0xffff3f3fu, 0xfffffdffu,
+	0xfffcfcfcu, 0xfffffdffu, 0xfff8f8f8u, 0xfffffdffu,
+	0xfff1f1f1u, 0xfffffdffu, 0xffe3e3e3u, 0xfffffdffu,
+	0xffc7c7c7u, 0xfffffdffu, 0xff8f8f8fu, 0xfffffdffu,
+	0xff1f1f1fu, 0xfffffdffu, 0xff3f3f3fu, 0xfffffdffu,
+	0xfcfcfcffu, 0xfffffdffu, 0xf8f8f8ffu, 0xfffffdffu,
+	0xf1f1f1ffu, 0xfffffdffu, 0xe3e3e3ffu, 0xfffffdffu,
+	0xc7c7c7ffu, 0xfffffdffu, 0x8f8f8fffu, 0xfffffdffu,
+	0x1f1f1fffu, 0xfffffdffu, 0x3f3f3fffu, 0xfffffdffu,
+	0xfcfcffffu, 0xfffffdfcu, 0xf8f8ffffu, 0xfffffdf8u,
+	0xf1f1ffffu, 0xfffffdf1u, 0xe3e3ffffu, 0xfffffde3u,
+	0xc7c7ffffu, 0xfffffdc7u, 0x8f8fffffu, 0xfffffd8fu,
+	0x1f1fffffu, 0xfffffd1fu, 0x3f3fffffu, 0xfffffd3fu,
+	0xfcffffffu, 0xfffffcfcu, 0xf8ffffffu, 0xfffff8f8u,
+	0xf1ffffffu, 0xfffff1f1u, 0xe3ffffffu, 0xffffe1e3u,
+	0xc7ffffffu, 0xffffc5c7u, 0x8fffffffu, 0xffff8d8fu,
+	0x1fffffffu, 0xffff1d1fu, 0x3fffffffu, 0xffff3d3fu,
+	0x00000000u, 0x0f0c0c0cu, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x07010101u, 0x07000000u, 0x0f030103u,
+	0xffffffffu, 0xffc7c5c7u, 0xffffffffu, 0xff8f8d8fu,
+	0xffffffffu, 0xff1f1d1fu, 0xffffffffu, 0xff3f3d3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x1f000000u, 0x0303011fu,
+	0xffffffffu, 0xc7c7c5ffu, 0xffffffffu, 0x8f8f8dffu,
+	0xffffffffu, 0x1f1f1dffu, 0xffffffffu, 0x3f3f3dffu,
+	0x00000000u, 0x040c080fu, 0x00000000u, 0x00000500u,
+	0x00000000u, 0x0101090fu, 0x1f000000u, 0x03031d1fu,
+	0xffffffffu, 0xc7c7fdffu, 0xffffffffu, 0x8f8ffdffu,
+	0xffffffffu, 0x1f1ffdffu, 0xffffffffu, 0x3f3ffdffu,
+	0xfffffcfcu, 0xfffffdffu, 0xfffff8f8u, 0xfffffdffu,
+	0xfffff1f1u, 0xfffffdffu, 0xffffe3e3u, 0xfffffdffu,
+	0xffffc7c7u, 0xfffffdffu, 0xffff8f8fu, 0xfffffdffu,
+	0xffff1f1fu, 0xfffffdffu, 0xffff3f3fu, 0xfffffdffu,
+	0xfffcfcfcu, 0xfffffdffu, 0xfff8f8f8u, 0xfffffdffu,
+	0xfff1f1f1u, 0xfffffdffu, 0xffe3e3e3u, 0xfffffdffu,
+	0xffc7c7c7u, 0xfffffdffu, 0xff8f8f8fu, 0xfffffdffu,
+	0xff1f1f1fu, 0xfffffdffu, 0xff3f3f3fu, 0xfffffdffu,
+	0xfcfcfcffu, 0xfffffdffu, 0xf8f8f8ffu, 0xfffffdffu,
+	0xf1f1f1ffu, 0xfffffdffu, 0xe3e3e3ffu, 0xfffffdffu,
+	0xc7c7c7ffu, 0xfffffdffu, 0x8f8f8fffu, 0xfffffdffu,
+	0x1f1f1fffu, 0xfffffdffu, 0x3f3f3fffu, 0xfffffdffu,
+	0xfcfcffffu, 0xfffffdfcu, 0xf8f8ffffu, 0xfffffdf8u,
+	0xf1f1ffffu, 0xfffffdf1u, 0xe3e3ffffu, 0xfffffde3u,
+	0xc7c7ffffu, 0xfffffdc7u, 0x8f8fffffu, 0xfffffd8fu,
+	0x1f1fffffu, 0xfffffd1fu, 0x3f3fffffu, 0xfffffd3fu,
+	0x00000000u, 0x00070404u, 0x00000000u, 0x00070000u,
+	0x00000000u, 0x00070101u, 0x00000000u, 0x070f0103u,
+	0x07000000u, 0x0f1f0507u, 0x8fffffffu, 0xffff8d8fu,
+	0x1fffffffu, 0xffff1d1fu, 0x3fffffffu, 0xffff3d3fu,
+	0x00000000u, 0x00040400u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00010100u, 0x00000000u, 0x07030103u,
+	0x07000000u, 0x0f070507u, 0xffffffffu, 0xff8f8d8fu,
+	0xffffffffu, 0xff1f1d1fu, 0xffffffffu, 0xff3f3d3fu,
+	0x00000000u, 0x00040000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00010100u, 0x00000000u, 0x0303010fu,
+	0x07000000u, 0x0707051fu, 0xffffffffu, 0x8f8f8dffu,
+	0xffffffffu, 0x1f1f1dffu, 0xffffffffu, 0x3f3f3dffu,
+	0x00000000u, 0x00000500u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x01010500u, 0x00000000u, 0x0303090fu,
+	0x1f000000u, 0x07071d1fu, 0xffffffffu, 0x8f8ffdffu,
+	0xffffffffu, 0x1f1ffdffu, 0xffffffffu, 0x3f3ffdffu,
+	0xfffffcfcu, 0xfffffbffu, 0xfffff8f8u, 0xfffffbffu,
+	0xfffff1f1u, 0xfffffbffu, 0xffffe3e3u, 0xfffffbffu,
+	0xffffc7c7u, 0xfffffbffu, 0xffff8f8fu, 0xfffffbffu,
+	0xffff1f1fu, 0xfffffbffu, 0xffff3f3fu, 0xfffffbffu,
+	0xfffcfcfcu, 0xfffffbffu, 0xfff8f8f8u, 0xfffffbffu,
+	0xfff1f1f1u, 0xfffffbffu, 0xffe3e3e3u, 0xfffffbffu,
+	0xffc7c7c7u, 0xfffffbffu, 0xff8f8f8fu, 0xfffffbffu,
+	0xff1f1f1fu, 0xfffffbffu, 0xff3f3f3fu, 0xfffffbffu,
+	0xfcfcfcffu, 0xfffffbffu, 0xf8f8f8ffu, 0xfffffbffu,
+	0xf1f1f1ffu, 0xfffffbffu, 0xe3e3e3ffu, 0xfffffbffu,
+	0xc7c7c7ffu, 0xfffffbffu, 0x8f8f8fffu, 0xfffffbffu,
+	0x1f1f1fffu, 0xfffffbffu, 0x3f3f3fffu, 0xfffffbffu,
+	0xfcfcffffu, 0xfffffbfcu, 0xf8f8ffffu, 0xfffffbf8u,
+	0xf1f1ffffu, 0xfffffbf1u, 0xe3e3ffffu, 0xfffffbe3u,
+	0xc7c7ffffu, 0xfffffbc7u, 0x8f8fffffu, 0xfffffb8fu,
+	0x1f1fffffu, 0xfffffb1fu, 0x3f3fffffu, 0xfffffb3fu,
+	0xfcffffffu, 0xfffff8fcu, 0xf8ffffffu, 0xfffff8f8u,
+	0xf1ffffffu, 0xfffff1f1u, 0xe3ffffffu, 0xffffe3e3u,
+	0xc7ffffffu, 0xffffc3c7u, 0x8fffffffu, 0xffff8b8fu,
+	0x1fffffffu, 0xffff1b1fu, 0x3fffffffu, 0xffff3b3fu,
+	0x3e000000u, 0x3f3c383cu, 0x00000000u, 0x1e181818u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x0f030303u,
+	0x0f000000u, 0x1f070307u, 0xffffffffu, 0xff8f8b8fu,
+	0xffffffffu, 0xff1f1b1fu, 0xffffffffu, 0xff3f3b3fu,
+	0x3f000000u, 0x3c3c383fu, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x3f000000u, 0x0707033fu, 0xffffffffu, 0x8f8f8bffu,
+	0xffffffffu, 0x1f1f1bffu, 0xffffffffu, 0x3f3f3bffu,
+	0x3f000000u, 0x3c3c3b3fu, 0x00000000u, 0x1818191fu,
+	0x00000000u, 0x00000a00u, 0x00000000u, 0x0303131fu,
+	0x3f000000u, 0x07073b3fu, 0xffffffffu, 0x8f8ffbffu,
+	0xffffffffu, 0x1f1ffbffu, 0xffffffffu, 0x3f3ffbffu,
+	0xfffffcfcu, 0xfffffbffu, 0xfffff8f8u, 0xfffffbffu,
+	0xfffff1f1u, 0xfffffbffu, 0xffffe3e3u, 0xfffffbffu,
+	0xffffc7c7u, 0xfffffbffu, 0xffff8f8fu, 0xfffffbffu,
+	0xffff1f1fu, 0xfffffbffu, 0xffff3f3fu, 0xfffffbffu,
+	0xfffcfcfcu, 0xfffffbffu, 0xfff8f8f8u, 0xfffffbffu,
+	0xfff1f1f1u, 0xfffffbffu, 0xffe3e3e3u, 0xfffffbffu,
+	0xffc7c7c7u, 0xfffffbffu, 0xff8f8f8fu, 0xfffffbffu,
+	0xff1f1f1fu, 0xfffffbffu, 0xff3f3f3fu, 0xfffffbffu,
+	0xfcfcfcffu, 0xfffffbffu, 0xf8f8f8ffu, 0xfffffbffu,
+	0xf1f1f1ffu, 0xfffffbffu, 0xe3e3e3ffu, 0xfffffbffu,
+	0xc7c7c7ffu, 0xfffffbffu, 0x8f8f8fffu, 0xfffffbffu,
+	0x1f1f1fffu, 0xfffffbffu, 0x3f3f3fffu, 0xfffffbffu,
+	0xfcfcffffu, 0xfffffbfcu, 0xf8f8ffffu, 0xfffffbf8u,
+	0xf1f1ffffu, 0xfffffbf1u, 0xe3e3ffffu, 0xfffffbe3u,
+	0xc7c7ffffu, 0xfffffbc7u, 0x8f8fffffu, 0xfffffb8fu,
+	0x1f1fffffu, 0xfffffb1fu, 0x3f3fffffu, 0xfffffb3fu,
+	0x00000000u, 0x1e1f181cu, 0x00000000u, 0x000e0808u,
+	0x00000000u, 0x000e0000u, 0x00000000u, 0x000e0202u,
+	0x00000000u, 0x0f1f0307u, 0x0f000000u, 0x1f3f0b0fu,
+	0x1fffffffu, 0xffff1b1fu, 0x3fffffffu, 0xffff3b3fu,
+	0x00000000u, 0x1e1c181cu, 0x00000000u, 0x00080800u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00020200u,
+	0x00000000u, 0x0f070307u, 0x0f000000u, 0x1f0f0b0fu,
+	0xffffffffu, 0xff1f1b1fu, 0xffffffffu, 0xff3f3b3fu,
+	0x00000000u, 0x1c1c181fu, 0x00000000u, 0x00080800u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00020200u,
+	0x00000000u, 0x0707031fu, 0x0f000000u, 0x0f0f0b3fu,
+	0xffffffffu, 0x1f1f1bffu, 0xffffffffu, 0x3f3f3bffu,
+	0x00000000u, 0x1c1c191fu, 0x00000000u, 0x08080a00u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x02020a00u,
+	0x00000000u, 0x0707131fu, 0x3f000000u, 0x0f0f3b3fu,
+	0xffffffffu, 0x1f1ffbffu, 0xffffffffu, 0x3f3ffbffu,
+	0xfffffcfcu, 0xfffff7ffu, 0xfffff8f8u, 0xfffff7ffu,
+	0xfffff1f1u, 0xfffff7ffu, 0xffffe3e3u, 0xfffff7ffu,
+	0xffffc7c7u, 0xfffff7ffu, 0xffff8f8fu, 0xfffff7ffu,
+	0xffff1f1fu, 0xfffff7ffu, 0xffff3f3fu, 0xfffff7ffu,
+	0xfffcfcfcu, 0xfffff7ffu, 0xfff8f8f8u, 0xfffff7ffu,
+	0xfff1f1f1u, 0xfffff7ffu, 0xffe3e3e3u, 0xfffff7ffu,
+	0xffc7c7c7u, 0xfffff7ffu, 0xff8f8f8fu, 0xfffff7ffu,
+	0xff1f1f1fu, 0xfffff7ffu, 0xff3f3f3fu, 0xfffff7ffu,
+	0xfcfcfcffu, 0xfffff7ffu, 0xf8f8f8ffu, 0xfffff7ffu,
+	0xf1f1f1ffu, 0xfffff7ffu, 0xe3e3e3ffu, 0xfffff7ffu,
+	0xc7c7c7ffu, 0xfffff7ffu, 0x8f8f8fffu, 0xfffff7ffu,
+	0x1f1f1fffu, 0xfffff7ffu, 0x3f3f3fffu, 0xfffff7ffu,
+	0xfcfcffffu, 0xfffff7fcu, 0xf8f8ffffu, 0xfffff7f8u,
+	0xf1f1ffffu, 0xfffff7f1u, 0xe3e3ffffu, 0xfffff7e3u,
+	0xc7c7ffffu, 0xfffff7c7u, 0x8f8fffffu, 0xfffff78fu,
+	0x1f1fffffu, 0xfffff71fu, 0x3f3fffffu, 0xfffff73fu,
+	0xfcffffffu, 0xfffff4fcu, 0xf8ffffffu, 0xfffff0f8u,
+	0xf1ffffffu, 0xfffff1f1u, 0xe3ffffffu, 0xffffe3e3u,
+	0xc7ffffffu, 0xffffc7c7u, 0x8fffffffu, 0xffff878fu,
+	0x1fffffffu, 0xffff171fu, 0x3fffffffu, 0xffff373fu,
+	0xffffffffu, 0xfffcf4fcu, 0x7c000000u, 0x7e787078u,
+	0x00000000u, 0x3c303030u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x1e060606u, 0x1f000000u, 0x3f0f070fu,
+	0xffffffffu, 0xff1f171fu, 0xffffffffu, 0xff3f373fu,
+	0xffffffffu, 0xfcfcf4ffu, 0x7f000000u, 0x7878707fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x7f000000u, 0x0f0f077fu,
+	0xffffffffu, 0x1f1f17ffu, 0xffffffffu, 0x3f3f37ffu,
+	0xffffffffu, 0xfcfcf7ffu, 0x7f000000u, 0x7878777fu,
+	0x00000000u, 0x3030323eu, 0x00000000u, 0x00001400u,
+	0x00000000u, 0x0606263eu, 0x7f000000u, 0x0f0f777fu,
+	0xffffffffu, 0x1f1ff7ffu, 0xffffffffu, 0x3f3ff7ffu,
+	0xfffffcfcu, 0xfffff7ffu, 0xfffff8f8u, 0xfffff7ffu,
+	0xfffff1f1u, 0xfffff7ffu, 0xffffe3e3u, 0xfffff7ffu,
+	0xffffc7c7u, 0xfffff7ffu, 0xffff8f8fu, 0xfffff7ffu,
+	0xffff1f1fu, 0xfffff7ffu, 0xffff3f3fu, 0xfffff7ffu,
+	0xfffcfcfcu, 0xfffff7ffu, 0xfff8f8f8u, 0xfffff7ffu,
+	0xfff1f1f1u, 0xfffff7ffu, 0xffe3e3e3u, 0xfffff7ffu,
+	0xffc7c7c7u, 0xfffff7ffu, 0xff8f8f8fu, 0xfffff7ffu,
+	0xff1f1f1fu, 0xfffff7ffu, 0xff3f3f3fu, 0xfffff7ffu,
+	0xfcfcfcffu, 0xfffff7ffu, 0xf8f8f8ffu, 0xfffff7ffu,
+	0xf1f1f1ffu, 0xfffff7ffu, 0xe3e3e3ffu, 0xfffff7ffu,
+	0xc7c7c7ffu, 0xfffff7ffu, 0x8f8f8fffu, 0xfffff7ffu,
+	0x1f1f1fffu, 0xfffff7ffu, 0x3f3f3fffu, 0xfffff7ffu,
+	0xfcfcffffu, 0xfffff7fcu, 0xf8f8ffffu, 0xfffff7f8u,
+	0xf1f1ffffu, 0xfffff7f1u, 0xe3e3ffffu, 0xfffff7e3u,
+	0xc7c7ffffu, 0xfffff7c7u, 0x8f8fffffu, 0xfffff78fu,
+	0x1f1fffffu, 0xfffff71fu, 0x3f3fffffu, 0xfffff73fu,
+	0x7c000000u, 0x7e7f747cu, 0x00000000u, 0x3c3e3038u,
+	0x00000000u, 0x001c1010u, 0x00000000u, 0x001c0000u,
+	0x00000000u, 0x001c0404u, 0x00000000u, 0x1e3e060eu,
+	0x1f000000u, 0x3f7f171fu, 0x3fffffffu, 0xffff373fu,
+	0x7c000000u, 0x7e7c747cu, 0x00000000u, 0x3c383038u,
+	0x00000000u, 0x00101000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00040400u, 0x00000000u, 0x1e0e060eu,
+	0x1f000000u, 0x3f1f171fu, 0xffffffffu, 0xff3f373fu,
+	0x7c000000u, 0x7c7c747fu, 0x00000000u, 0x3838303eu,
+	0x00000000u, 0x00101000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00040400u, 0x00000000u, 0x0e0e063eu,
+	0x1f000000u, 0x1f1f177fu, 0xffffffffu, 0x3f3f37ffu,
+	0x7f000000u, 0x7c7c777fu, 0x00000000u, 0x3838323eu,
+	0x00000000u, 0x10101400u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x04041400u, 0x00000000u, 0x0e0e263eu,
+	0x7f000000u, 0x1f1f777fu, 0xffffffffu, 0x3f3ff7ffu,
+	0xfffffcfcu, 0xfffffffeu, 0xfffff8f8u, 0xfffffffeu,
+	0xfffff1f1u, 0xfffffffeu, 0xffffe3e3u, 0xfffffffeu,
+	0xffffc7c7u, 0xfffffffeu, 0xffff8f8fu, 0xfffffffeu,
+	0xffff1f1fu, 0xfffffffeu, 0xffff3f3fu, 0xfffffffeu,
+	0xfffcfcfcu, 0xfffffffeu, 0xfff8f8f8u, 0xfffffffeu,
+	0xfff1f1f1u, 0xfffffffeu, 0xffe3e3e3u, 0xfffffffeu,
+	0xffc7c7c7u, 0xfffffffeu, 0xff8f8f8fu, 0xfffffffeu,
+	0xff1f1f1fu, 0xfffffffeu, 0xff3f3f3fu, 0xfffffffeu,
+	0xfcfcfcffu, 0xfffffffeu, 0xf8f8f8ffu, 0xfffffffeu,
+	0xf1f1f1ffu, 0xfffffffeu, 0xe3e3e3ffu, 0xfffffffeu,
+	0xc7c7c7ffu, 0xfffffffeu, 0x8f8f8fffu, 0xfffffffeu,
+	0x1f1f1fffu, 0xfffffffeu, 0x3f3f3fffu, 0xfffffffeu,
+	0xfcfcffffu, 0xfffffffcu, 0xf8f8ffffu, 0xfffffff8u,
+	0xf1f1ffffu, 0xfffffff0u, 0xe3e3ffffu, 0xffffffe2u,
+	0xc7c7ffffu, 0xffffffc6u, 0x8f8fffffu, 0xffffff8eu,
+	0x1f1fffffu, 0xffffff1eu, 0x3f3fffffu, 0xffffff3eu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00030000u,
+	0x00000000u, 0x07070100u, 0x03000000u, 0x0f0f0302u,
+	0xc7ffffffu, 0xffffc7c6u, 0x8fffffffu, 0xffff8f8eu,
+	0x1fffffffu, 0xffff1f1eu, 0x3fffffffu, 0xffff3f3eu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x02000000u, 0x00000000u, 0x07030302u,
+	0xffffffffu, 0xffc7c7c6u, 0xffffffffu, 0xff8f8f8eu,
+	0xffffffffu, 0xff1f1f1eu, 0xffffffffu, 0xff3f3f3eu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x03030300u,
+	0xffffffffu, 0xc7c7c7feu, 0xffffffffu, 0x8f8f8ffeu,
+	0xffffffffu, 0x1f1f1ffeu, 0xffffffffu, 0x3f3f3ffeu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x03030700u,
+	0xffffffffu, 0xc7c7fffeu, 0xffffffffu, 0x8f8ffffeu,
+	0xffffffffu, 0x1f1ffffeu, 0xffffffffu, 0x3f3ffffeu,
+	0xfffffcfcu, 0xfffffffeu, 0xfffff8f8u, 0xfffffffeu,
+	0xfffff1f1u, 0xfffffffeu, 0xffffe3e3u, 0xfffffffeu,
+	0xffffc7c7u, 0xfffffffeu, 0xffff8f8fu, 0xfffffffeu,
+	0xffff1f1fu, 0xfffffffeu, 0xffff3f3fu, 0xfffffffeu,
+	0xfffcfcfcu, 0xfffffffeu, 0xfff8f8f8u, 0xfffffffeu,
+	0xfff1f1f1u, 0xfffffffeu, 0xffe3e3e3u, 0xfffffffeu,
+	0xffc7c7c7u, 0xfffffffeu, 0xff8f8f8fu, 0xfffffffeu,
+	0xff1f1f1fu, 0xfffffffeu, 0xff3f3f3fu, 0xfffffffeu,
+	0xfcfcfcffu, 0xfffffffeu, 0xf8f8f8ffu, 0xfffffffeu,
+	0xf1f1f1ffu, 0xfffffffeu, 0xe3e3e3ffu, 0xfffffffeu,
+	0xc7c7c7ffu, 0xfffffffeu, 0x8f8f8fffu, 0xfffffffeu,
+	0x1f1f1fffu, 0xfffffffeu, 0x3f3f3fffu, 0xfffffffeu,
+	0x00000000u, 0x00000300u, 0x00000000u, 0x00000300u,
+	0x00000000u, 0x00030700u, 0x02000000u, 0x07070f02u,
+	0x07000000u, 0x0f0f1f06u, 0x8f8fffffu, 0xffffff8eu,
+	0x1f1fffffu, 0xffffff1eu, 0x3f3fffffu, 0xffffff3eu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00020000u, 0x00000000u, 0x02060202u,
+	0x00000000u, 0x070f0706u, 0x8fffffffu, 0xffff8f8eu,
+	0x1fffffffu, 0xffff1f1eu, 0x3fffffffu, 0xffff3f3eu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x02020200u,
+	0x00000000u, 0x07070700u, 0xffffffffu, 0xff8f8f8eu,
+	0xffffffffu, 0xff1f1f1eu, 0xffffffffu, 0xff3f3f3eu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x02020000u,
+	0x00000000u, 0x07070700u, 0xffffffffu, 0x8f8f8ffeu,
+	0xffffffffu, 0x1f1f1ffeu, 0xffffffffu, 0x3f3f3ffeu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x02020000u,
+	0x00000000u, 0x07070700u, 0xffffffffu, 0x8f8ffffeu,
+	0xffffffffu, 0x1f1ffffeu, 0xffffffffu, 0x3f3ffffeu,
+	0xfffffcfcu, 0xfffffffdu, 0xfffff8f8u, 0xfffffffdu,
+	0xfffff1f1u, 0xfffffffdu, 0xffffe3e3u, 0xfffffffdu,
+	0xffffc7c7u, 0xfffffffdu, 0xffff8f8fu, 0xfffffffdu,
+	0xffff1f1fu, 0xfffffffdu, 0xffff3f3fu, 0xfffffffdu,
+	0xfffcfcfcu, 0xfffffffdu, 0xfff8f8f8u, 0xfffffffdu,
+	0xfff1f1f1u, 0xfffffffdu, 0xffe3e3e3u, 0xfffffffdu,
+	0xffc7c7c7u, 0xfffffffdu, 0xff8f8f8fu, 0xfffffffdu,
+	0xff1f1f1fu, 0xfffffffdu, 0xff3f3f3fu, 0xfffffffdu,
+	0xfcfcfcffu, 0xfffffffdu, 0xf8f8f8ffu, 0xfffffffdu,
+	0xf1f1f1ffu, 0xfffffffdu, 0xe3e3e3ffu, 0xfffffffdu,
+	0xc7c7c7ffu, 0xfffffffdu, 0x8f8f8fffu, 0xfffffffdu,
+	0x1f1f1fffu, 0xfffffffdu, 0x3f3f3fffu, 0xfffffffdu,
+	0xfcfcffffu, 0xfffffffcu, 0xf8f8ffffu, 0xfffffff8u,
+	0xf1f1ffffu, 0xfffffff1u, 0xe3e3ffffu, 0xffffffe1u,
+	0xc7c7ffffu, 0xffffffc5u, 0x8f8fffffu, 0xffffff8du,
+	0x1f1fffffu, 0xffffff1du, 0x3f3fffffu, 0xffffff3du,
+	0x0c000000u, 0x000f0c0cu, 0x00000000u, 0x00000000u,
+	0x01000000u, 0x00070101u, 0x03070000u, 0x0f0f0301u,
+	0x07070000u, 0x1f1f0705u, 0x8fffffffu, 0xffff8f8du,
+	0x1fffffffu, 0xffff1f1du, 0x3fffffffu, 0xffff3f3du,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x03000000u, 0x07030301u,
+	0x0f070000u, 0x0f070705u, 0xffffffffu, 0xff8f8f8du,
+	0xffffffffu, 0xff1f1f1du, 0xffffffffu, 0xff3f3f3du,
+	0x00000000u, 0x0c0c0c0cu, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x01010101u, 0x03000000u, 0x0303030du,
+	0x1f070000u, 0x0707071du, 0xffffffffu, 0x8f8f8ffdu,
+	0xffffffffu, 0x1f1f1ffdu, 0xffffffffu, 0x3f3f3ffdu,
+	0x00000000u, 0x0c0c0f0du, 0x00000000u, 0x00080f0du,
+	0x00000000u, 0x01010f0du, 0x03000000u, 0x03031f1du,
+	0x1f070000u, 0x07073f3du, 0xffffffffu, 0x8f8ffffdu,
+	0xffffffffu, 0x1f1ffffdu, 0xffffffffu, 0x3f3ffffdu,
+	0xfffffcfcu, 0xfffffffdu, 0xfffff8f8u, 0xfffffffdu,
+	0xfffff1f1u, 0xfffffffdu, 0xffffe3e3u, 0xfffffffdu,
+	0xffffc7c7u, 0xfffffffdu, 0xffff8f8fu, 0xfffffffdu,
+	0xffff1f1fu, 0xfffffffdu, 0xffff3f3fu, 0xfffffffdu,
+	0xfffcfcfcu, 0xfffffffdu, 0xfff8f8f8u, 0xfffffffdu,
+	0xfff1f1f1u, 0xfffffffdu, 0xffe3e3e3u, 0xfffffffdu,
+	0xffc7c7c7u, 0xfffffffdu, 0xff8f8f8fu, 0xfffffffdu,
+	0xff1f1f1fu, 0xfffffffdu, 0xff3f3f3fu, 0xfffffffdu,
+	0xfcfcfcffu, 0xfffffffdu, 0xf8f8f8ffu, 0xfffffffdu,
+	0xf1f1f1ffu, 0xfffffffdu, 0xe3e3e3ffu, 0xfffffffdu,
+	0xc7c7c7ffu, 0xfffffffdu, 0x8f8f8fffu, 0xfffffffdu,
+	0x1f1f1fffu, 0xfffffffdu, 0x3f3f3fffu, 0xfffffffdu,
+	0x04000000u, 0x00000704u, 0x00000000u, 0x00000700u,
+	0x01000000u, 0x00000701u, 0x03000000u, 0x00070f01u,
+	0x07070000u, 0x0f0f1f05u, 0x0f070000u, 0x1f1f3f0du,
+	0x1f1fffffu, 0xffffff1du, 0x3f3fffffu, 0xffffff3du,
+	0x00000000u, 0x00000404u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000101u, 0x03000000u, 0x00070301u,
+	0x03000000u, 0x070f0705u, 0x0f070000u, 0x0f1f0f0du,
+	0x1fffffffu, 0xffff1f1du, 0x3fffffffu, 0xffff3f3du,
+	0x00000000u, 0x00000400u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000100u, 0x00000000u, 0x00030301u,
+	0x03000000u, 0x07070705u, 0x0f070000u, 0x0f0f0f0du,
+	0xffffffffu, 0xff1f1f1du, 0xffffffffu, 0xff3f3f3du,
+	0x00000000u, 0x00040400u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00010100u, 0x00000000u, 0x03030301u,
+	0x03000000u, 0x0707070du, 0x0f070000u, 0x0f0f0f1du,
+	0xffffffffu, 0x1f1f1ffdu, 0xffffffffu, 0x3f3f3ffdu,
+	0x00000000u, 0x04040700u, 0x00000000u, 0x00000700u,
+	0x00000000u, 0x01010700u, 0x00000000u, 0x03030f01u,
+	0x03000000u, 0x07071f0du, 0x1f070000u, 0x0f0f3f1du,
+	0xffffffffu, 0x1f1ffffdu, 0xffffffffu, 0x3f3ffffdu,
+	0xfffffcfcu, 0xfffffffbu, 0xfffff8f8u, 0xfffffffbu,
+	0xfffff1f1u, 0xfffffffbu, 0xffffe3e3u, 0xfffffffbu,
+	0xffffc7c7u, 0xfffffffbu, 0xffff8f8fu, 0xfffffffbu,
+	0xffff1f1fu, 0xfffffffbu, 0xffff3f3fu, 0xfffffffbu,
+	0xfffcfcfcu, 0xfffffffbu, 0xfff8f8f8u, 0xfffffffbu,
+	0xfff1f1f1u, 0xfffffffbu, 0xffe3e3e3u, 0xfffffffbu,
+	0xffc7c7c7u, 0xfffffffbu, 0xff8f8f8fu, 0xfffffffbu,
+	0xff1f1f1fu, 0xfffffffbu, 0xff3f3f3fu, 0xfffffffbu,
+	0xfcfcfcffu, 0xfffffffbu, 0xf8f8f8ffu, 0xfffffffbu,
+	0xf1f1f1ffu, 0xfffffffbu, 0xe3e3e3ffu, 0xfffffffbu,
+	0xc7c7c7ffu, 0xfffffffbu, 0x8f8f8fffu, 0xfffffffbu,
+	0x1f1f1fffu, 0xfffffffbu, 0x3f3f3fffu, 0xfffffffbu,
+	0xfcfcffffu, 0xfffffff8u, 0xf8f8ffffu, 0xfffffff8u,
+	0xf1f1ffffu, 0xfffffff1u, 0xe3e3ffffu, 0xffffffe3u,
+	0xc7c7ffffu, 0xffffffc3u, 0x8f8fffffu, 0xffffff8bu,
+	0x1f1fffffu, 0xffffff1bu, 0x3f3fffffu, 0xffffff3bu,
+	0x3c3e0000u, 0x3f3f3c38u, 0x18000000u, 0x001e1818u,
+	0x00000000u, 0x00000000u, 0x03000000u, 0x000f0303u,
+	0x070f0000u, 0x1f1f0703u, 0x0f0f0000u, 0x3f3f0f0bu,
+	0x1fffffffu, 0xffff1f1bu, 0x3fffffffu, 0xffff3f3bu,
+	0x3c000000u, 0x3e3c3c38u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x07000000u, 0x0f070703u, 0x1f0f0000u, 0x1f0f0f0bu,
+	0xffffffffu, 0xff1f1f1bu, 0xffffffffu, 0xff3f3f3bu,
+	0x3c000000u, 0x3c3c3c3bu, 0x00000000u, 0x18181818u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x03030303u,
+	0x07000000u, 0x0707071bu, 0x3f0f0000u, 0x0f0f0f3bu,
+	0xffffffffu, 0x1f1f1ffbu, 0xffffffffu, 0x3f3f3ffbu,
+	0x3c000000u, 0x3c3c3f3bu, 0x00000000u, 0x18181f1bu,
+	0x00000000u, 0x00111f1bu, 0x00000000u, 0x03031f1bu,
+	0x07000000u, 0x07073f3bu, 0x3f0f0000u, 0x0f0f7f7bu,
+	0xffffffffu, 0x1f1ffffbu, 0xffffffffu, 0x3f3ffffbu,
+	0xfffffcfcu, 0xfffffffbu, 0xfffff8f8u, 0xfffffffbu,
+	0xfffff1f1u, 0xfffffffbu, 0xffffe3e3u, 0xfffffffbu,
+	0xffffc7c7u, 0xfffffffbu, 0xffff8f8fu, 0xfffffffbu,
+	0xffff1f1fu, 0xfffffffbu, 0xffff3f3fu, 0xfffffffbu,
+	0xfffcfcfcu, 0xfffffffbu, 0xfff8f8f8u, 0xfffffffbu,
+	0xfff1f1f1u, 0xfffffffbu, 0xffe3e3e3u, 0xfffffffbu,
+	0xffc7c7c7u, 0xfffffffbu, 0xff8f8f8fu, 0xfffffffbu,
+	0xff1f1f1fu, 0xfffffffbu, 0xff3f3f3fu, 0xfffffffbu,
+	0xfcfcfcffu, 0xfffffffbu, 0xf8f8f8ffu, 0xfffffffbu,
+	0xf1f1f1ffu, 0xfffffffbu, 0xe3e3e3ffu, 0xfffffffbu,
+	0xc7c7c7ffu, 0xfffffffbu, 0x8f8f8fffu, 0xfffffffbu,
+	0x1f1f1fffu, 0xfffffffbu, 0x3f3f3fffu, 0xfffffffbu,
+	0x1c000000u, 0x001e1f18u, 0x08000000u, 0x00000e08u,
+	0x00000000u, 0x00000e00u, 0x02000000u, 0x00000e02u,
+	0x07000000u, 0x000f1f03u, 0x0f0f0000u, 0x1f1f3f0bu,
+	0x1f0f0000u, 0x3f3f7f1bu, 0x3f3fffffu, 0xffffff3bu,
+	0x1c000000u, 0x001e1c18u, 0x00000000u, 0x00000808u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000202u,
+	0x07000000u, 0x000f0703u, 0x07000000u, 0x0f1f0f0bu,
+	0x1f0f0000u, 0x1f3f1f1bu, 0x3fffffffu, 0xffff3f3bu,
+	0x00000000u, 0x001c1c18u, 0x00000000u, 0x00000800u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000200u,
+	0x00000000u, 0x00070703u, 0x07000000u, 0x0f0f0f0bu,
+	0x1f0f0000u, 0x1f1f1f1bu, 0xffffffffu, 0xff3f3f3bu,
+	0x00000000u, 0x1c1c1c18u, 0x00000000u, 0x00080800u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00020200u,
+	0x00000000u, 0x07070703u, 0x07000000u, 0x0f0f0f1bu,
+	0x1f0f0000u, 0x1f1f1f3bu, 0xffffffffu, 0x3f3f3ffbu,
+	0x00000000u, 0x1c1c1f18u, 0x00000000u, 0x08080e00u,
+	0x00000000u, 0x00000e00u, 0x00000000u, 0x02020e00u,
+	0x00000000u, 0x07071f03u, 0x07000000u, 0x0f0f3f1bu,
+	0x3f0f0000u, 0x1f1f7f3bu, 0xffffffffu, 0x3f3ffffbu,
+	0xfffffcfcu, 0xfffffff7u, 0xfffff8f8u, 0xfffffff7u,
+	0xfffff1f1u, 0xfffffff7u, 0xffffe3e3u, 0xfffffff7u,
+	0xffffc7c7u, 0xfffffff7u, 0xffff8f8fu, 0xfffffff7u,
+	0xffff1f1fu, 0xfffffff7u, 0xffff3f3fu, 0xfffffff7u,
+	0xfffcfcfcu, 0xfffffff7u, 0xfff8f8f8u, 0xfffffff7u,
+	0xfff1f1f1u, 0xfffffff7u, 0xffe3e3e3u, 0xfffffff7u,
+	0xffc7c7c7u, 0xfffffff7u, 0xff8f8f8fu, 0xfffffff7u,
+	0xff1f1f1fu, 0xfffffff7u, 0xff3f3f3fu, 0xfffffff7u,
+	0xfcfcfcffu, 0xfffffff7u, 0xf8f8f8ffu, 0xfffffff7u,
+	0xf1f1f1ffu, 0xfffffff7u, 0xe3e3e3ffu, 0xfffffff7u,
+	0xc7c7c7ffu, 0xfffffff7u, 0x8f8f8fffu, 0xfffffff7u,
+	0x1f1f1fffu, 0xfffffff7u, 0x3f3f3fffu, 0xfffffff7u,
+	0xfcfcffffu, 0xfffffff4u, 0xf8f8ffffu, 0xfffffff0u,
+	0xf1f1ffffu, 0xfffffff1u, 0xe3e3ffffu, 0xffffffe3u,
+	0xc7c7ffffu, 0xffffffc7u, 0x8f8fffffu, 0xffffff87u,
+	0x1f1fffffu, 0xffffff17u, 0x3f3fffffu, 0xffffff37u,
+	0xfcfc0000u, 0xfffffcf4u, 0x787c0000u, 0x7e7e7870u,
+	0x30000000u, 0x003c3030u, 0x00000000u, 0x00000000u,
+	0x06000000u, 0x001e0606u, 0x0f1f0000u, 0x3f3f0f07u,
+	0x1f1f0000u, 0x7f7f1f17u, 0x3fffffffu, 0xffff3f37u,
+	0xfefc0000u, 0xfefcfcf4u, 0x78000000u, 0x7c787870u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x0f000000u, 0x1f0f0f07u,
+	0x3f1f0000u, 0x3f1f1f17u, 0xffffffffu, 0xff3f3f37u,
+	0xfffc0000u, 0xfcfcfcf7u, 0x78000000u, 0x78787876u,
+	0x00000000u, 0x30303030u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x06060606u, 0x0f000000u, 0x0f0f0f37u,
+	0x7f1f0000u, 0x1f1f1f77u, 0xffffffffu, 0x3f3f3ff7u,
+	0xfffc0000u, 0xfcfcfff7u, 0x78000000u, 0x78787f77u,
+	0x00000000u, 0x30303e36u, 0x00000000u, 0x00223e36u,
+	0x00000000u, 0x06063e36u, 0x0f000000u, 0x0f0f7f77u,
+	0x7f1f0000u, 0x1f1ffff7u, 0xffffffffu, 0x3f3ffff7u,
+	0xfffffcfcu, 0xfffffff7u, 0xfffff8f8u, 0xfffffff7u,
+	0xfffff1f1u, 0xfffffff7u, 0xffffe3e3u, 0xfffffff7u,
+	0xffffc7c7u, 0xfffffff7u, 0xffff8f8fu, 0xfffffff7u,
+	0xffff1f1fu, 0xfffffff7u, 0xffff3f3fu, 0xfffffff7u,
+	0xfffcfcfcu, 0xfffffff7u, 0xfff8f8f8u, 0xfffffff7u,
+	0xfff1f1f1u, 0xfffffff7u, 0xffe3e3e3u, 0xfffffff7u,
+	0xffc7c7c7u, 0xfffffff7u, 0xff8f8f8fu, 0xfffffff7u,
+	0xff1f1f1fu, 0xfffffff7u, 0xff3f3f3fu, 0xfffffff7u,
+	0xfcfcfcffu, 0xfffffff7u, 0xf8f8f8ffu, 0xfffffff7u,
+	0xf1f1f1ffu, 0xfffffff7u, 0xe3e3e3ffu, 0xfffffff7u,
+	0xc7c7c7ffu, 0xfffffff7u, 0x8f8f8fffu, 0xfffffff7u,
+	0x1f1f1fffu, 0xfffffff7u, 0x3f3f3fffu, 0xfffffff7u,
+	0x7c7c0000u, 0x7e7e7f74u, 0x38000000u, 0x003c3e30u,
+	0x10000000u, 0x00001c10u, 0x00000000u, 0x00001c00u,
+	0x04000000u, 0x00001c04u, 0x0e000000u, 0x001e3e06u,
+	0x1f1f0000u, 0x3f3f7f17u, 0x3f1f0000u, 0x7f7fff37u,
+	0x78000000u, 0x7c7e7c74u, 0x38000000u, 0x003c3830u,
+	0x00000000u, 0x00001010u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000404u, 0x0e000000u, 0x001e0e06u,
+	0x0f000000u, 0x1f3f1f17u, 0x3f1f0000u, 0x3f7f3f37u,
+	0x78000000u, 0x7c7c7c74u, 0x00000000u, 0x00383830u,
+	0x00000000u, 0x00001000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000400u, 0x00000000u, 0x000e0e06u,
+	0x0f000000u, 0x1f1f1f17u, 0x3f1f0000u, 0x3f3f3f37u,
+	0x78000000u, 0x7c7c7c76u, 0x00000000u, 0x38383830u,
+	0x00000000u, 0x00101000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00040400u, 0x00000000u, 0x0e0e0e06u,
+	0x0f000000u, 0x1f1f1f37u, 0x3f1f0000u, 0x3f3f3f77u,
+	0x78000000u, 0x7c7c7f76u, 0x00000000u, 0x38383e30u,
+	0x00000000u, 0x10101c00u, 0x00000000u, 0x00001c00u,
+	0x00000000u, 0x04041c00u, 0x00000000u, 0x0e0e3e06u,
+	0x0f000000u, 0x1f1f7f37u, 0x7f1f0000u, 0x3f3fff77u,
+	0xfefffcfcu, 0xffffffffu, 0xfefff8f8u, 0xffffffffu,
+	0xfefff1f1u, 0xffffffffu, 0xfeffe3e3u, 0xffffffffu,
+	0xfeffc7c7u, 0xffffffffu, 0xfeff8f8fu, 0xffffffffu,
+	0xfeff1f1fu, 0xffffffffu, 0xfeff3f3fu, 0xffffffffu,
+	0xfefcfcfcu, 0xffffffffu, 0xfef8f8f8u, 0xffffffffu,
+	0xfef1f1f1u, 0xffffffffu, 0xfee3e3e3u, 0xffffffffu,
+	0xfec7c7c7u, 0xffffffffu, 0xfe8f8f8fu, 0xffffffffu,
+	0xfe1f1f1fu, 0xffffffffu, 0xfe3f3f3fu, 0xffffffffu,
+	0xfcfcfcffu, 0xffffffffu, 0xf8f8f8ffu, 0xffffffffu,
+	0xf0f1f1ffu, 0xffffffffu, 0xe2e3e3ffu, 0xffffffffu,
+	0xc6c7c7ffu, 0xffffffffu, 0x8e8f8fffu, 0xffffffffu,
+	0x1e1f1fffu, 0xffffffffu, 0x3e3f3fffu, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000300u,
+	0x00000000u, 0x00070701u, 0x02030000u, 0x070f0f03u,
+	0x06070000u, 0x0f1f1f07u, 0x8e8fffffu, 0xffffff8fu,
+	0x1e1fffffu, 0xffffff1fu, 0x3e3fffffu, 0xffffff3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00020000u, 0x02000000u, 0x07070303u,
+	0x06000000u, 0x0f0f0707u, 0x8effffffu, 0xffff8f8fu,
+	0x1effffffu, 0xffff1f1fu, 0x3effffffu, 0xffff3f3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x07030303u,
+	0x00000000u, 0x0f070707u, 0xfeffffffu, 0xff8f8f8fu,
+	0xfeffffffu, 0xff1f1f1fu, 0xfeffffffu, 0xff3f3f3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x03030300u,
+	0x00000000u, 0x0707070fu, 0xfeffffffu, 0x8f8f8fffu,
+	0xfeffffffu, 0x1f1f1fffu, 0xfeffffffu, 0x3f3f3fffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x03030700u,
+	0x00000000u, 0x07070f0fu, 0xfeffffffu, 0x8f8fffffu,
+	0xfeffffffu, 0x1f1fffffu, 0xfeffffffu, 0x3f3fffffu,
+	0xfefffcfcu, 0xffffffffu, 0xfefff8f8u, 0xffffffffu,
+	0xfefff1f1u, 0xffffffffu, 0xfeffe3e3u, 0xffffffffu,
+	0xfeffc7c7u, 0xffffffffu, 0xfeff8f8fu, 0xffffffffu,
+	0xfeff1f1fu, 0xffffffffu, 0xfeff3f3fu, 0xffffffffu,
+	0xfefcfcfcu, 0xffffffffu, 0xfef8f8f8u, 0xffffffffu,
+	0xfef1f1f1u, 0xffffffffu, 0xfee3e3e3u, 0xffffffffu,
+	0xfec7c7c7u, 0xffffffffu, 0xfe8f8f8fu, 0xffffffffu,
+	0xfe1f1f1fu, 0xffffffffu, 0xfe3f3f3fu, 0xffffffffu,
+	0x00000000u, 0x00000003u, 0x00000000u, 0x00000003u,
+	0x00000000u, 0x00000307u, 0x02020000u, 0x0007070fu,
+	0x06070000u, 0x070f0f1fu, 0x0e0f0000u, 0x0f1f1f3fu,
+	0x1e1f1fffu, 0xffffffffu, 0x3e3f3fffu, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000200u, 0x02000000u, 0x00020602u,
+	0x06000000u, 0x07070f07u, 0x0e000000u, 0x0f0f1f0fu,
+	0x1e1fffffu, 0xffffff1fu, 0x3e3fffffu, 0xffffff3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00020202u,
+	0x00000000u, 0x07070707u, 0x00000000u, 0x0f0f0f0fu,
+	0x1effffffu, 0xffff1f1fu, 0x3effffffu, 0xffff3f3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00020200u,
+	0x00000000u, 0x07070700u, 0x00000000u, 0x0f0f0f0fu,
+	0xfeffffffu, 0xff1f1f1fu, 0xfeffffffu, 0xff3f3f3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00020000u,
+	0x00000000u, 0x07070700u, 0x00000000u, 0x0f0f0f0fu,
+	0xfeffffffu, 0x1f1f1fffu, 0xfeffffffu, 0x3f3f3fffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x02020000u,
+	0x00000000u, 0x07070700u, 0x00000000u, 0x0f0f0f0fu,
+	0xfeffffffu, 0x1f1fffffu, 0xfeffffffu, 0x3f3fffffu,
+	0xfdfffcfcu, 0xffffffffu, 0xfdfff8f8u, 0xffffffffu,
+	0xfdfff1f1u, 0xffffffffu, 0xfdffe3e3u, 0xffffffffu,
+	0xfdffc7c7u, 0xffffffffu, 0xfdff8f8fu, 0xffffffffu,
+	0xfdff1f1fu, 0xffffffffu, 0xfdff3f3fu, 0xffffffffu,
+	0xfdfcfcfcu, 0xffffffffu, 0xfdf8f8f8u, 0xffffffffu,
+	0xfdf1f1f1u, 0xffffffffu, 0xfde3e3e3u, 0xffffffffu,
+	0xfdc7c7c7u, 0xffffffffu, 0xfd8f8f8fu, 0xffffffffu,
+	0xfd1f1f1fu, 0xffffffffu, 0xfd3f3f3fu, 0xffffffffu,
+	0xfcfcfcffu, 0xffffffffu, 0xf8f8f8ffu, 0xffffffffu,
+	0xf1f1f1ffu, 0xffffffffu, 0xe1e3e3ffu, 0xffffffffu,
+	0xc5c7c7ffu, 0xffffffffu, 0x8d8f8fffu, 0xffffffffu,
+	0x1d1f1fffu, 0xffffffffu, 0x3d3f3fffu, 0xffffffffu,
+	0x0c0c0000u, 0x00000f0cu, 0x00000000u, 0x00000000u,
+	0x01010000u, 0x00000701u, 0x01030700u, 0x000f0f03u,
+	0x05070700u, 0x0f1f1f07u, 0x0d0f1f0fu, 0x1f3f3f0fu,
+	0x1d1fffffu, 0xffffff1fu, 0x3d3fffffu, 0xffffff3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x01030000u, 0x00070303u,
+	0x050f0700u, 0x0f0f0707u, 0x0d1f1f0fu, 0x1f1f0f0fu,
+	0x1dffffffu, 0xffff1f1fu, 0x3dffffffu, 0xffff3f3fu,
+	0x0c000000u, 0x000c0c0cu, 0x00000000u, 0x00000000u,
+	0x01000000u, 0x00010101u, 0x05030000u, 0x07030303u,
+	0x0d0f0700u, 0x0f070707u, 0x1d1f1f0fu, 0x1f0f0f0fu,
+	0xfdffffffu, 0xff1f1f1fu, 0xfdffffffu, 0xff3f3f3fu,
+	0x0d000000u, 0x0c0c0c0eu, 0x05000000u, 0x00000005u,
+	0x0d000000u, 0x0101010bu, 0x1d030000u, 0x03030317u,
+	0x3d0f0700u, 0x0707072fu, 0x7d1f1f0fu, 0x0f0f0f5fu,
+	0xfdffffffu, 0x1f1f1fffu, 0xfdffffffu, 0x3f3f3fffu,
+	0x0c000000u, 0x0c0c0f0fu, 0x00000000u, 0x00080f0fu,
+	0x01000000u, 0x01010f0fu, 0x05030000u, 0x03031f1fu,
+	0x0d0f0700u, 0x07073f3fu, 0x1d1f1f0fu, 0x0f0f7f7fu,
+	0xfdffffffu, 0x1f1fffffu, 0xfdffffffu, 0x3f3fffffu,
+	0xfdfffcfcu, 0xffffffffu, 0xfdfff8f8u, 0xffffffffu,
+	0xfdfff1f1u, 0xffffffffu, 0xfdffe3e3u, 0xffffffffu,
+	0xfdffc7c7u, 0xffffffffu, 0xfdff8f8fu, 0xffffffffu,
+	0xfdff1f1fu, 0xffffffffu, 0xfdff3f3fu, 0xffffffffu,
+	0xfdfcfcfcu, 0xffffffffu, 0xfdf8f8f8u, 0xffffffffu,
+	0xfdf1f1f1u, 0xffffffffu, 0xfde3e3e3u, 0xffffffffu,
+	0xfdc7c7c7u, 0xffffffffu, 0xfd8f8f8fu, 0xffffffffu,
+	0xfd1f1f1fu, 0xffffffffu, 0xfd3f3f3fu, 0xffffffffu,
+	0x04040000u, 0x00000007u, 0x00000000u, 0x00000007u,
+	0x01010000u, 0x00000007u, 0x01030000u, 0x0000070fu,
+	0x05070700u, 0x000f0f1fu, 0x0d0f0700u, 0x0f1f1f3fu,
+	0x1d1f1f0fu, 0x1f3f3f7fu, 0x3d3f3fffu, 0xffffffffu,
+	0x04000000u, 0x00000004u, 0x00000000u, 0x00000000u,
+	0x01000000u, 0x00000001u, 0x01030000u, 0x00000703u,
+	0x05030000u, 0x00070f07u, 0x0d0f0700u, 0x0f0f1f0fu,
+	0x1d1f1f0fu, 0x1f1f3f1fu, 0x3d3fffffu, 0xffffff3fu,
+	0x00000000u, 0x00000004u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000001u, 0x01000000u, 0x00000303u,
+	0x05030000u, 0x00070707u, 0x0d0f0700u, 0x0f0f0f0fu,
+	0x1d1f1f0fu, 0x1f1f1f1fu, 0x3dffffffu, 0xffff3f3fu,
+	0x00000000u, 0x00000404u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000101u, 0x01000000u, 0x00030303u,
+	0x05030000u, 0x00070707u, 0x0d0f0700u, 0x0f0f0f0fu,
+	0x1d1f1f0fu, 0x1f1f1f1fu, 0xfdffffffu, 0xff3f3f3fu,
+	0x00000000u, 0x00040405u, 0x00000000u, 0x00000002u,
+	0x00000000u, 0x00010105u, 0x01000000u, 0x0003030bu,
+	0x05030000u, 0x07070717u, 0x0d0f0700u, 0x0f0f0f2fu,
+	0x1d1f1f0fu, 0x1f1f1f5fu, 0xfdffffffu, 0x3f3f3fffu,
+	0x00000000u, 0x04040704u, 0x00000000u, 0x00000700u,
+	0x00000000u, 0x01010701u, 0x01000000u, 0x03030f03u,
+	0x05030000u, 0x07071f07u, 0x0d0f0700u, 0x0f0f3f0fu,
+	0x1d1f1f0fu, 0x1f1f7f5fu, 0xfdffffffu, 0x3f3fffffu,
+	0xfbfffcfcu, 0xffffffffu, 0xfbfff8f8u, 0xffffffffu,
+	0xfbfff1f1u, 0xffffffffu, 0xfbffe3e3u, 0xffffffffu,
+	0xfbffc7c7u, 0xffffffffu, 0xfbff8f8fu, 0xffffffffu,
+	0xfbff1f1fu, 0xffffffffu, 0xfbff3f3fu, 0xffffffffu,
+	0xfbfcfcfcu, 0xffffffffu, 0xfbf8f8f8u, 0xffffffffu,
+	0xfbf1f1f1u, 0xffffffffu, 0xfbe3e3e3u, 0xffffffffu,
+	0xfbc7c7c7u, 0xffffffffu, 0xfb8f8f8fu, 0xffffffffu,
+	0xfb1f1f1fu, 0xffffffffu, 0xfb3f3f3fu, 0xffffffffu,
+	0xf8fcfcffu, 0xffffffffu, 0xf8f8f8ffu, 0xffffffffu,
+	0xf1f1f1ffu, 0xffffffffu, 0xe3e3e3ffu, 0xffffffffu,
+	0xc3c7c7ffu, 0xffffffffu, 0x8b8f8fffu, 0xffffffffu,
+	0x1b1f1fffu, 0xffffffffu, 0x3b3f3fffu, 0xffffffffu,
+	0x383c3e00u, 0x003f3f3cu, 0x18180000u, 0x00001e18u,
+	0x00000000u, 0x00000000u, 0x03030000u, 0x00000f03u,
+	0x03070f00u, 0x001f1f07u, 0x0b0f0f00u, 0x1f3f3f0fu,
+	0x1b1f3f1fu, 0x3f7f7f1fu, 0x3b3fffffu, 0xffffff3fu,
+	0x383c0000u, 0x003e3c3cu, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x03070000u, 0x000f0707u, 0x0b1f0f00u, 0x1f1f0f0fu,
+	0x1b3f3f1fu, 0x3f3f1f1fu, 0x3bffffffu, 0xffff3f3fu,
+	0x3a3c0000u, 0x3e3c3c3cu, 0x18000000u, 0x00181818u,
+	0x00000000u, 0x00000000u, 0x03000000u, 0x00030303u,
+	0x0b070000u, 0x0f070707u, 0x1b1f0f00u, 0x1f0f0f0fu,
+	0x3b3f3f1fu, 0x3f1f1f1fu, 0xfbffffffu, 0xff3f3f3fu,
+	0x3b3c0000u, 0x3c3c3c3eu, 0x1b000000u, 0x1818181du,
+	0x0a000000u, 0x0000000au, 0x1b000000u, 0x03030317u,
+	0x3b070000u, 0x0707072fu, 0x7b1f0f00u, 0x0f0f0f5fu,
+	0xfb3f3f1fu, 0x1f1f1fbfu, 0xfbffffffu, 0x3f3f3fffu,
+	0x3a3c0000u, 0x3c3c3f3fu, 0x18000000u, 0x18181f1fu,
+	0x00000000u, 0x00111f1fu, 0x03000000u, 0x03031f1fu,
+	0x0b070000u, 0x07073f3fu, 0x1b1f0f00u, 0x0f0f7f7fu,
+	0x3b3f3f1fu, 0x1f1fffffu, 0xfbffffffu, 0x3f3fffffu,
+	0xfbfffcfcu, 0xffffffffu, 0xfbfff8f8u, 0xffffffffu,
+	0xfbfff1f1u, 0xffffffffu, 0xfbffe3e3u, 0xffffffffu,
+	0xfbffc7c7u, 0xffffffffu, 0xfbff8f8fu, 0xffffffffu,
+	0xfbff1f1fu, 0xffffffffu, 0xfbff3f3fu, 0xffffffffu,
+	0xfbfcfcfcu, 0xffffffffu, 0xfbf8f8f8u, 0xffffffffu,
+	0xfbf1f1f1u, 0xffffffffu, 0xfbe3e3e3u, 0xffffffffu,
+	0xfbc7c7c7u, 0xffffffffu, 0xfb8f8f8fu, 0xffffffffu,
+	0xfb1f1f1fu, 0xffffffffu, 0xfb3f3f3fu, 0xffffffffu,
+	0x181c0000u, 0x00001e1fu, 0x08080000u, 0x0000000eu,
+	0x00000000u, 0x0000000eu, 0x02020000u, 0x0000000eu,
+	0x03070000u, 0x00000f1fu, 0x0b0f0f00u, 0x001f1f3fu,
+	0x1b1f0f00u, 0x1f3f3f7fu, 0x3b3f3f1fu, 0x3f7f7fffu,
+	0x181c0000u, 0x00001e1cu, 0x08000000u, 0x00000008u,
+	0x00000000u, 0x00000000u, 0x02000000u, 0x00000002u,
+	0x03070000u, 0x00000f07u, 0x0b070000u, 0x000f1f0fu,
+	0x1b1f0f00u, 0x1f1f3f1fu, 0x3b3f3f1fu, 0x3f3f7f3fu,
+	0x18000000u, 0x00001c1cu, 0x00000000u, 0x00000008u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000002u,
+	0x03000000u, 0x00000707u, 0x0b070000u, 0x000f0f0fu,
+	0x1b1f0f00u, 0x1f1f1f1fu, 0x3b3f3f1fu, 0x3f3f3f3fu,
+	0x18000000u, 0x001c1c1cu, 0x00000000u, 0x00000808u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000202u,
+	0x03000000u, 0x00070707u, 0x0b070000u, 0x000f0f0fu,
+	0x1b1f0f00u, 0x1f1f1f1fu, 0x3b3f3f1fu, 0x3f3f3f3fu,
+	0x18000000u, 0x001c1c1du, 0x00000000u, 0x0008080au,
+	0x00000000u, 0x00000004u, 0x00000000u, 0x0002020au,
+	0x03000000u, 0x00070717u, 0x0b070000u, 0x0f0f0f2fu,
+	0x1b1f0f00u, 0x1f1f1f5fu, 0x3b3f3f1fu, 0x3f3f3fbfu,
+	0x18000000u, 0x1c1c1f1cu, 0x00000000u, 0x08080e08u,
+	0x00000000u, 0x00000e00u, 0x00000000u, 0x02020e02u,
+	0x03000000u, 0x07071f07u, 0x0b070000u, 0x0f0f3f0fu,
+	0x1b1f0f00u, 0x1f1f7f1fu, 0x3b3f3f1fu, 0x3f3fffbfu,
+	0xf7fffcfcu, 0xffffffffu, 0xf7fff8f8u, 0xffffffffu,
+	0xf7fff1f1u, 0xffffffffu, 0xf7ffe3e3u, 0xffffffffu,
+	0xf7ffc7c7u, 0xffffffffu, 0xf7ff8f8fu, 0xffffffffu,
+	0xf7ff1f1fu, 0xffffffffu, 0xf7ff3f3fu, 0xffffffffu,
+	0xf7fcfcfcu, 0xffffffffu, 0xf7f8f8f8u, 0xffffffffu,
+	0xf7f1f1f1u, 0xffffffffu, 0xf7e3e3e3u, 0xffffffffu,
+	0xf7c7c7c7u, 0xffffffffu, 0xf78f8f8fu, 0xffffffffu,
+	0xf71f1f1fu, 0xffffffffu, 0xf73f3f3fu, 0xffffffffu,
+	0xf4fcfcffu, 0xffffffffu, 0xf0f8f8ffu, 0xffffffffu,
+	0xf1f1f1ffu, 0xffffffffu, 0xe3e3e3ffu, 0xffffffffu,
+	0xc7c7c7ffu, 0xffffffffu, 0x878f8fffu, 0xffffffffu,
+	0x171f1fffu, 0xffffffffu, 0x373f3fffu, 0xffffffffu,
+	0xf4fcfc00u, 0xfefffffcu, 0x70787c00u, 0x007e7e78u,
+	0x30300000u, 0x00003c30u, 0x00000000u, 0x00000000u,
+	0x06060000u, 0x00001e06u, 0x070f1f00u, 0x003f3f0fu,
+	0x171f1f00u, 0x3f7f7f1fu, 0x373f7f3fu, 0x7fffff3fu,
+	0xf4fefc00u, 0xfefefcfcu, 0x70780000u, 0x007c7878u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x070f0000u, 0x001f0f0fu,
+	0x173f1f00u, 0x3f3f1f1fu, 0x377f7f3fu, 0x7f7f3f3fu,
+	0xf6fefc00u, 0xfefcfcfcu, 0x74780000u, 0x7c787878u,
+	0x30000000u, 0x00303030u, 0x00000000u, 0x00000000u,
+	0x06000000u, 0x00060606u, 0x170f0000u, 0x1f0f0f0fu,
+	0x373f1f00u, 0x3f1f1f1fu, 0x777f7f3fu, 0x7f3f3f3fu,
+	0xf7fefc00u, 0xfcfcfcfeu, 0x77780000u, 0x7878787du,
+	0x36000000u, 0x3030303au, 0x14000000u, 0x00000014u,
+	0x36000000u, 0x0606062eu, 0x770f0000u, 0x0f0f0f5fu,
+	0xf73f1f00u, 0x1f1f1fbfu, 0xf77f7f3fu, 0x3f3f3f7fu,
+	0xf6fefc00u, 0xfcfcffffu, 0x74780000u, 0x78787f7fu,
+	0x30000000u, 0x30303e3eu, 0x00000000u, 0x00223e3eu,
+	0x06000000u, 0x06063e3eu, 0x170f0000u, 0x0f0f7f7fu,
+	0x373f1f00u, 0x1f1fffffu, 0x777f7f3fu, 0x3f3fffffu,
+	0xf7fffcfcu, 0xffffffffu, 0xf7fff8f8u, 0xffffffffu,
+	0xf7fff1f1u, 0xffffffffu, 0xf7ffe3e3u, 0xffffffffu,
+	0xf7ffc7c7u, 0xffffffffu, 0xf7ff8f8fu, 0xffffffffu,
+	0xf7ff1f1fu, 0xffffffffu, 0xf7ff3f3fu, 0xffffffffu,
+	0xf7fcfcfcu, 0xffffffffu, 0xf7f8f8f8u, 0xffffffffu,
+	0xf7f1f1f1u, 0xffffffffu, 0xf7e3e3e3u, 0xffffffffu,
+	0xf7c7c7c7u, 0xffffffffu, 0xf78f8f8fu, 0xffffffffu,
+	0xf71f1f1fu, 0xffffffffu, 0xf73f3f3fu, 0xffffffffu,
+	0x747c7c00u, 0x007e7e7fu, 0x30380000u, 0x00003c3eu,
+	0x10100000u, 0x0000001cu, 0x00000000u, 0x0000001cu,
+	0x04040000u, 0x0000001cu, 0x060e0000u, 0x00001e3eu,
+	0x171f1f00u, 0x003f3f7fu, 0x373f1f00u, 0x3f7f7fffu,
+	0x74780000u, 0x007c7e7cu, 0x30380000u, 0x00003c38u,
+	0x10000000u, 0x00000010u, 0x00000000u, 0x00000000u,
+	0x04000000u, 0x00000004u, 0x060e0000u, 0x00001e0eu,
+	0x170f0000u, 0x001f3f1fu, 0x373f1f00u, 0x3f3f7f3fu,
+	0x74780000u, 0x007c7c7cu, 0x30000000u, 0x00003838u,
+	0x00000000u, 0x00000010u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000004u, 0x06000000u, 0x00000e0eu,
+	0x170f0000u, 0x001f1f1fu, 0x373f1f00u, 0x3f3f3f3fu,
+	0x74780000u, 0x007c7c7cu, 0x30000000u, 0x00383838u,
+	0x00000000u, 0x00001010u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000404u, 0x06000000u, 0x000e0e0eu,
+	0x170f0000u, 0x001f1f1fu, 0x373f1f00u, 0x3f3f3f3fu,
+	0x74780000u, 0x7c7c7c7du, 0x30000000u, 0x0038383au,
+	0x00000000u, 0x00101014u, 0x00000000u, 0x00000008u,
+	0x00000000u, 0x00040414u, 0x06000000u, 0x000e0e2eu,
+	0x170f0000u, 0x1f1f1f5fu, 0x373f1f00u, 0x3f3f3fbfu,
+	0x74780000u, 0x7c7c7f7cu, 0x30000000u, 0x38383e38u,
+	0x00000000u, 0x10101c10u, 0x00000000u, 0x00001c00u,
+	0x00000000u, 0x04041c04u, 0x06000000u, 0x0e0e3e0eu,
+	0x170f0000u, 0x1f1f7f1fu, 0x373f1f00u, 0x3f3fff3fu,
+	0xfffefcfcu, 0xffffffffu, 0xfffef8f8u, 0xffffffffu,
+	0xfffef1f1u, 0xffffffffu, 0xfffee3e3u, 0xffffffffu,
+	0xfffec7c7u, 0xffffffffu, 0xfffe8f8fu, 0xffffffffu,
+	0xfffe1f1fu, 0xffffffffu, 0xfffe3f3fu, 0xffffffffu,
+	0xfffcfcfcu, 0xffffffffu, 0xfff8f8f8u, 0xffffffffu,
+	0xfff0f1f1u, 0xffffffffu, 0xffe2e3e3u, 0xffffffffu,
+	0xffc6c7c7u, 0xffffffffu, 0xff8e8f8fu, 0xffffffffu,
+	0xff1e1f1fu, 0xffffffffu, 0xff3e3f3fu, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000003u,
+	0x01000000u, 0x00000707u, 0x03020300u, 0x00070f0fu,
+	0x07060700u, 0x0f0f1f1fu, 0x0f0e0f00u, 0x1f1f3f3fu,
+	0x1f1e1fffu, 0xffffffffu, 0x3f3e3fffu, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000200u, 0x03020000u, 0x00070703u,
+	0x07060000u, 0x0f0f0f07u, 0x0f0e0000u, 0x1f1f1f0fu,
+	0x1f1effffu, 0xffffff1fu, 0x3f3effffu, 0xffffff3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x03000000u, 0x00070303u,
+	0x07000000u, 0x0f0f0707u, 0x0f000000u, 0x1f1f0f0fu,
+	0x1ffeffffu, 0xffff1f1fu, 0x3ffeffffu, 0xffff3f3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00030303u,
+	0x00000000u, 0x0f070707u, 0x1f000000u, 0x1f0f0f0fu,
+	0xfffeffffu, 0xff1f1f1fu, 0xfffeffffu, 0xff3f3f3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x03030300u,
+	0x00000000u, 0x0707070fu, 0x1f000000u, 0x0f0f0f1fu,
+	0xfffeffffu, 0x1f1f1fffu, 0xfffeffffu, 0x3f3f3fffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x03030700u,
+	0x00000000u, 0x07070f0fu, 0x1f000000u, 0x0f0f1f1fu,
+	0xfffeffffu, 0x1f1fffffu, 0xfffeffffu, 0x3f3fffffu,
+	0xfffefcfcu, 0xffffffffu, 0xfffef8f8u, 0xffffffffu,
+	0xfffef1f1u, 0xffffffffu, 0xfffee3e3u, 0xffffffffu,
+	0xfffec7c7u, 0xffffffffu, 0xfffe8f8fu, 0xffffffffu,
+	0xfffe1f1fu, 0xffffffffu, 0xfffe3f3fu, 0xffffffffu,
+	0x03000000u, 0x00000000u, 0x03000000u, 0x00000000u,
+	0x07000000u, 0x00000003u, 0x0f020200u, 0x00000707u,
+	0x1f060700u, 0x00070f0fu, 0x3f0e0f00u, 0x0f0f1f1fu,
+	0x7f1e1f00u, 0x1f1f3f3fu, 0xff3e3f3fu, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000002u, 0x02020000u, 0x00000206u,
+	0x07060000u, 0x0007070fu, 0x0f0e0000u, 0x0f0f0f1fu,
+	0x1f1e0000u, 0x1f1f1f3fu, 0x3f3e3fffu, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x02000000u, 0x00000202u,
+	0x07000000u, 0x00070707u, 0x0f000000u, 0x0f0f0f0fu,
+	0x1f000000u, 0x1f1f1f1fu, 0x3f3effffu, 0xffffff3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000202u,
+	0x00000000u, 0x00070707u, 0x00000000u, 0x0f0f0f0fu,
+	0x1f000000u, 0x1f1f1f1fu, 0x3ffeffffu, 0xffff3f3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000200u,
+	0x00000000u, 0x00070700u, 0x00000000u, 0x0f0f0f0fu,
+	0x1f000000u, 0x1f1f1f1fu, 0xfffeffffu, 0xff3f3f3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00020000u,
+	0x00000000u, 0x00070700u, 0x00000000u, 0x0f0f0f0fu,
+	0x1f000000u, 0x1f1f1f1fu, 0xfffeffffu, 0x3f3f3fffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x02020000u,
+	0x00000000u, 0x07070700u, 0x00000000u, 0x0f0f0f0fu,
+	0x1f000000u, 0x1f1f1f1fu, 0xfffeffffu, 0x3f3fffffu,
+	0xfffdfcfcu, 0xffffffffu, 0xfffdf8f8u, 0xffffffffu,
+	0xfffdf1f1u, 0xffffffffu, 0xfffde3e3u, 0xffffffffu,
+	0xfffdc7c7u, 0xffffffffu, 0xfffd8f8fu, 0xffffffffu,
+	0xfffd1f1fu, 0xffffffffu, 0xfffd3f3fu, 0xffffffffu,
+	0xfffcfcfcu, 0xffffffffu, 0xfff8f8f8u, 0xffffffffu,
+	0xfff1f1f1u, 0xffffffffu, 0xffe1e3e3u, 0xffffffffu,
+	0xffc5c7c7u, 0xffffffffu, 0xff8d8f8fu, 0xffffffffu,
+	0xff1d1f1fu, 0xffffffffu, 0xff3d3f3fu, 0xffffffffu,
+	0x0c0c0c00u, 0x0000000fu, 0x00000000u, 0x00000000u,
+	0x01010100u, 0x00000007u, 0x03010307u, 0x00000f0fu,
+	0x07050707u, 0x000f1f1fu, 0x0f0d0f1fu, 0x1f1f3f3fu,
+	0x1f1d1f3fu, 0x3f3f7f7fu, 0x3f3d3fffu, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x03010300u, 0x00000703u,
+	0x07050f07u, 0x000f0f07u, 0x0f0d1f1fu, 0x1f1f1f0fu,
+	0x1f1d3f3fu, 0x3f3f3f1fu, 0x3f3dffffu, 0xffffff3fu,
+	0x0c0c0000u, 0x00000c0cu, 0x00000000u, 0x00000000u,
+	0x01010000u, 0x00000101u, 0x03050300u, 0x00070303u,
+	0x070d0f07u, 0x000f0707u, 0x0f1d1f1fu, 0x1f1f0f0fu,
+	0x1f3d3f3fu, 0x3f3f1f1fu, 0x3ffdffffu, 0xffff3f3fu,
+	0x0e0d0000u, 0x000c0c0cu, 0x05050000u, 0x00000000u,
+	0x0b0d0000u, 0x00010101u, 0x171d0300u, 0x00030303u,
+	0x2f3d0f07u, 0x0f070707u, 0x5f7d1f1fu, 0x1f0f0f0fu,
+	0xbffd3f3fu, 0x3f1f1f1fu, 0xfffdffffu, 0xff3f3f3fu,
+	0x0f0c0000u, 0x0c0c0c0fu, 0x0f000000u, 0x0000080fu,
+	0x0f010000u, 0x0101010fu, 0x1f050300u, 0x0303031fu,
+	0x3f0d0f07u, 0x0707073fu, 0x7f1d1f1fu, 0x0f0f0f7fu,
+	0xff3d3f3fu, 0x1f1f1fffu, 0xfffdffffu, 0x3f3f3fffu,
+	0x1f1d0000u, 0x0c1c1f1fu, 0x1f1d0000u, 0x00181f1fu,
+	0x1f1d0000u, 0x01111f1fu, 0x1f1d0300u, 0x03031f1fu,
+	0x3f3d0f07u, 0x07073f3fu, 0x7f7d1f1fu, 0x0f0f7f7fu,
+	0xfffd3f3fu, 0x1f1fffffu, 0xfffdffffu, 0x3f3fffffu,
+	0xfffdfcfcu, 0xffffffffu, 0xfffdf8f8u, 0xffffffffu,
+	0xfffdf1f1u, 0xffffffffu, 0xfffde3e3u, 0xffffffffu,
+	0xfffdc7c7u, 0xffffffffu, 0xfffd8f8fu, 0xffffffffu,
+	0xfffd1f1fu, 0xffffffffu, 0xfffd3f3fu, 0xffffffffu,
+	0x07040400u, 0x00000000u, 0x07000000u, 0x00000000u,
+	0x07010100u, 0x00000000u, 0x0f010300u, 0x00000007u,
+	0x1f050707u, 0x00000f0fu, 0x3f0d0f07u, 0x000f1f1fu,
+	0x7f1d1f1fu, 0x1f1f3f3fu, 0xff3d3f3fu, 0x3f3f7f7fu,
+	0x04040000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x01010000u, 0x00000000u, 0x03010300u, 0x00000007u,
+	0x07050300u, 0x0000070fu, 0x0f0d0f07u, 0x000f0f1fu,
+	0x1f1d1f1fu, 0x1f1f1f3fu, 0x3f3d3f3fu, 0x3f3f3f7fu,
+	0x04000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x01000000u, 0x00000000u, 0x03010000u, 0x00000003u,
+	0x07050300u, 0x00000707u, 0x0f0d0f07u, 0x000f0f0fu,
+	0x1f1d1f1fu, 0x1f1f1f1fu, 0x3f3d3f3fu, 0x3f3f3f3fu,
+	0x04000000u, 0x00000004u, 0x00000000u, 0x00000000u,
+	0x01000000u, 0x00000001u, 0x03010000u, 0x00000303u,
+	0x07050300u, 0x00000707u, 0x0f0d0f07u, 0x000f0f0fu,
+	0x1f1d1f1fu, 0x1f1f1f1fu, 0x3f3d3f3fu, 0x3f3f3f3fu,
+	0x05000000u, 0x00000404u, 0x02000000u, 0x00000000u,
+	0x05000000u, 0x00000101u, 0x0b010000u, 0x00000303u,
+	0x17050300u, 0x00070707u, 0x2f0d0f07u, 0x000f0f0fu,
+	0x5f1d1f1fu, 0x1f1f1f1fu, 0xbf3d3f3fu, 0x3f3f3f3fu,
+	0x04000000u, 0x00040407u, 0x00000000u, 0x00000007u,
+	0x01000000u, 0x00010107u, 0x03010000u, 0x0003030fu,
+	0x07050300u, 0x0007071fu, 0x0f0d0f07u, 0x0f0f0f3fu,
+	0x1f1d1f1fu, 0x1f1f1f7fu, 0xbf3d3f3fu, 0x3f3f3fffu,
+	0x0f000000u, 0x04040f0fu, 0x0f000000u, 0x00000f0fu,
+	0x0f000000u, 0x01010f0fu, 0x0f010000u, 0x03030f0fu,
+	0x1f050300u, 0x07071f1fu, 0x3f0d0f07u, 0x0f0f3f3fu,
+	0x7f1d1f1fu, 0x1f1f7f7fu, 0xff3d3f3fu, 0x3f3fffffu,
+	0xfffbfcfcu, 0xffffffffu, 0xfffbf8f8u, 0xffffffffu,
+	0xfffbf1f1u, 0xffffffffu, 0xfffbe3e3u, 0xffffffffu,
+	0xfffbc7c7u, 0xffffffffu, 0xfffb8f8fu, 0xffffffffu,
+	0xfffb1f1fu, 0xffffffffu, 0xfffb3f3fu, 0xffffffffu,
+	0xfff8fcfcu, 0xffffffffu, 0xfff8f8f8u, 0xffffffffu,
+	0xfff1f1f1u, 0xffffffffu, 0xffe3e3e3u, 0xffffffffu,
+	0xffc3c7c7u, 0xffffffffu, 0xff8b8f8fu, 0xffffffffu,
+	0xff1b1f1fu, 0xffffffffu, 0xff3b3f3fu, 0xffffffffu,
+	0x3c383c3eu, 0x00003f3fu, 0x18181800u, 0x0000001eu,
+	0x00000000u, 0x00000000u, 0x03030300u, 0x0000000fu,
+	0x0703070fu, 0x00001f1fu, 0x0f0b0f0fu, 0x001f3f3fu,
+	0x1f1b1f3fu, 0x3f3f7f7fu, 0x3f3b3f7fu, 0x7f7fffffu,
+	0x3c383c00u, 0x00003e3cu, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x07030700u, 0x00000f07u, 0x0f0b1f0fu, 0x001f1f0fu,
+	0x1f1b3f3fu, 0x3f3f3f1fu, 0x3f3b7f7fu, 0x7f7f7f3fu,
+	0x3c3a3c00u, 0x003e3c3cu, 0x18180000u, 0x00001818u,
+	0x00000000u, 0x00000000u, 0x03030000u, 0x00000303u,
+	0x070b0700u, 0x000f0707u, 0x0f1b1f0fu, 0x001f0f0fu,
+	0x1f3b3f3fu, 0x3f3f1f1fu, 0x3f7b7f7fu, 0x7f7f3f3fu,
+	0x3e3b3c00u, 0x003c3c3cu, 0x1d1b0000u, 0x00181818u,
+	0x0a0a0000u, 0x00000000u, 0x171b0000u, 0x00030303u,
+	0x2f3b0700u, 0x00070707u, 0x5f7b1f0fu, 0x1f0f0f0fu,
+	0xbffb3f3fu, 0x3f1f1f1fu, 0x7ffb7f7fu, 0x7f3f3f3fu,
+	0x3f3a3c00u, 0x3c3c3c3fu, 0x1f180000u, 0x1818181fu,
+	0x1f000000u, 0x0000111fu, 0x1f030000u, 0x0303031fu,
+	0x3f0b0700u, 0x0707073fu, 0x7f1b1f0fu, 0x0f0f0f7fu,
+	0xff3b3f3fu, 0x1f1f1fffu, 0xff7b7f7fu, 0x3f3f3fffu,
+	0x3f3b3c00u, 0x3c3c3f3fu, 0x3f3b0000u, 0x18383f3fu,
+	0x3f3b0000u, 0x00313f3fu, 0x3f3b0000u, 0x03233f3fu,
+	0x3f3b0700u, 0x07073f3fu, 0x7f7b1f0fu, 0x0f0f7f7fu,
+	0xfffb3f3fu, 0x1f1fffffu, 0xfffb7f7fu, 0x3f3fffffu,
+	0xfffbfcfcu, 0xffffffffu, 0xfffbf8f8u, 0xffffffffu,
+	0xfffbf1f1u, 0xffffffffu, 0xfffbe3e3u, 0xffffffffu,
+	0xfffbc7c7u, 0xffffffffu, 0xfffb8f8fu, 0xffffffffu,
+	0xfffb1f1fu, 0xffffffffu, 0xfffb3f3fu, 0xffffffffu,
+	0x1f181c00u, 0x0000001eu, 0x0e080800u, 0x00000000u,
+	0x0e000000u, 0x00000000u, 0x0e020200u, 0x00000000u,
+	0x1f030700u, 0x0000000fu, 0x3f0b0f0fu, 0x00001f1fu,
+	0x7f1b1f0fu, 0x001f3f3fu, 0xff3b3f3fu, 0x3f3f7f7fu,
+	0x1c181c00u, 0x0000001eu, 0x08080000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x02020000u, 0x00000000u,
+	0x07030700u, 0x0000000fu, 0x0f0b0700u, 0x00000f1fu,
+	0x1f1b1f0fu, 0x001f1f3fu, 0x3f3b3f3fu, 0x3f3f3f7fu,
+	0x1c180000u, 0x0000001cu, 0x08000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x02000000u, 0x00000000u,
+	0x07030000u, 0x00000007u, 0x0f0b0700u, 0x00000f0fu,
+	0x1f1b1f0fu, 0x001f1f1fu, 0x3f3b3f3fu, 0x3f3f3f3fu,
+	0x1c180000u, 0x00001c1cu, 0x08000000u, 0x00000008u,
+	0x00000000u, 0x00000000u, 0x02000000u, 0x00000002u,
+	0x07030000u, 0x00000707u, 0x0f0b0700u, 0x00000f0fu,
+	0x1f1b1f0fu, 0x001f1f1fu, 0x3f3b3f3fu, 0x3f3f3f3fu,
+	0x1d180000u, 0x00001c1cu, 0x0a000000u, 0x00000808u,
+	0x04000000u, 0x00000000u, 0x0a000000u, 0x00000202u,
+	0x17030000u, 0x00000707u, 0x2f0b0700u, 0x000f0f0fu,
+	0x5f1b1f0fu, 0x001f1f1fu, 0xbf3b3f3fu, 0x3f3f3f3fu,
+	0x1c180000u, 0x001c1c1fu, 0x08000000u, 0x0008080eu,
+	0x00000000u, 0x0000000eu, 0x02000000u, 0x0002020eu,
+	0x07030000u, 0x0007071fu, 0x0f0b0700u, 0x000f0f3fu,
+	0x1f1b1f0fu, 0x1f1f1f7fu, 0x3f3b3f3fu, 0x3f3f3fffu,
+	0x1f180000u, 0x1c1c1f1fu, 0x1f000000u, 0x08081f1fu,
+	0x1f000000u, 0x00001f1fu, 0x1f000000u, 0x02021f1fu,
+	0x1f030000u, 0x07071f1fu, 0x3f0b0700u, 0x0f0f3f3fu,
+	0x7f1b1f0fu, 0x1f1f7f7fu, 0xff3b3f3fu, 0x3f3fffffu,
+	0xfff7fcfcu, 0xffffffffu, 0xfff7f8f8u, 0xffffffffu,
+	0xfff7f1f1u, 0xffffffffu, 0xfff7e3e3u, 0xffffffffu,
+	0xfff7c7c7u, 0xffffffffu, 0xfff78f8fu, 0xffffffffu,
+	0xfff71f1fu, 0xffffffffu, 0xfff73f3fu, 0xffffffffu,
+	0xfff4fcfcu, 0xffffffffu, 0xfff0f8f8u, 0xffffffffu,
+	0xfff1f1f1u, 0xffffffffu, 0xffe3e3e3u, 0xffffffffu,
+	0xffc7c7c7u, 0xffffffffu, 0xff878f8fu, 0xffffffffu,
+	0xff171f1fu, 0xffffffffu, 0xff373f3fu, 0xffffffffu,
+	0xfcf4fcfcu, 0x00feffffu, 0x7870787cu, 0x00007e7eu,
+	0x30303000u, 0x0000003cu, 0x00000000u, 0x00000000u,
+	0x06060600u, 0x0000001eu, 0x0f070f1fu, 0x00003f3fu,
+	0x1f171f1fu, 0x003f7f7fu, 0x3f373f7fu, 0x7f7fffffu,
+	0xfcf4fefcu, 0x00fefefcu, 0x78707800u, 0x00007c78u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x0f070f00u, 0x00001f0fu,
+	0x1f173f1fu, 0x003f3f1fu, 0x3f377f7fu, 0x7f7f7f3fu,
+	0xfcf6fefcu, 0x00fefcfcu, 0x78747800u, 0x007c7878u,
+	0x30300000u, 0x00003030u, 0x00000000u, 0x00000000u,
+	0x06060000u, 0x00000606u, 0x0f170f00u, 0x001f0f0fu,
+	0x1f373f1fu, 0x003f1f1fu, 0x3f777f7fu, 0x7f7f3f3fu,
+	0xfef7fefcu, 0xfefcfcfcu, 0x7d777800u, 0x00787878u,
+	0x3a360000u, 0x00303030u, 0x14140000u, 0x00000000u,
+	0x2e360000u, 0x00060606u, 0x5f770f00u, 0x000f0f0fu,
+	0xbff73f1fu, 0x3f1f1f1fu, 0x7ff77f7fu, 0x7f3f3f3fu,
+	0xfff6fefcu, 0xfcfcfcffu, 0x7f747800u, 0x7878787fu,
+	0x3e300000u, 0x3030303eu, 0x3e000000u, 0x0000223eu,
+	0x3e060000u, 0x0606063eu, 0x7f170f00u, 0x0f0f0f7fu,
+	0xff373f1fu, 0x1f1f1fffu, 0xff777f7fu, 0x3f3f3fffu,
+	0xfff7fefcu, 0xfcfcffffu, 0x7f777800u, 0x78787f7fu,
+	0x7f770000u, 0x30717f7fu, 0x7f770000u, 0x00637f7fu,
+	0x7f770000u, 0x06477f7fu, 0x7f770f00u, 0x0f0f7f7fu,
+	0xfff73f1fu, 0x1f1fffffu, 0xfff77f7fu, 0x3f3fffffu,
+	0xfff7fcfcu, 0xffffffffu, 0xfff7f8f8u, 0xffffffffu,
+	0xfff7f1f1u, 0xffffffffu, 0xfff7e3e3u, 0xffffffffu,
+	0xfff7c7c7u, 0xffffffffu, 0xfff78f8fu, 0xffffffffu,
+	0xfff71f1fu, 0xffffffffu, 0xfff73f3fu, 0xffffffffu,
+	0x7f747c7cu, 0x00007e7eu, 0x3e303800u, 0x0000003cu,
+	0x1c101000u, 0x00000000u, 0x1c000000u, 0x00000000u,
+	0x1c040400u, 0x00000000u, 0x3e060e00u, 0x0000001eu,
+	0x7f171f1fu, 0x00003f3fu, 0xff373f1fu, 0x003f7f7fu,
+	0x7c747800u, 0x00007c7eu, 0x38303800u, 0x0000003cu,
+	0x10100000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x04040000u, 0x00000000u, 0x0e060e00u, 0x0000001eu,
+	0x1f170f00u, 0x00001f3fu, 0x3f373f1fu, 0x003f3f7fu,
+	0x7c747800u, 0x00007c7cu, 0x38300000u, 0x00000038u,
+	0x10000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x04000000u, 0x00000000u, 0x0e060000u, 0x0000000eu,
+	0x1f170f00u, 0x00001f1fu, 0x3f373f1fu, 0x003f3f3fu,
+	0x7c747800u, 0x00007c7cu, 0x38300000u, 0x00003838u,
+	0x10000000u, 0x00000010u, 0x00000000u, 0x00000000u,
+	0x04000000u, 0x00000004u, 0x0e060000u, 0x00000e0eu,
+	0x1f170f00u, 0x00001f1fu, 0x3f373f1fu, 0x003f3f3fu,
+	0x7d747800u, 0x007c7c7cu, 0x3a300000u, 0x00003838u,
+	0x14000000u, 0x00001010u, 0x08000000u, 0x00000000u,
+	0x14000000u, 0x00000404u, 0x2e060000u, 0x00000e0eu,
+	0x5f170f00u, 0x001f1f1fu, 0xbf373f1fu, 0x003f3f3fu,
+	0x7c747800u, 0x007c7c7fu, 0x38300000u, 0x0038383eu,
+	0x10000000u, 0x0010101cu, 0x00000000u, 0x0000001cu,
+	0x04000000u, 0x0004041cu, 0x0e060000u, 0x000e0e3eu,
+	0x1f170f00u, 0x001f1f7fu, 0x3f373f1fu, 0x3f3f3fffu,
+	0x7f747800u, 0x7c7c7f7fu, 0x3e300000u, 0x38383e3eu,
+	0x3e000000u, 0x10103e3eu, 0x3e000000u, 0x00003e3eu,
+	0x3e000000u, 0x04043e3eu, 0x3e060000u, 0x0e0e3e3eu,
+	0x7f170f00u, 0x1f1f7f7fu, 0xff373f1fu, 0x3f3fffffu,
+	0xfffffcfcu, 0xffffffffu, 0xfffff8f8u, 0xffffffffu,
+	0xfffff0f1u, 0xffffffffu, 0xffffe2e3u, 0xffffffffu,
+	0xffffc6c7u, 0xffffffffu, 0xffff8e8fu, 0xffffffffu,
+	0xffff1e1fu, 0xffffffffu, 0xffff3e3fu, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0xfff8f8f8u, 0xffffffffu,
+	0xfff1f0f1u, 0xffffffffu, 0xffe3e2e3u, 0xffffffffu,
+	0xffc7c6c7u, 0xffffffffu, 0xff8f8e8fu, 0xffffffffu,
+	0xff1f1e1fu, 0xffffffffu, 0xff3f3e3fu, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x01000000u, 0x00000f0fu, 0x03030200u, 0x00071f1fu,
+	0x07070600u, 0x0f0f3f3fu, 0x0f0f0e00u, 0x1f1f7f7fu,
+	0x1f1f1effu, 0xffffffffu, 0x3f3f3effu, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000200u, 0x03030000u, 0x00070703u,
+	0x07070000u, 0x0f0f0f07u, 0x0f0f0000u, 0x1f1f1f0fu,
+	0x1f1ffeffu, 0xffffff1fu, 0x3f3ffeffu, 0xffffff3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x03000000u, 0x00070303u,
+	0x07000000u, 0x0f0f0707u, 0x0f000000u, 0x1f1f0f0fu,
+	0x1ffffeffu, 0xffff1f1fu, 0x3ffffeffu, 0xffff3f3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00030303u,
+	0x00000000u, 0x0f070707u, 0x1f000000u, 0x1f0f0f0fu,
+	0xfffffeffu, 0xff1f1f1fu, 0xfffffeffu, 0xff3f3f3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x03030300u,
+	0x00000000u, 0x0707070fu, 0x1f000000u, 0x0f0f0f1fu,
+	0xfffffeffu, 0x1f1f1fffu, 0xfffffeffu, 0x3f3f3fffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x03030700u,
+	0x00000000u, 0x07070f0fu, 0x1f000000u, 0x0f0f1f1fu,
+	0xfffffeffu, 0x1f1fffffu, 0xfffffeffu, 0x3f3fffffu,
+	0x00030000u, 0x00000000u, 0x00030000u, 0x00000000u,
+	0xfffff0f1u, 0xffffffffu, 0xffffe2e3u, 0xffffffffu,
+	0xffffc6c7u, 0xffffffffu, 0xffff8e8fu, 0xffffffffu,
+	0xffff1e1fu, 0xffffffffu, 0xffff3e3fu, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x0f000000u, 0x00000f0fu, 0x0f020200u, 0x00000f0fu,
+	0x1f070600u, 0x00071f1fu, 0x3f0f0e00u, 0x0f0f3f3fu,
+	0x7f1f1e00u, 0x1f1f7f7fu, 0xff3f3e3fu, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000006u, 0x02020000u, 0x0000020eu,
+	0x07070000u, 0x0007071fu, 0x0f0f0000u, 0x0f0f0f3fu,
+	0x1f1f0000u, 0x1f1f1f7fu, 0x3f3f3effu, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x02000000u, 0x00000202u,
+	0x07000000u, 0x00070707u, 0x0f000000u, 0x0f0f0f0fu,
+	0x1f000000u, 0x1f1f1f1fu, 0x3f3ffeffu, 0xffffff3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000202u,
+	0x00000000u, 0x00070707u, 0x00000000u, 0x0f0f0f0fu,
+	0x1f000000u, 0x1f1f1f1fu, 0x3ffffeffu, 0xffff3f3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000200u,
+	0x00000000u, 0x00070700u, 0x00000000u, 0x0f0f0f0fu,
+	0x1f000000u, 0x1f1f1f1fu, 0xfffffeffu, 0xff3f3f3fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00020000u,
+	0x00000000u, 0x00070700u, 0x00000000u, 0x0f0f0f0fu,
+	0x1f000000u, 0x1f1f1f1fu, 0xfffffeffu, 0x3f3f3fffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x02020000u,
+	0x00000000u, 0x07070700u, 0x00000000u, 0x0f0f0f0fu,
+	0x1f000000u, 0x1f1f1f1fu, 0xfffffeffu, 0x3f3fffffu,
+	0xfffffcfcu, 0xffffffffu, 0xfffff8f8u, 0xffffffffu,
+	0xfffff1f1u, 0xffffffffu, 0xffffe1e3u, 0xffffffffu,
+	0xffffc5c7u, 0xffffffffu, 0xffff8d8fu, 0xffffffffu,
+	0xffff1d1fu, 0xffffffffu, 0xffff3d3fu, 0xffffffffu,
+	0xfffcfcfcu, 0xffffffffu, 0x00000000u, 0x00000000u,
+	0xfff1f1f1u, 0xffffffffu, 0xffe3e1e3u, 0xffffffffu,
+	0xffc7c5c7u, 0xffffffffu, 0xff8f8d8fu, 0xffffffffu,
+	0xff1f1d1fu, 0xffffffffu, 0xff3f3d3fu, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x03030103u, 0x00001f1fu,
+	0x0707050fu, 0x000f3f3fu, 0x0f0f0d1fu, 0x1f1f7f7fu,
+	0x1f1f1d3fu, 0x3f3fffffu, 0x3f3f3dffu, 0xffffffffu,
+	0x0c0c0c00u, 0x0000000cu, 0x00000000u, 0x00000000u,
+	0x01010100u, 0x00000001u, 0x03030503u, 0x00000703u,
+	0x07070d0fu, 0x000f0f07u, 0x0f0f1d1fu, 0x1f1f1f0fu,
+	0x1f1f3d3fu, 0x3f3f3f1fu, 0x3f3ffdffu, 0xffffff3fu,
+	0x0c0e0d00u, 0x00000c0cu, 0x00050500u, 0x00000000u,
+	0x010b0d00u, 0x00000101u, 0x03171d03u, 0x00000303u,
+	0x072f3d0fu, 0x000f0707u, 0x0f5f7d1fu, 0x1f1f0f0fu,
+	0x1fbffd3fu, 0x3f3f1f1fu, 0x3ffffdffu, 0xffff3f3fu,
+	0x0f0f0c00u, 0x000c0c0cu, 0x0f0f0000u, 0x00000008u,
+	0x0f0f0100u, 0x00010101u, 0x1f1f0503u, 0x00030303u,
+	0x3f3f0d0fu, 0x00070707u, 0x7f7f1d1fu, 0x1f0f0f0fu,
+	0xffff3d3fu, 0x3f1f1f1fu, 0xfffffdffu, 0xff3f3f3fu,
+	0x1f1f1d00u, 0x0c0c1c1fu, 0x1f1f1d00u, 0x0000181fu,
+	0x1f1f1d00u, 0x0101111fu, 0x1f1f1d03u, 0x0303031fu,
+	0x3f3f3d0fu, 0x0707073fu, 0x7f7f7d1fu, 0x0f0f0f7fu,
+	0xfffffd3fu, 0x1f1f1fffu, 0xfffffdffu, 0x3f3f3fffu,
+	0x3f3f3d3fu, 0x0c3c3f3fu, 0x3f3f3d3fu, 0x00383f3fu,
+	0x3f3f3d3fu, 0x01313f3fu, 0x3f3f3d3fu, 0x03233f3fu,
+	0x3f3f3d3fu, 0x07073f3fu, 0x7f7f7d7fu, 0x0f0f7f7fu,
+	0xfffffdffu, 0x1f1fffffu, 0xfffffdffu, 0x3f3fffffu,
+	0x00070404u, 0x00000000u, 0x00070000u, 0x00000000u,
+	0x00070101u, 0x00000000u, 0xffffe1e3u, 0xffffffffu,
+	0xffffc5c7u, 0xffffffffu, 0xffff8d8fu, 0xffffffffu,
+	0xffff1d1fu, 0xffffffffu, 0xffff3d3fu, 0xffffffffu,
+	0x00040400u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00010100u, 0x00000000u, 0x1f030103u, 0x00001f1fu,
+	0x1f070503u, 0x00001f1fu, 0x3f0f0d0fu, 0x000f3f3fu,
+	0x7f1f1d1fu, 0x1f1f7f7fu, 0xff3f3d3fu, 0x3f3fffffu,
+	0x00040000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00010000u, 0x00000000u, 0x03030100u, 0x0000000fu,
+	0x07070503u, 0x0000071fu, 0x0f0f0d0fu, 0x000f0f3fu,
+	0x1f1f1d1fu, 0x1f1f1f7fu, 0x3f3f3d3fu, 0x3f3f3fffu,
+	0x04040000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x01010000u, 0x00000000u, 0x03030100u, 0x00000003u,
+	0x07070503u, 0x00000707u, 0x0f0f0d0fu, 0x000f0f0fu,
+	0x1f1f1d1fu, 0x1f1f1f1fu, 0x3f3f3d3fu, 0x3f3f3f3fu,
+	0x04050000u, 0x00000004u, 0x00020000u, 0x00000000u,
+	0x01050000u, 0x00000001u, 0x030b0100u, 0x00000003u,
+	0x07170503u, 0x00000707u, 0x0f2f0d0fu, 0x000f0f0fu,
+	0x1f5f1d1fu, 0x1f1f1f1fu, 0x3fbf3d3fu, 0x3f3f3f3fu,
+	0x07040000u, 0x00000404u, 0x07000000u, 0x00000000u,
+	0x07010000u, 0x00000101u, 0x0f030100u, 0x00000303u,
+	0x1f070503u, 0x00000707u, 0x3f0f0d0fu, 0x000f0f0fu,
+	0x7f1f1d1fu, 0x1f1f1f1fu, 0xffbf3d3fu, 0x3f3f3f3fu,
+	0x0f0f0000u, 0x0004040fu, 0x0f0f0000u, 0x0000000fu,
+	0x0f0f0000u, 0x0001010fu, 0x0f0f0100u, 0x0003030fu,
+	0x1f1f0503u, 0x0007071fu, 0x3f3f0d0fu, 0x000f0f3fu,
+	0x7f7f1d1fu, 0x1f1f1f7fu, 0xffff3d3fu, 0x3f3f3fffu,
+	0x1f1f1d00u, 0x04041f1fu, 0x1f1f1d00u, 0x00001f1fu,
+	0x1f1f1d00u, 0x01011f1fu, 0x1f1f1d00u, 0x03031f1fu,
+	0x1f1f1d03u, 0x07071f1fu, 0x3f3f3d0fu, 0x0f0f3f3fu,
+	0x7f7f7d1fu, 0x1f1f7f7fu, 0xfffffd3fu, 0x3f3fffffu,
+	0xfffff8fcu, 0xffffffffu, 0xfffff8f8u, 0xffffffffu,
+	0xfffff1f1u, 0xffffffffu, 0xffffe3e3u, 0xffffffffu,
+	0xffffc3c7u, 0xffffffffu, 0xffff8b8fu, 0xffffffffu,
+	0xffff1b1fu, 0xffffffffu, 0xffff3b3fu, 0xffffffffu,
+	0xfffcf8fcu, 0xffffffffu, 0xfff8f8f8u, 0xffffffffu,
+	0x00000000u, 0x00000000u, 0xffe3e3e3u, 0xffffffffu,
+	0xffc7c3c7u, 0xffffffffu, 0xff8f8b8fu, 0xffffffffu,
+	0xff1f1b1fu, 0xffffffffu, 0xff3f3b3fu, 0xffffffffu,
+	0x3c3c383cu, 0x00003f3fu, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x07070307u, 0x00003f3fu, 0x0f0f0b1fu, 0x001f7f7fu,
+	0x1f1f1b3fu, 0x3f3fffffu, 0x3f3f3b7fu, 0x7f7fffffu,
+	0x3c3c3a3cu, 0x00003e3cu, 0x18181800u, 0x00000018u,
+	0x00000000u, 0x00000000u, 0x03030300u, 0x00000003u,
+	0x07070b07u, 0x00000f07u, 0x0f0f1b1fu, 0x001f1f0fu,
+	0x1f1f3b3fu, 0x3f3f3f1fu, 0x3f3f7b7fu, 0x7f7f7f3fu,
+	0x3c3e3b3cu, 0x00003c3cu, 0x181d1b00u, 0x00001818u,
+	0x000a0a00u, 0x00000000u, 0x03171b00u, 0x00000303u,
+	0x072f3b07u, 0x00000707u, 0x0f5f7b1fu, 0x001f0f0fu,
+	0x1fbffb3fu, 0x3f3f1f1fu, 0x3f7ffb7fu, 0x7f7f3f3fu,
+	0x3f3f3a3cu, 0x003c3c3cu, 0x1f1f1800u, 0x00181818u,
+	0x1f1f0000u, 0x00000011u, 0x1f1f0300u, 0x00030303u,
+	0x3f3f0b07u, 0x00070707u, 0x7f7f1b1fu, 0x000f0f0fu,
+	0xffff3b3fu, 0x3f1f1f1fu, 0xffff7b7fu, 0x7f3f3f3fu,
+	0x3f3f3b3cu, 0x3c3c3c3fu, 0x3f3f3b00u, 0x1818383fu,
+	0x3f3f3b00u, 0x0000313fu, 0x3f3f3b00u, 0x0303233fu,
+	0x3f3f3b07u, 0x0707073fu, 0x7f7f7b1fu, 0x0f0f0f7fu,
+	0xfffffb3fu, 0x1f1f1fffu, 0xfffffb7fu, 0x3f3f3fffu,
+	0x7f7f7b7fu, 0x3c7c7f7fu, 0x7f7f7b7fu, 0x18787f7fu,
+	0x7f7f7b7fu, 0x00717f7fu, 0x7f7f7b7fu, 0x03637f7fu,
+	0x7f7f7b7fu, 0x07477f7fu, 0x7f7f7b7fu, 0x0f0f7f7fu,
+	0xfffffbffu, 0x1f1fffffu, 0xfffffbffu, 0x3f3fffffu,
+	0xfffff8fcu, 0xffffffffu, 0x000e0808u, 0x00000000u,
+	0x000e0000u, 0x00000000u, 0x000e0202u, 0x00000000u,
+	0xffffc3c7u, 0xffffffffu, 0xffff8b8fu, 0xffffffffu,
+	0xffff1b1fu, 0xffffffffu, 0xffff3b3fu, 0xffffffffu,
+	0x3f3c383cu, 0x00003f3fu, 0x00080800u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00020200u, 0x00000000u,
+	0x3f070307u, 0x00003f3fu, 0x3f0f0b07u, 0x00003f3fu,
+	0x7f1f1b1fu, 0x001f7f7fu, 0xff3f3b3fu, 0x3f3fffffu,
+	0x1c1c1800u, 0x0000001fu, 0x00080000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00020000u, 0x00000000u,
+	0x07070300u, 0x0000001fu, 0x0f0f0b07u, 0x00000f3fu,
+	0x1f1f1b1fu, 0x001f1f7fu, 0x3f3f3b3fu, 0x3f3f3fffu,
+	0x1c1c1800u, 0x0000001cu, 0x08080000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x02020000u, 0x00000000u,
+	0x07070300u, 0x00000007u, 0x0f0f0b07u, 0x00000f0fu,
+	0x1f1f1b1fu, 0x001f1f1fu, 0x3f3f3b3fu, 0x3f3f3f3fu,
+	0x1c1d1800u, 0x0000001cu, 0x080a0000u, 0x00000008u,
+	0x00040000u, 0x00000000u, 0x020a0000u, 0x00000002u,
+	0x07170300u, 0x00000007u, 0x0f2f0b07u, 0x00000f0fu,
+	0x1f5f1b1fu, 0x001f1f1fu, 0x3fbf3b3fu, 0x3f3f3f3fu,
+	0x1f1c1800u, 0x00001c1cu, 0x0e080000u, 0x00000808u,
+	0x0e000000u, 0x00000000u, 0x0e020000u, 0x00000202u,
+	0x1f070300u, 0x00000707u, 0x3f0f0b07u, 0x00000f0fu,
+	0x7f1f1b1fu, 0x001f1f1fu, 0xff3f3b3fu, 0x3f3f3f3fu,
+	0x1f1f1800u, 0x001c1c1fu, 0x1f1f0000u, 0x0008081fu,
+	0x1f1f0000u, 0x0000001fu, 0x1f1f0000u, 0x0002021fu,
+	0x1f1f0300u, 0x0007071fu, 0x3f3f0b07u, 0x000f0f3fu,
+	0x7f7f1b1fu, 0x001f1f7fu, 0xffff3b3fu, 0x3f3f3fffu,
+	0x3f3f3b00u, 0x1c1c3f3fu, 0x3f3f3b00u, 0x08083f3fu,
+	0x3f3f3b00u, 0x00003f3fu, 0x3f3f3b00u, 0x02023f3fu,
+	0x3f3f3b00u, 0x07073f3fu, 0x3f3f3b07u, 0x0f0f3f3fu,
+	0x7f7f7b1fu, 0x1f1f7f7fu, 0xfffffb3fu, 0x3f3fffffu,
+	0xfffff4fcu, 0xffffffffu, 0xfffff0f8u, 0xffffffffu,
+	0xfffff1f1u, 0xffffffffu, 0xffffe3e3u, 0xffffffffu,
+	0xffffc7c7u, 0xffffffffu, 0xffff878fu, 0xffffffffu,
+	0xffff171fu, 0xffffffffu, 0xffff373fu, 0xffffffffu,
+	0xfffcf4fcu, 0xffffffffu, 0xfff8f0f8u, 0xffffffffu,
+	0xfff1f1f1u, 0xffffffffu, 0x00000000u, 0x00000000u,
+	0xffc7c7c7u, 0xffffffffu, 0xff8f878fu, 0xffffffffu,
+	0xff1f171fu, 0xffffffffu, 0xff3f373fu, 0xffffffffu,
+	0xfcfcf4feu, 0x00feffffu, 0x78787078u, 0x00007f7fu,
+	0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x0f0f070fu, 0x00007f7fu,
+	0x1f1f173fu, 0x003fffffu, 0x3f3f377fu, 0x7f7fffffu,
+	0xfcfcf6feu, 0x00fefefcu, 0x78787478u, 0x00007c78u,
+	0x30303000u, 0x00000030u, 0x00000000u, 0x00000000u,
+	0x06060600u, 0x00000006u, 0x0f0f170fu, 0x00001f0fu,
+	0x1f1f373fu, 0x003f3f1fu, 0x3f3f777fu, 0x7f7f7f3fu,
+	0xfcfef7feu, 0x00fefcfcu, 0x787d7778u, 0x00007878u,
+	0x303a3600u, 0x00003030u, 0x00141400u, 0x00000000u,
+	0x062e3600u, 0x00000606u, 0x0f5f770fu, 0x00000f0fu,
+	0x1fbff73fu, 0x003f1f1fu, 0x3f7ff77fu, 0x7f7f3f3fu,
+	0xfffff6feu, 0x00fcfcfcu, 0x7f7f7478u, 0x00787878u,
+	0x3e3e3000u, 0x00303030u, 0x3e3e0000u, 0x00000022u,
+	0x3e3e0600u, 0x00060606u, 0x7f7f170fu, 0x000f0f0fu,
+	0xffff373fu, 0x001f1f1fu, 0xffff777fu, 0x7f3f3f3fu,
+	0xfffff7feu, 0xfcfcfcffu, 0x7f7f7778u, 0x7878787fu,
+	0x7f7f7700u, 0x3030717fu, 0x7f7f7700u, 0x0000637fu,
+	0x7f7f7700u, 0x0606477fu, 0x7f7f770fu, 0x0f0f0f7fu,
+	0xfffff73fu, 0x1f1f1fffu, 0xfffff77fu, 0x3f3f3fffu,
+	0xfffff7ffu, 0xfcfcffffu, 0xfffff7ffu, 0x78f8ffffu,
+	0xfffff7ffu, 0x30f1ffffu, 0xfffff7ffu, 0x00e3ffffu,
+	0xfffff7ffu, 0x06c7ffffu, 0xfffff7ffu, 0x0f8fffffu,
+	0xfffff7ffu, 0x1f1fffffu, 0xfffff7ffu, 0x3f3fffffu,
+	0xfffff4fcu, 0xffffffffu, 0xfffff0f8u, 0xffffffffu,
+	0x001c1010u, 0x00000000u, 0x001c0000u, 0x00000000u,
+	0x001c0404u, 0x00000000u, 0xffff878fu, 0xffffffffu,
+	0xffff171fu, 0xffffffffu, 0xffff373fu, 0xffffffffu,
+	0x7f7c7478u, 0x00007f7fu, 0x7f787078u, 0x00007f7fu,
+	0x00101000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00040400u, 0x00000000u, 0x7f0f070fu, 0x00007f7fu,
+	0x7f1f170fu, 0x00007f7fu, 0xff3f373fu, 0x003fffffu,
+	0x7c7c7478u, 0x00007c7fu, 0x38383000u, 0x0000003eu,
+	0x00100000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x00040000u, 0x00000000u, 0x0e0e0600u, 0x0000003eu,
+	0x1f1f170fu, 0x00001f7fu, 0x3f3f373fu, 0x003f3fffu,
+	0x7c7c7478u, 0x00007c7cu, 0x38383000u, 0x00000038u,
+	0x10100000u, 0x00000000u, 0x00000000u, 0x00000000u,
+	0x04040000u, 0x00000000u, 0x0e0e0600u, 0x0000000eu,
+	0x1f1f170fu, 0x00001f1fu, 0x3f3f373fu, 0x003f3f3fu,
+	0x7c7d7478u, 0x00007c7cu, 0x383a3000u, 0x00000038u,
+	0x10140000u, 0x00000010u, 0x00080000u, 0x00000000u,
+	0x04140000u, 0x00000004u, 0x0e2e0600u, 0x0000000eu,
+	0x1f5f170fu, 0x00001f1fu, 0x3fbf373fu, 0x003f3f3fu,
+	0x7f7c7478u, 0x00007c7cu, 0x3e383000u, 0x00003838u,
+	0x1c100000u, 0x00001010u, 0x1c000000u, 0x00000000u,
+	0x1c040000u, 0x00000404u, 0x3e0e0600u, 0x00000e0eu,
+	0x7f1f170fu, 0x00001f1fu, 0xff3f373fu, 0x003f3f3fu,
+	0x7f7f7478u, 0x007c7c7fu, 0x3e3e3000u, 0x0038383eu,
+	0x3e3e0000u, 0x0010103eu, 0x3e3e0000u, 0x0000003eu,
+	0x3e3e0000u, 0x0004043eu, 0x3e3e0600u, 0x000e0e3eu,
+	0x7f7f170fu, 0x001f1f7fu, 0xffff373fu, 0x003f3fffu,
+	0x7f7f7778u, 0x7c7c7f7fu, 0x7f7f7700u, 0x38387f7fu,
+	0x7f7f7700u, 0x10107f7fu, 0x7f7f7700u, 0x00007f7fu,
+	0x7f7f7700u, 0x04047f7fu, 0x7f7f7700u, 0x0e0e7f7fu,
+	0x7f7f770fu, 0x1f1f7f7fu, 0xfffff73fu, 0x3f3fffffu
+};
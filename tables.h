@@ -0,0 +1,21 @@
+#ifndef TABLES_H
+#define TABLES_H
+
+#include "board.h"
+#include "bitbase.h"
+
+/* Constant tables in tables.c, which gentables writes at build time */
+extern const Bitboard pawn_attack_table[2][64];
+extern const Bitboard knight_attack_table[64];
+extern const Bitboard king_attack_table[64];
+extern const Bitboard bishop_pseudo_table[64];
+extern const Bitboard rook_pseudo_table[64];
+extern const Bitboard between_table[64][64];
+extern const Bitboard line_table[64][64];
+extern const uint64_t zobrist_piece[2][NUM_PIECE_TYPES][64];
+extern const uint64_t zobrist_side;
+extern const uint64_t zobrist_castling[16];
+extern const uint64_t zobrist_ep[8];
+extern const uint32_t kpk_table[KPK_SIZE / 32];
+
+#endif
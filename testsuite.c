@@ -0,0 +1,176 @@
+#define _POSIX_C_SOURCE 200809L
+#include "testsuite.h"
+#include "board.h"
+#include "movegen.h"
+#include "engine.h"
+#include "epd.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * EPD test-suite runner. Each position is searched for a fixed time with
+ * a fresh transposition table; after every iteration the current best
+ * move is checked against the bm/am opcodes. A position counts as solved
+ * when the final move is right, and its time-to-solution is the point
+ * from which the best move was right in every later iteration.
+ */
+
+#define SUITE_MAX_MOVES 8
+
+typedef struct {
+	Move     bm[SUITE_MAX_MOVES], am[SUITE_MAX_MOVES];
+	int      n_bm, n_am;
+	bool     correct;
+	int      solve_depth;
+	uint64_t solve_nodes;
+	int64_t  solve_ms;
+} SuiteProbe;
+
+static int64_t suite_time_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static bool same_move(const Move *a, const Move *b) {
+	return a->from == b->from && a->to == b->to && a->flags == b->flags;
+}
+
+static bool suite_move_ok(const SuiteProbe *t, const Move *m) {
+	for (int i = 0; i < t->n_am; i++)
+		if (same_move(&t->am[i], m)) return false;
+	if (t->n_bm == 0) return true;
+	for (int i = 0; i < t->n_bm; i++)
+		if (same_move(&t->bm[i], m)) return true;
+	return false;
+}
+
+static void suite_iteration(void *ctx, int depth, int score,
+                            const Move *best, uint64_t nodes, int64_t ms) {
+	SuiteProbe *t = ctx;
+	(void)score;
+	if (!suite_move_ok(t, best)) {
+		t->correct = false;
+	} else if (!t->correct) {
+		t->correct = true;
+		t->solve_depth = depth;
+		t->solve_nodes = nodes;
+		t->solve_ms = ms;
+	}
+}
+
+/* Parse a space-separated SAN (or coordinate) move list; -1 on error */
+static int suite_moves(const char *list, const Position *p, Move *out) {
+	char buf[256];
+	strncpy(buf, list, sizeof(buf) - 1);
+	buf[sizeof(buf) - 1] = '\0';
+	int n = 0;
+	for (char *tok = strtok(buf, " "); tok; tok = strtok(NULL, " ")) {
+		if (n == SUITE_MAX_MOVES) break;
+		if (!parse_san(tok, p, &out[n]) && !parse_move(tok, p, &out[n]))
+			return -1;
+		n++;
+	}
+	return n;
+}
+
+int testsuite_run(const char *path, int64_t movetime_ms) {
+	EpdFile file;
+	if (!epd_open(&file, path)) {
+		fprintf(stderr, "cannot open %s\n", path);
+		return 1;
+	}
+	volatile int stop = 0;
+	SearchState *st = malloc(sizeof(SearchState));
+	if (!st) {
+		epd_close(&file);
+		return 1;
+	}
+	search_state_init(st, &stop);
+
+	printf("Test suite %s, %lld ms per position\n\n", path, (long long)movetime_ms);
+	printf("   #  %-12s %-8s %-16s %-7s %5s %9s %11s\n",
+	       "id", "result", "expected", "found", "depth", "time", "nodes");
+
+	int total = 0, solved = 0, skipped = 0;
+	int64_t solve_ms = 0, search_ms = 0;
+	uint64_t solve_nodes = 0;
+	char unsolved[1024] = "";
+	size_t offset = 0;
+	const char *line;
+	size_t len;
+
+	while (epd_next_line(&file, &offset, &line, &len)) {
+		Position p;
+		char fen[256], id[64], bm[256] = "", am[256] = "";
+		const char *ops;
+		size_t ops_len;
+		SuiteProbe t;
+		memset(&t, 0, sizeof(t));
+
+		if (!epd_parse(line, len, &p, fen, sizeof(fen), &ops, &ops_len)) {
+			skipped++;
+			continue;
+		}
+		if (!epd_opcode(ops, ops_len, "id", id, sizeof(id)))
+			snprintf(id, sizeof(id), "#%d", total + skipped + 1);
+		bool has_bm = epd_opcode(ops, ops_len, "bm", bm, sizeof(bm));
+		bool has_am = epd_opcode(ops, ops_len, "am", am, sizeof(am));
+		t.n_bm = has_bm ? suite_moves(bm, &p, t.bm) : 0;
+		t.n_am = has_am ? suite_moves(am, &p, t.am) : 0;
+		if ((!has_bm && !has_am) || t.n_bm < 0 || t.n_am < 0) {
+			printf("      %-12s skipped: no usable bm/am\n", id);
+			skipped++;
+			continue;
+		}
+		total++;
+
+		engine_init();
+		stop = 0;
+		st->iter_fn = suite_iteration;
+		st->iter_ctx = &t;
+		Move best;
+		int64_t start = suite_time_ms();
+		engine_search_state(st, &p, MAX_PLY, movetime_ms, false, &best);
+		search_ms += suite_time_ms() - start;
+
+		char found[12], expected[300];
+		move_to_san(&best, &p, found);
+		if (has_bm && has_am)
+			snprintf(expected, sizeof(expected), "%s / am %s", bm, am);
+		else if (has_bm)
+			snprintf(expected, sizeof(expected), "%s", bm);
+		else
+			snprintf(expected, sizeof(expected), "am %s", am);
+
+		bool ok = t.correct && suite_move_ok(&t, &best);
+		if (ok) {
+			solved++;
+			solve_ms += t.solve_ms;
+			solve_nodes += t.solve_nodes;
+			printf("%4d  %-12s %-8s %-16s %-7s %5d %7lldms %11llu\n",
+			       total, id, "solved", expected, found, t.solve_depth,
+			       (long long)t.solve_ms, (unsigned long long)t.solve_nodes);
+		} else {
+			printf("%4d  %-12s %-8s %-16s %-7s %5s %9s %11s\n",
+			       total, id, "FAILED", expected, found, "-", "-", "-");
+			size_t used = strlen(unsolved);
+			if (used + strlen(id) + 2 < sizeof(unsolved))
+				sprintf(unsolved + used, "%s%s", used ? " " : "", id);
+		}
+	}
+
+	printf("\nSolved %d/%d", solved, total);
+	if (total) printf(" (%.0f%%)", solved * 100.0 / total);
+	printf("  time-to-solution %lld ms  nodes-to-solution %llu  search time %lld ms\n",
+	       (long long)solve_ms, (unsigned long long)solve_nodes,
+	       (long long)search_ms);
+	if (skipped) printf("Skipped %d lines\n", skipped);
+	if (unsolved[0]) printf("Unsolved: %s\n", unsolved);
+
+	free(st);
+	epd_close(&file);
+	return 0;
+}
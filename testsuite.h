@@ -0,0 +1,10 @@
+#ifndef TESTSUITE_H
+#define TESTSUITE_H
+
+#include <stdint.h>
+
+#define TESTSUITE_MOVETIME 1000
+
+int testsuite_run(const char *path, int64_t movetime_ms);
+
+#endif
@@ -0,0 +1,92 @@
+#define _POSIX_C_SOURCE 200809L
+#include "trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+static FILE           *trace_file;
+static uint32_t        trace_searches, trace_threads;
+static pthread_mutex_t trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t   ring_key;
+static pthread_once_t  ring_once = PTHREAD_ONCE_INIT;
+
+static void ring_free(void *p) {
+	TraceRing *r = p;
+	free(r->rec);
+	free(r);
+}
+
+static void ring_key_init(void) {
+	pthread_key_create(&ring_key, ring_free);
+}
+
+/* Truncates path; every later search is appended as a chunk */
+bool trace_open(const char *path) {
+	FILE *f = fopen(path, "wb");
+	if (!f) return false;
+	static const char magic[8] = TRACE_MAGIC;
+	fwrite(magic, 1, sizeof(magic), f);
+	fflush(f);
+	pthread_mutex_lock(&trace_lock);
+	if (trace_file) fclose(trace_file);
+	trace_file = f;
+	pthread_mutex_unlock(&trace_lock);
+	return true;
+}
+
+void trace_close(void) {
+	pthread_mutex_lock(&trace_lock);
+	if (trace_file) fclose(trace_file);
+	trace_file = NULL;
+	pthread_mutex_unlock(&trace_lock);
+}
+
+/* The ring is allocated on a thread's first traced search and freed
+ * when the thread exits */
+TraceRing *trace_attach(void) {
+	if (!trace_file) return NULL;
+	pthread_once(&ring_once, ring_key_init);
+	TraceRing *r = pthread_getspecific(ring_key);
+	if (!r) {
+		r = calloc(1, sizeof(*r));
+		if (!r) return NULL;
+		r->rec = malloc(sizeof(TraceRecord) * TRACE_RING_SIZE);
+		if (!r->rec) {
+			free(r);
+			return NULL;
+		}
+		pthread_mutex_lock(&trace_lock);
+		r->thread = trace_threads++;
+		pthread_mutex_unlock(&trace_lock);
+		pthread_setspecific(ring_key, r);
+	}
+	r->count = 0;
+	return r;
+}
+
+/* Appends the ring as one chunk, oldest record first */
+void trace_flush(TraceRing *r, const Position *root, int depth) {
+	TraceChunk c;
+	memset(&c, 0, sizeof(c));
+	memcpy(c.magic, "GCECHNK", 8);
+	c.thread = r->thread;
+	c.total = r->count;
+	c.count = r->count < TRACE_RING_SIZE ? (uint32_t)r->count : TRACE_RING_SIZE;
+	c.depth = depth;
+	position_to_fen(root, c.fen);
+	uint32_t start = (uint32_t)(r->count - c.count) & (TRACE_RING_SIZE - 1);
+	uint32_t first = TRACE_RING_SIZE - start < c.count
+	               ? TRACE_RING_SIZE - start : c.count;
+
+	pthread_mutex_lock(&trace_lock);
+	if (trace_file) {
+		c.search = trace_searches++;
+		fwrite(&c, sizeof(c), 1, trace_file);
+		fwrite(r->rec + start, sizeof(TraceRecord), first, trace_file);
+		fwrite(r->rec, sizeof(TraceRecord), c.count - first, trace_file);
+		fflush(trace_file);
+	}
+	pthread_mutex_unlock(&trace_lock);
+	r->count = 0;
+}
@@ -0,0 +1,144 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "board.h"
+#include "movegen.h"
+#include <string.h>
+
+/*
+ * Search-tree tracer, compiled in with -DGCE_TRACE. Each thread records
+ * every node into its own ring buffer as the node returns, so children
+ * come before their parent and the tree can be rebuilt from the plies
+ * alone. At the end of a search the ring is appended to the trace file
+ * as one chunk; gce-trace reads it back.
+ *
+ * File: "GCETRC1\0", then per search a TraceChunk followed by its
+ * records, oldest first, in native byte order.
+ */
+#define TRACE_MAGIC "GCETRC1"
+
+#ifndef TRACE_RING_BITS
+#define TRACE_RING_BITS 18   /* 256K nodes, 5 MB per thread */
+#endif
+#define TRACE_RING_SIZE (1u << TRACE_RING_BITS)
+
+/* Why a node returned what it did */
+enum {
+	TRACE_NONE, TRACE_STOP, TRACE_DRAW, TRACE_MAXPLY, TRACE_TT,
+	TRACE_RFP, TRACE_RAZOR, TRACE_NULL, TRACE_MATE, TRACE_BETA,
+	TRACE_ALL, TRACE_PV, TRACE_STANDPAT, TRACE_QS,
+	TRACE_FUTILITY, TRACE_LMP,   /* moves pruned without a search */
+	TRACE_KINDS
+};
+
+/* TraceRecord.flags */
+#define TRACE_F_NULL     1   /* null-move child */
+#define TRACE_F_RESEARCH 2   /* re-search after LMR or a zero window */
+#define TRACE_F_QS       4   /* quiescence node */
+
+typedef struct {
+	int32_t  alpha, beta, score;   /* window on entry, side to move's view */
+	uint16_t move;                 /* move into the node, 0 for root/null */
+	uint8_t  ply;
+	int8_t   depth;
+	uint8_t  kind;
+	uint8_t  reduction;            /* LMR plies taken off this node */
+	uint8_t  flags;
+	uint8_t  pad;
+} TraceRecord;
+
+typedef struct {
+	char     magic[8];             /* "GCECHNK" */
+	uint32_t thread;
+	uint32_t search;
+	uint64_t total;                /* nodes recorded, count + lost to the ring */
+	uint32_t count;
+	int32_t  depth;                /* completed depth */
+	char     fen[FEN_MAX];
+} TraceChunk;
+
+/* What a parent tells the tracer about the child it is about to search */
+typedef struct {
+	uint16_t move;
+	uint8_t  kind, reduction, flags;
+} TracePly;
+
+typedef struct {
+	TraceRecord *rec;
+	uint64_t     count;
+	uint32_t     thread;
+} TraceRing;
+
+static inline uint16_t trace_move(const Move *m) {
+	return (uint16_t)(m->from | m->to << 6 | (m->flags & 0x0F) << 12);
+}
+
+static inline void trace_node(TraceRing *r, const TracePly *tp, int ply,
+                              int depth, int alpha, int beta, int score) {
+	TraceRecord *t = &r->rec[r->count++ & (TRACE_RING_SIZE - 1)];
+	t->alpha = alpha;
+	t->beta = beta;
+	t->score = score;
+	t->move = tp->move;
+	t->ply = (uint8_t)ply;
+	t->depth = (int8_t)depth;
+	t->kind = tp->kind;
+	t->reduction = tp->reduction;
+	t->flags = tp->flags;
+	t->pad = 0;
+}
+
+static const char *const trace_kind_names[TRACE_KINDS] = {
+	"-", "stop", "draw", "maxply", "tt", "rfp", "razor", "null", "mate",
+	"beta", "all", "pv", "standpat", "qs", "futility", "lmp"
+};
+
+/* Coordinate notation; "0000" for the root and null moves */
+static inline void trace_move_str(uint16_t move, char *buf) {
+	int from = move & 63, to = (move >> 6) & 63, flags = move >> 12;
+	if (!move) {
+		memcpy(buf, "0000", 5);
+		return;
+	}
+	buf[0] = (char)('a' + (from & 7));
+	buf[1] = (char)('1' + (from >> 3));
+	buf[2] = (char)('a' + (to & 7));
+	buf[3] = (char)('1' + (to >> 3));
+	buf[4] = MOVE_IS_PROMO(flags) ? "nbrq"[flags & 3] : '\0';
+	buf[5] = '\0';
+}
+
+static inline int trace_kind(TracePly *tp, int kind, int v) {
+	tp->kind = (uint8_t)kind;
+	return v;
+}
+
+bool       trace_open(const char *path);
+void       trace_close(void);
+TraceRing *trace_attach(void);   /* this thread's ring, NULL if no file */
+void       trace_flush(TraceRing *r, const Position *root, int depth);
+
+#ifdef GCE_TRACE
+#define TRACE_ENABLED 1
+/* Set up slot ply + 1 before searching a child */
+#define TRACE_CHILD(s, ply, mv, red, fl) \
+	((s)->trace_path[(ply) + 1] = (TracePly){ (mv), TRACE_NONE, (red), (fl) })
+/* Return v, noting why; v is evaluated first, so it may search */
+#define TRACED(s, ply, k, v) trace_kind(&(s)->trace_path[ply], k, v)
+#define TRACE_NODE(s, ply, depth, alpha, beta, score) \
+	do { if ((s)->trace) trace_node((s)->trace, &(s)->trace_path[ply], \
+	                                ply, depth, alpha, beta, score); } while (0)
+/* A move skipped by futility or move-count pruning, as a leaf */
+#define TRACE_PRUNED(s, ply, mv, k, depth, alpha, beta) \
+	do { TRACE_CHILD(s, ply, mv, 0, 0); \
+	     (s)->trace_path[(ply) + 1].kind = (k); \
+	     TRACE_NODE(s, (ply) + 1, depth, -(beta), -(alpha), 0); } while (0)
+#else
+#define TRACE_ENABLED 0
+#define TRACE_CHILD(s, ply, mv, red, fl) ((void)0)
+#define TRACED(s, ply, k, v) (v)
+#define TRACE_NODE(s, ply, depth, alpha, beta, score) ((void)0)
+#define TRACE_PRUNED(s, ply, mv, k, depth, alpha, beta) ((void)0)
+#endif
+
+#endif
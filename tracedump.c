@@ -0,0 +1,254 @@
+#define _POSIX_C_SOURCE 200809L
+#include "trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Reader for gce --trace files. Without filters it lists the searches in
+ * the file; otherwise it picks one search (the last by default), selects
+ * nodes by ply, move path and kind, prints them and totals their
+ * subtrees. Records are in post-order, so a node's subtree is the run of
+ * records just before it back to its first descendant.
+ */
+
+#define DEFAULT_MAX 20
+#define MAX_PATH    192   /* MAX_PLY plus quiescence */
+
+typedef struct {
+	TraceChunk   head;
+	TraceRecord *rec;
+	int         *parent;   /* -1 for roots and nodes whose parent was lost */
+	int         *first;    /* first record of the node's subtree */
+} Search;
+
+static void usage(const char *prog) {
+	fprintf(stderr,
+		"usage: %s <trace file> [--search N] [--ply N] [--path m1,m2,...]\n"
+		"          [--kind name] [--max N]\n"
+		"Without filters the searches in the file are listed. --path selects\n"
+		"nodes reached by those moves from the root, --ply those at that ply\n"
+		"(below --path if both are given). Selected nodes are printed and\n"
+		"their subtrees totalled.\n",
+		prog);
+}
+
+static bool read_search(FILE *f, Search *s, bool keep) {
+	if (fread(&s->head, sizeof(s->head), 1, f) != 1
+	    || memcmp(s->head.magic, "GCECHNK", 8) != 0)
+		return false;
+	if (!keep)
+		return fseek(f, (long)(s->head.count * sizeof(TraceRecord)), SEEK_CUR) == 0;
+	size_t n = s->head.count;
+	s->rec = malloc(n * sizeof(TraceRecord) + 1);
+	s->parent = malloc(n * sizeof(int) + 1);
+	s->first = malloc(n * sizeof(int) + 1);
+	if (!s->rec || !s->parent || !s->first
+	    || fread(s->rec, sizeof(TraceRecord), n, f) != n)
+		return false;
+
+	/* Children are the records on the stack with a higher ply */
+	int *stack = malloc(n * sizeof(int) + 1);
+	int sp = 0;
+	for (int i = 0; i < (int)n; i++) {
+		s->parent[i] = -1;
+		s->first[i] = i;
+		while (sp > 0 && s->rec[stack[sp - 1]].ply > s->rec[i].ply) {
+			int c = stack[--sp];
+			if (s->rec[c].ply == s->rec[i].ply + 1) s->parent[c] = i;
+			if (s->first[c] < s->first[i]) s->first[i] = s->first[c];
+		}
+		stack[sp++] = i;
+	}
+	free(stack);
+	return true;
+}
+
+/* Moves from the root to node i, or -1 if its root was lost */
+static int node_path(const Search *s, int i, uint16_t *path) {
+	int len = s->rec[i].ply;
+	if (len > MAX_PATH) return -1;
+	for (int at = i; s->rec[at].ply > 0; at = s->parent[at]) {
+		if (s->parent[at] < 0) return -1;
+		path[s->rec[at].ply - 1] = s->rec[at].move;
+	}
+	return len;
+}
+
+static void print_node(const Search *s, int i) {
+	const TraceRecord *r = &s->rec[i];
+	uint16_t path[MAX_PATH];
+	char line[MAX_PATH * 6 + 8] = "", mv[8];
+	int len = node_path(s, i, path);
+	if (len < 0) {
+		trace_move_str(r->move, mv);
+		snprintf(line, sizeof(line), "... %s", mv);
+	}
+	for (int k = 0, n = 0; k < len; k++) {
+		trace_move_str(path[k], mv);
+		n += snprintf(line + n, sizeof(line) - (size_t)n, "%s%s", k ? " " : "", mv);
+	}
+	printf("ply %-3d depth %-3d [%d, %d] score %-7d %-8s %s%s%s%s%s\n",
+	       r->ply, r->depth, r->alpha, r->beta, r->score,
+	       trace_kind_names[r->kind < TRACE_KINDS ? r->kind : 0],
+	       line[0] ? line : "(root)",
+	       r->reduction ? " reduced" : "",
+	       r->flags & TRACE_F_NULL ? " null" : "",
+	       r->flags & TRACE_F_RESEARCH ? " research" : "",
+	       r->flags & TRACE_F_QS ? " qs" : "");
+}
+
+/* "e2e4,e7e8q": squares into path, promotion letters into promo */
+static int parse_path(const char *arg, uint16_t *path, char *promo) {
+	char buf[MAX_PATH * 6 + 8];
+	int n = 0;
+	snprintf(buf, sizeof(buf), "%s", arg);
+	for (char *tok = strtok(buf, ","); tok && n < MAX_PATH; tok = strtok(NULL, ",")) {
+		size_t len = strlen(tok);
+		if (len < 4 || len > 5) return -1;
+		int from = (tok[0] - 'a') + (tok[1] - '1') * 8;
+		int to = (tok[2] - 'a') + (tok[3] - '1') * 8;
+		if (from < 0 || from > 63 || to < 0 || to > 63) return -1;
+		if (len == 5 && !strchr("nbrq", tok[4])) return -1;
+		promo[n] = len == 5 ? tok[4] : 0;
+		path[n++] = (uint16_t)(from | to << 6);
+	}
+	return n;
+}
+
+/* Same squares and promotion piece; the other flags are not typed in */
+static bool same_move(uint16_t traced, uint16_t typed, char promo) {
+	if ((traced & 0x0FFF) != typed) return false;
+	int flags = traced >> 12;
+	char p = MOVE_IS_PROMO(flags) ? "nbrq"[flags & 3] : 0;
+	return p == promo || (p == 'q' && promo == 0);
+}
+
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		usage(argv[0]);
+		return 1;
+	}
+	int want = -1, ply = -1, max = DEFAULT_MAX, kind = -1, path_len = -1;
+	uint16_t path[MAX_PATH];
+	char promo[MAX_PATH];
+	for (int i = 2; i < argc; i++) {
+		const char *a = argv[i];
+		bool has1 = i + 1 < argc;
+		if (strcmp(a, "--search") == 0 && has1) {
+			want = atoi(argv[++i]);
+		} else if (strcmp(a, "--ply") == 0 && has1) {
+			ply = atoi(argv[++i]);
+		} else if (strcmp(a, "--max") == 0 && has1) {
+			max = atoi(argv[++i]);
+		} else if (strcmp(a, "--path") == 0 && has1) {
+			const char *arg = argv[++i];
+			path_len = parse_path(arg, path, promo);
+			if (path_len < 0) {
+				fprintf(stderr, "bad move path: %s\n", arg);
+				return 1;
+			}
+		} else if (strcmp(a, "--kind") == 0 && has1) {
+			const char *name = argv[++i];
+			for (int k = 0; k < TRACE_KINDS; k++)
+				if (strcmp(trace_kind_names[k], name) == 0) kind = k;
+			if (kind < 0) {
+				fprintf(stderr, "unknown kind: %s\n", name);
+				return 1;
+			}
+		} else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+	bool list = want < 0 && ply < 0 && path_len < 0 && kind < 0;
+
+	FILE *f = fopen(argv[1], "rb");
+	char magic[8];
+	if (!f || fread(magic, 1, 8, f) != 8 || memcmp(magic, TRACE_MAGIC, 8) != 0) {
+		fprintf(stderr, "%s is not a gce trace\n", argv[1]);
+		if (f) fclose(f);
+		return 1;
+	}
+
+	/* Find the search: the last one unless --search names it */
+	Search s;
+	memset(&s, 0, sizeof(s));
+	long pos = ftell(f), found = -1;
+	int n_searches = 0;
+	while (read_search(f, &s, false)) {
+		if (list)
+			printf("search %-4u thread %-3u depth %-3d nodes %llu (%u kept)  %s\n",
+			       s.head.search, s.head.thread, s.head.depth,
+			       (unsigned long long)s.head.total, s.head.count, s.head.fen);
+		if (want < 0 || (int)s.head.search == want) found = pos;
+		pos = ftell(f);
+		n_searches++;
+	}
+	if (list || found < 0) {
+		if (!list) fprintf(stderr, "no such search\n");
+		fclose(f);
+		return list ? 0 : 1;
+	}
+	fseek(f, found, SEEK_SET);
+	if (!read_search(f, &s, true)) {
+		fprintf(stderr, "truncated trace\n");
+		fclose(f);
+		return 1;
+	}
+	fclose(f);
+	printf("search %u of %d, depth %d, %s\n\n", s.head.search, n_searches,
+	       s.head.depth, s.head.fen);
+
+	if (path_len < 0) path_len = 0;
+	if (ply < 0) ply = path_len;
+	uint64_t matched = 0, nodes = 0, pruned = 0, qnodes = 0;
+	uint64_t reduced = 0, research = 0;
+	uint64_t by_kind[TRACE_KINDS] = {0};
+	int max_ply = 0;
+	for (int i = 0; i < (int)s.head.count; i++) {
+		const TraceRecord *r = &s.rec[i];
+		if (r->ply != ply || (kind >= 0 && r->kind != kind)) continue;
+		if (path_len > 0) {
+			uint16_t np[MAX_PATH];
+			if (node_path(&s, i, np) < path_len) continue;
+			bool ok = true;
+			for (int k = 0; k < path_len && ok; k++)
+				ok = same_move(np[k], path[k], promo[k]);
+			if (!ok) continue;
+		}
+		if (matched++ < (uint64_t)max) print_node(&s, i);
+		for (int j = s.first[i]; j <= i; j++) {
+			const TraceRecord *d = &s.rec[j];
+			by_kind[d->kind < TRACE_KINDS ? d->kind : 0]++;
+			if (d->kind == TRACE_FUTILITY || d->kind == TRACE_LMP) {
+				pruned++;
+				continue;
+			}
+			nodes++;
+			/* Full-width nodes at depth 0 went straight to quiescence */
+			if ((d->flags & TRACE_F_QS) || d->depth <= 0) qnodes++;
+			if (d->reduction) reduced++;
+			if (d->flags & TRACE_F_RESEARCH) research++;
+			if (d->ply > max_ply) max_ply = d->ply;
+		}
+	}
+	if (matched > (uint64_t)max)
+		printf("... %llu more\n", (unsigned long long)(matched - (uint64_t)max));
+	if (!matched) {
+		printf("no matching nodes\n");
+		return 0;
+	}
+
+	printf("\n%llu nodes matched; subtrees: %llu nodes, %llu pruned moves, "
+	       "max ply %d\n", (unsigned long long)matched,
+	       (unsigned long long)nodes, (unsigned long long)pruned, max_ply);
+	printf("quiescence %.1f%%, reduced %llu, re-searched %llu\n",
+	       nodes ? 100.0 * (double)qnodes / (double)nodes : 0.0,
+	       (unsigned long long)reduced, (unsigned long long)research);
+	for (int k = 0; k < TRACE_KINDS; k++)
+		if (by_kind[k])
+			printf("  %-9s %10llu\n", trace_kind_names[k],
+			       (unsigned long long)by_kind[k]);
+	return 0;
+}
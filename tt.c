@@ -0,0 +1,309 @@
+#define _POSIX_C_SOURCE 200809L
+#include "tt.h"
+#include "profile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+
+/*
+ * Transposition table, shared by every search thread. Each entry stores
+ * key ^ data next to data, so a torn write fails the key check instead of
+ * returning a corrupt entry. The same check makes it safe to share the
+ * table between processes through a MAP_SHARED file.
+ *
+ * Saved files and mapped files use one layout: a 16-byte header (magic,
+ * entry count) followed by the raw entries.
+ */
+
+typedef struct {
+	uint64_t key_xor;
+	uint64_t data;
+} TTEntry;
+
+typedef struct {
+	char     magic[8];
+	uint64_t entries;
+} TTFileHeader;
+
+static const char tt_magic[8] = "GCETT001";
+
+static TTEntry *tt;
+static uint64_t tt_mask;
+static size_t   tt_entries;
+static void    *tt_map;          /* mapping base when file backed */
+static size_t   tt_map_size;
+static char     tt_path[4096];
+static pthread_once_t  tt_alloc_once = PTHREAD_ONCE_INIT;
+
+static int64_t tt_time_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/* Largest power-of-two entry count that fits in mb megabytes */
+static size_t tt_entries_for(size_t mb) {
+	if (mb < 1) mb = 1;
+	if (mb > TT_MAX_MB) mb = TT_MAX_MB;
+	size_t n = 1;
+	while (n * 2 * sizeof(TTEntry) <= mb << 20) n *= 2;
+	return n;
+}
+
+static void tt_release(void) {
+	if (tt_map) munmap(tt_map, tt_map_size);
+	else free(tt);
+	tt = NULL;
+	tt_map = NULL;
+	tt_map_size = 0;
+	tt_entries = 0;
+	tt_path[0] = '\0';
+}
+
+bool tt_resize(size_t mb) {
+	size_t n = tt_entries_for(mb);
+	TTEntry *t = calloc(n, sizeof(TTEntry));
+	if (!t) return false;
+	tt_release();
+	tt = t;
+	tt_entries = n;
+	tt_mask = n - 1;
+	return true;
+}
+
+/* Back the table with a shared file. An existing table file keeps its
+ * own size; an empty or new one is given mb megabytes. The check and the
+ * set-up run under an exclusive lock, so engines started together agree
+ * on one table, and a file that is not a table is never overwritten. */
+bool tt_map_file(const char *path, size_t mb, char *msg, size_t msg_size) {
+	if (strlen(path) >= sizeof(tt_path)) {
+		snprintf(msg, msg_size, "path too long");
+		return false;
+	}
+	int fd = open(path, O_RDWR | O_CREAT, 0644);
+	if (fd < 0 || flock(fd, LOCK_EX) < 0) {
+		snprintf(msg, msg_size, "cannot open %s", path);
+		if (fd >= 0) close(fd);
+		return false;
+	}
+
+	TTFileHeader h;
+	size_t n;
+	struct stat st;
+	if (fstat(fd, &st) < 0) {
+		snprintf(msg, msg_size, "cannot open %s", path);
+		close(fd);
+		return false;
+	}
+	if (st.st_size == 0) {
+		n = tt_entries_for(mb);
+		memcpy(h.magic, tt_magic, 8);
+		h.entries = n;
+		if (ftruncate(fd, (off_t)(sizeof(h) + n * sizeof(TTEntry))) < 0 ||
+		    pwrite(fd, &h, sizeof(h), 0) != (ssize_t)sizeof(h)) {
+			snprintf(msg, msg_size, "cannot create %s", path);
+			/* Leave it empty, as found, so the next attempt sets it up */
+			if (ftruncate(fd, 0) < 0) unlink(path);
+			close(fd);
+			return false;
+		}
+	} else if ((size_t)st.st_size >= sizeof(h)
+	           && pread(fd, &h, sizeof(h), 0) == (ssize_t)sizeof(h)
+	           && memcmp(h.magic, tt_magic, 8) == 0 && h.entries
+	           && (h.entries & (h.entries - 1)) == 0
+	           && (size_t)st.st_size == sizeof(h) + h.entries * sizeof(TTEntry)) {
+		n = (size_t)h.entries;
+	} else {
+		snprintf(msg, msg_size, "%s is not a GCE hash file", path);
+		close(fd);
+		return false;
+	}
+
+	size_t size = sizeof(h) + n * sizeof(TTEntry);
+	void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);   /* drops the lock */
+	if (base == MAP_FAILED) {
+		snprintf(msg, msg_size, "cannot map %s", path);
+		return false;
+	}
+
+	tt_release();
+	tt_map = base;
+	tt_map_size = size;
+	tt = (TTEntry *)((char *)base + sizeof(h));
+	tt_entries = n;
+	tt_mask = n - 1;
+	strcpy(tt_path, path);
+	return true;
+}
+
+/* Halve the default size until it fits; below 1 MB tt stays NULL */
+static void tt_alloc_default(void) {
+	for (size_t mb = TT_DEFAULT_MB; !tt && mb >= 1; mb /= 2)
+		tt_resize(mb);
+}
+
+/* The default table is allocated by whatever needs it first, usually
+ * the first search, so starting the engine costs no page mappings.
+ * Server and analyze workers may all get here at once; pthread_once
+ * makes each of them see the finished table, mask included. Resizing
+ * only happens between searches. False when there is no table. */
+bool tt_ensure(void) {
+	pthread_once(&tt_alloc_once, tt_alloc_default);
+	return tt != NULL;
+}
+
+void tt_clear(void) {
+	if (tt) memset(tt, 0, tt_entries * sizeof(TTEntry));
+}
+
+/* Called on every new game: a shared file table is other processes'
+ * work too, so only a private table is cleared. */
+void tt_new_game(void) {
+	if (tt && !tt_map) tt_clear();
+}
+
+size_t tt_size_mb(void) {
+	if (!tt) return TT_DEFAULT_MB;
+	return tt_entries * sizeof(TTEntry) >> 20;
+}
+
+const char *tt_file(void) {
+	return tt_map ? tt_path : NULL;
+}
+
+static uint64_t tt_pack(int score, int depth, int flag, Move m) {
+	return (uint64_t)(uint32_t)score
+	     | (uint64_t)(depth & 0xFF) << 32
+	     | (uint64_t)(flag & 0x3) << 40
+	     | (uint64_t)(m.from & 0x3F) << 42
+	     | (uint64_t)(m.to & 0x3F) << 48
+	     | (uint64_t)(m.flags & 0xF) << 54;
+}
+
+bool tt_probe(uint64_t key, TTData *out) {
+	PROF_BEGIN(t);
+	TTEntry *e = &tt[key & tt_mask];
+	uint64_t data = e->data;
+	bool hit = (e->key_xor ^ data) == key && data != 0;
+	if (hit) {
+		out->score = (int32_t)(uint32_t)data;
+		out->depth = (int)((data >> 32) & 0xFF);
+		out->flag  = (int)((data >> 40) & 0x3);
+		out->best_move.from  = (int)((data >> 42) & 0x3F);
+		out->best_move.to    = (int)((data >> 48) & 0x3F);
+		out->best_move.flags = (int)((data >> 54) & 0xF);
+	}
+	PROF_END(PROF_TT_PROBE, t);
+	return hit;
+}
+
+void tt_store(uint64_t key, int score, int depth, int flag, Move best) {
+	PROF_BEGIN(t);
+	TTEntry *e = &tt[key & tt_mask];
+	uint64_t old = e->data;
+	int old_depth = (int)((old >> 32) & 0xFF);
+	if (old == 0 || (e->key_xor ^ old) == key || depth >= old_depth) {
+		uint64_t data = tt_pack(score, depth, flag, best);
+		e->key_xor = key ^ data;
+		e->data = data;
+	}
+	PROF_END(PROF_TT_STORE, t);
+}
+
+bool tt_save(const char *path, char *msg, size_t msg_size) {
+	int64_t start = tt_time_ms();
+	if (!tt_ensure()) {
+		snprintf(msg, msg_size, "no hash table to save");
+		return false;
+	}
+	FILE *f = fopen(path, "wb");
+	if (!f) {
+		snprintf(msg, msg_size, "cannot write %s", path);
+		return false;
+	}
+	TTFileHeader h;
+	memcpy(h.magic, tt_magic, 8);
+	h.entries = tt_entries;
+	bool ok = fwrite(&h, sizeof(h), 1, f) == 1 &&
+	          fwrite(tt, sizeof(TTEntry), tt_entries, f) == tt_entries;
+	ok = (fclose(f) == 0) && ok;
+	int64_t ms = tt_time_ms() - start;
+	if (!ok)
+		snprintf(msg, msg_size, "write to %s failed", path);
+	else
+		snprintf(msg, msg_size, "saved %zu MB to %s in %lld ms",
+		         tt_size_mb(), path, (long long)ms);
+	return ok;
+}
+
+/* A table of the same size is read straight in; any other size is
+ * rehashed entry by entry, keeping only entries whose key verifies.
+ * A mapped table belongs to every engine sharing it and is left alone. */
+bool tt_load(const char *path, char *msg, size_t msg_size) {
+	if (tt_map) {
+		snprintf(msg, msg_size, "not loading into %s: it would overwrite "
+		         "the table other engines share", tt_path);
+		return false;
+	}
+	int64_t start = tt_time_ms();
+	if (!tt_ensure()) {
+		snprintf(msg, msg_size, "cannot allocate a hash table to load into");
+		return false;
+	}
+	FILE *f = fopen(path, "rb");
+	if (!f) {
+		snprintf(msg, msg_size, "cannot open %s", path);
+		return false;
+	}
+	TTFileHeader h;
+	if (fread(&h, sizeof(h), 1, f) != 1 || memcmp(h.magic, tt_magic, 8) != 0
+	    || h.entries == 0 || (h.entries & (h.entries - 1)) != 0) {
+		fclose(f);
+		snprintf(msg, msg_size, "%s is not a GCE hash file", path);
+		return false;
+	}
+
+	size_t loaded = 0;
+	bool ok = true;
+	if (h.entries == tt_entries) {
+		ok = fread(tt, sizeof(TTEntry), tt_entries, f) == tt_entries;
+		loaded = tt_entries;
+	} else {
+		TTEntry buf[4096];
+		tt_clear();
+		for (uint64_t left = h.entries; left > 0 && ok; ) {
+			size_t want = left < 4096 ? (size_t)left : 4096;
+			ok = fread(buf, sizeof(TTEntry), want, f) == want;
+			for (size_t i = 0; ok && i < want; i++) {
+				if (buf[i].data == 0) continue;
+				uint64_t key = buf[i].key_xor ^ buf[i].data;
+				TTEntry *e = &tt[key & tt_mask];
+				if (e->data == 0 || ((buf[i].data >> 32) & 0xFF) >=
+				                    ((e->data >> 32) & 0xFF)) {
+					*e = buf[i];
+					loaded++;
+				}
+			}
+			left -= want;
+		}
+	}
+	fclose(f);
+	if (!ok) {
+		tt_clear();
+		snprintf(msg, msg_size, "%s is truncated", path);
+		return false;
+	}
+	int64_t ms = tt_time_ms() - start;
+	double mb = (double)(h.entries * sizeof(TTEntry)) / (1 << 20);
+	snprintf(msg, msg_size, "loaded %.0f MB (%zu entries) from %s in %lld ms (%.0f MB/s)",
+	         mb, loaded, path, (long long)ms, ms > 0 ? mb * 1000 / ms : mb * 1000);
+	return true;
+}
@@ -0,0 +1,32 @@
+#ifndef TT_H
+#define TT_H
+
+#include "movegen.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define TT_EXACT 0
+#define TT_ALPHA 1
+#define TT_BETA  2
+
+#define TT_DEFAULT_MB 16
+#define TT_MAX_MB     65536
+
+typedef struct {
+	int score, depth, flag;
+	Move best_move;
+} TTData;
+
+bool   tt_resize(size_t mb);
+bool   tt_map_file(const char *path, size_t mb, char *msg, size_t msg_size);
+bool   tt_ensure(void);
+void   tt_new_game(void);
+void   tt_clear(void);
+bool   tt_probe(uint64_t key, TTData *out);
+void   tt_store(uint64_t key, int score, int depth, int flag, Move best);
+bool   tt_save(const char *path, char *msg, size_t msg_size);
+bool   tt_load(const char *path, char *msg, size_t msg_size);
+size_t tt_size_mb(void);
+const char *tt_file(void);
+
+#endif
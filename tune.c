@@ -0,0 +1,574 @@
+#define _POSIX_C_SOURCE 200809L
+#include "board.h"
+#include "attack.h"
+#include "engine.h"
+#include "material.h"
+#include "evalparams.h"
+#include "epd.h"
+#include "sfen.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+/*
+ * Texel tuner for the weights in evalparams.h. Every labelled position is
+ * reduced once, at load time, to a sparse trace: how many times each
+ * weight enters the evaluation, white minus black. The evaluation is then
+ * a dot product of trace and weights, so the logistic loss and its exact
+ * gradient over the whole set take one pass over packed arrays, split
+ * across threads. Positions owned by a specialised endgame evaluator are
+ * skipped, as their score does not depend on the weights.
+ */
+
+enum {
+	T_VALUE       = 0,                  /* pawn..queen */
+	T_PST         = T_VALUE + 5,        /* pawn..queen, king middlegame */
+	T_KING_EG     = T_PST + 6 * 64,
+	T_BISHOP_PAIR = T_KING_EG + 64,
+	T_KNIGHT_ADJ,
+	T_ROOK_ADJ,
+	T_DOUBLED,
+	T_ISOLATED,
+	T_PASSED,
+	T_SHIELD      = T_PASSED + 8,
+	T_SHIELD_MISSING,
+	T_MOBILITY,
+	T_ROOK_OPEN,
+	T_ROOK_SEMI,
+	NUM_TERMS
+};
+
+#define DEFAULT_EPOCHS 500
+#define DEFAULT_LR     1.0
+#define SAVE_EVERY     100
+#define DARK_SQUARES   0xAA55AA55AA55AA55ULL
+
+/* Coefficients are in units of 1/PHASE_MAX so the tapered king terms
+ * stay integral */
+typedef struct {
+	uint16_t index;
+	int16_t  coeff;
+} TraceTerm;
+
+typedef struct {
+	uint32_t first;     /* into the shard's terms */
+	uint16_t count;
+	uint8_t  scale[2];  /* by the side that is ahead */
+	float    result;    /* 1 white win, 0.5 draw, 0 black win */
+} Sample;
+
+typedef struct {
+	EpdFile    src;     /* this shard's slice of the input, either */
+	const SfenRecord *records;
+	size_t     n_records;
+	Sample    *samples;
+	size_t     n_samples, cap_samples;
+	TraceTerm *terms;
+	size_t     n_terms, cap_terms;
+	size_t     skipped, invalid, mismatched;
+	double     loss;
+	double     grad[NUM_TERMS];
+} Shard;
+
+typedef struct {
+	int      coeff[NUM_TERMS];
+	uint16_t list[NUM_TERMS];
+	bool     seen[NUM_TERMS];
+	int      n;
+} Trace;
+
+static double weights[NUM_TERMS];
+static double tune_k;
+static bool   with_grad;
+
+static int64_t now_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static void init_weights(void) {
+	static const int *pst[NUM_PIECE_TYPES] = {
+		pst_pawn, pst_knight, pst_bishop, pst_rook, pst_queen, pst_king_mg
+	};
+	static const int values[5] = {
+		VAL_PAWN, VAL_KNIGHT, VAL_BISHOP, VAL_ROOK, VAL_QUEEN
+	};
+	for (int pt = PAWN; pt <= QUEEN; pt++)
+		weights[T_VALUE + pt] = values[pt];
+	for (int pt = PAWN; pt <= KING; pt++)
+		for (int sq = 0; sq < 64; sq++)
+			weights[T_PST + pt * 64 + sq] = pst[pt][sq];
+	for (int sq = 0; sq < 64; sq++)
+		weights[T_KING_EG + sq] = pst_king_eg[sq];
+	for (int r = 0; r < 8; r++)
+		weights[T_PASSED + r] = passed_pawn[r];
+	weights[T_BISHOP_PAIR] = BISHOP_PAIR;
+	weights[T_KNIGHT_ADJ] = KNIGHT_PAWN_ADJ;
+	weights[T_ROOK_ADJ] = ROOK_PAWN_ADJ;
+	weights[T_DOUBLED] = DOUBLED_PAWN;
+	weights[T_ISOLATED] = ISOLATED_PAWN;
+	weights[T_SHIELD] = SHIELD_PAWN;
+	weights[T_SHIELD_MISSING] = SHIELD_MISSING;
+	weights[T_MOBILITY] = MOBILITY;
+	weights[T_ROOK_OPEN] = ROOK_OPEN_FILE;
+	weights[T_ROOK_SEMI] = ROOK_SEMI_OPEN;
+}
+
+static void trace_add(Trace *t, int index, int coeff) {
+	if (!t->seen[index]) {
+		t->seen[index] = true;
+		t->list[t->n++] = (uint16_t)index;
+	}
+	t->coeff[index] += coeff;
+}
+
+/* One side's share of evaluate_ai(), term by term */
+static void trace_side(Trace *t, const Position *p, const AttackInfo *ai,
+                       Color c, int phase) {
+	int sign = c == WHITE ? 1 : -1;
+	int s = sign * PHASE_MAX;
+	int flip = c == WHITE ? 0 : 56;
+	int cnt[NUM_PIECE_TYPES];
+	for (int pt = PAWN; pt <= KING; pt++)
+		cnt[pt] = __builtin_popcountll(p->pieces[c][pt]);
+
+	for (int pt = PAWN; pt <= QUEEN; pt++)
+		trace_add(t, T_VALUE + pt, s * cnt[pt]);
+	if (cnt[BISHOP] >= 2)
+		trace_add(t, T_BISHOP_PAIR, s);
+	trace_add(t, T_KNIGHT_ADJ, s * cnt[KNIGHT] * (cnt[PAWN] - 5));
+	trace_add(t, T_ROOK_ADJ, s * cnt[ROOK] * (cnt[PAWN] - 5));
+
+	for (int pt = PAWN; pt < KING; pt++)
+		for (Bitboard bb = p->pieces[c][pt]; bb; bb &= bb - 1)
+			trace_add(t, T_PST + pt * 64 + (__builtin_ctzll(bb) ^ flip), s);
+
+	Bitboard pawns = p->pieces[c][PAWN];
+	Bitboard enemy = p->pieces[c ^ 1][PAWN];
+	for (Bitboard bb = pawns; bb; bb &= bb - 1) {
+		int sq = __builtin_ctzll(bb);
+		int f = SQ_FILE(sq), r = SQ_RANK(sq);
+		Bitboard file = 0x0101010101010101ULL << f;
+		Bitboard adj = ((file << 1) & ~0x0101010101010101ULL)
+		             | ((file >> 1) & ~0x8080808080808080ULL);
+		if (pawns & file & ~(1ULL << sq))
+			trace_add(t, T_DOUBLED, s);
+		if (!(pawns & adj))
+			trace_add(t, T_ISOLATED, s);
+		Bitboard front = c == WHITE
+		               ? (r < 7 ? ~0ULL << (8 * (r + 1)) : 0)
+		               : (1ULL << (8 * r)) - 1;
+		if (!(enemy & (file | adj) & front))
+			trace_add(t, T_PASSED + (c == WHITE ? r : 7 - r), s);
+	}
+
+	Bitboard king = p->pieces[c][KING];
+	if (!king) return;
+	int ksq = __builtin_ctzll(king);
+	trace_add(t, T_PST + KING * 64 + (ksq ^ flip), sign * phase);
+	trace_add(t, T_KING_EG + (ksq ^ flip), sign * (PHASE_MAX - phase));
+
+	for (int f = SQ_FILE(ksq) - 1; f <= SQ_FILE(ksq) + 1; f++) {
+		if (f < 0 || f > 7) continue;
+		Bitboard fpawns = pawns & (0x0101010101010101ULL << f);
+		if (!fpawns) {
+			trace_add(t, T_SHIELD_MISSING, s);
+			continue;
+		}
+		int dist = c == WHITE
+		         ? SQ_RANK(__builtin_ctzll(fpawns)) - SQ_RANK(ksq)
+		         : SQ_RANK(ksq) - SQ_RANK(63 - __builtin_clzll(fpawns));
+		if (dist >= 1 && dist <= 2)
+			trace_add(t, T_SHIELD, s);
+	}
+
+	trace_add(t, T_MOBILITY, s * ai->mobility[c]);
+
+	for (Bitboard bb = p->pieces[c][ROOK]; bb; bb &= bb - 1) {
+		Bitboard file = 0x0101010101010101ULL << SQ_FILE(__builtin_ctzll(bb));
+		if (!(pawns & file))
+			trace_add(t, (enemy & file) ? T_ROOK_SEMI : T_ROOK_OPEN, s);
+	}
+}
+
+static double linear_eval(const TraceTerm *terms, int count,
+                          const uint8_t *scale) {
+	double e = 0;
+	for (int i = 0; i < count; i++)
+		e += terms[i].coeff * weights[terms[i].index];
+	e /= PHASE_MAX;
+	return e * scale[e > 0 ? WHITE : BLACK] / SCALE_NORMAL;
+}
+
+static bool parse_result(const char *s, float *out) {
+	if (strcmp(s, "1-0") == 0) *out = 1.0f;
+	else if (strcmp(s, "0-1") == 0) *out = 0.0f;
+	else if (strcmp(s, "1/2-1/2") == 0) *out = 0.5f;
+	else return false;
+	return true;
+}
+
+static void shard_add(Shard *sh, const Position *p, float result) {
+	static __thread Trace t;
+	MaterialEntry *me = material_probe(p);
+	if (me->eval_fn) {
+		sh->skipped++;
+		return;
+	}
+	AttackInfo ai;
+	compute_attack_info(p, &ai);
+	trace_side(&t, p, &ai, WHITE, me->phase);
+	trace_side(&t, p, &ai, BLACK, me->phase);
+
+	if (sh->n_samples == sh->cap_samples) {
+		sh->cap_samples = sh->cap_samples ? sh->cap_samples * 2 : 4096;
+		sh->samples = realloc(sh->samples, sh->cap_samples * sizeof(Sample));
+	}
+	if (sh->n_terms + NUM_TERMS > sh->cap_terms) {
+		sh->cap_terms = sh->cap_terms ? sh->cap_terms * 2 : 65536;
+		sh->terms = realloc(sh->terms, sh->cap_terms * sizeof(TraceTerm));
+	}
+	if (!sh->samples || !sh->terms) {
+		fprintf(stderr, "out of memory\n");
+		exit(1);
+	}
+
+	Sample *smp = &sh->samples[sh->n_samples++];
+	smp->first = (uint32_t)sh->n_terms;
+	smp->count = 0;
+	for (int i = 0; i < t.n; i++) {
+		int idx = t.list[i];
+		if (t.coeff[idx]) {
+			sh->terms[sh->n_terms++] = (TraceTerm){ (uint16_t)idx,
+			                                        (int16_t)t.coeff[idx] };
+			smp->count++;
+		}
+		t.coeff[idx] = 0;
+		t.seen[idx] = false;
+	}
+	t.n = 0;
+
+	smp->scale[WHITE] = me->scale[WHITE];
+	smp->scale[BLACK] = me->scale[BLACK];
+	if (me->ocb_candidate) {
+		bool wdark = (p->pieces[WHITE][BISHOP] & DARK_SQUARES) != 0;
+		bool bdark = (p->pieces[BLACK][BISHOP] & DARK_SQUARES) != 0;
+		for (int c = 0; c < 2; c++)
+			if (wdark != bdark && smp->scale[c] > SCALE_NORMAL / 2)
+				smp->scale[c] = SCALE_NORMAL / 2;
+	}
+	smp->result = result;
+
+	/* The trace must reproduce evaluate() up to integer rounding */
+	double e = linear_eval(sh->terms + smp->first, smp->count, smp->scale);
+	if (fabs(e - evaluate(p)) > 2)
+		sh->mismatched++;
+}
+
+static void *shard_load(void *arg) {
+	Shard *sh = arg;
+	size_t offset = 0, len, ops_len;
+	const char *line, *ops;
+	char fen[128], result[16];
+	Position p;
+	for (size_t i = 0; i < sh->n_records; i++) {
+		const SfenRecord *r = &sh->records[i];
+		if (!sfen_unpack(&r->pos, &p) || r->result < -1 || r->result > 1) {
+			sh->invalid++;
+			continue;
+		}
+		int white_result = p.white_turn ? r->result : -r->result;
+		shard_add(sh, &p, (white_result + 1) / 2.0f);
+	}
+	while (epd_next_line(&sh->src, &offset, &line, &len)) {
+		float r;
+		if (!epd_parse(line, len, &p, fen, sizeof(fen), &ops, &ops_len)
+		    || !epd_opcode(ops, ops_len, "c9", result, sizeof(result))
+		    || !parse_result(result, &r)) {
+			sh->invalid++;
+			continue;
+		}
+		shard_add(sh, &p, r);
+	}
+	return NULL;
+}
+
+/* Loss (and gradient, up to a constant factor) of one shard */
+static void *shard_pass(void *arg) {
+	Shard *sh = arg;
+	const double k = tune_k * log(10.0) / 400.0;
+	double loss = 0;
+	if (with_grad) memset(sh->grad, 0, sizeof(sh->grad));
+	for (size_t i = 0; i < sh->n_samples; i++) {
+		const Sample *smp = &sh->samples[i];
+		const TraceTerm *terms = sh->terms + smp->first;
+		double e = linear_eval(terms, smp->count, smp->scale);
+		double sig = 1.0 / (1.0 + exp(-k * e));
+		double err = sig - smp->result;
+		loss += err * err;
+		if (!with_grad) continue;
+		double g = err * sig * (1.0 - sig)
+		         * smp->scale[e > 0 ? WHITE : BLACK] / SCALE_NORMAL;
+		for (int j = 0; j < smp->count; j++)
+			sh->grad[terms[j].index] += g * terms[j].coeff;
+	}
+	sh->loss = loss;
+	return NULL;
+}
+
+static void run_shards(Shard *shards, int n, void *(*fn)(void *)) {
+	pthread_t tids[n];
+	for (int i = 0; i < n; i++)
+		pthread_create(&tids[i], NULL, fn, &shards[i]);
+	for (int i = 0; i < n; i++)
+		pthread_join(tids[i], NULL);
+}
+
+/* Mean squared error over all shards; fills grad when it is non-NULL */
+static double total_loss(Shard *shards, int n, size_t count, double *grad) {
+	with_grad = grad != NULL;
+	run_shards(shards, n, shard_pass);
+	double loss = 0;
+	for (int i = 0; i < n; i++)
+		loss += shards[i].loss;
+	if (grad) {
+		double f = 2.0 * tune_k * log(10.0) / 400.0 / PHASE_MAX / count;
+		for (int t = 0; t < NUM_TERMS; t++) {
+			grad[t] = 0;
+			for (int i = 0; i < n; i++)
+				grad[t] += shards[i].grad[t];
+			grad[t] *= f;
+		}
+	}
+	return loss / count;
+}
+
+/* Scaling constant that best fits the untuned evaluation to the results */
+static double find_k(Shard *shards, int n, size_t count) {
+	const double phi = (sqrt(5.0) - 1) / 2;
+	double a = 0.1, b = 4.0;
+	double c = b - phi * (b - a), d = a + phi * (b - a);
+	tune_k = c;
+	double fc = total_loss(shards, n, count, NULL);
+	tune_k = d;
+	double fd = total_loss(shards, n, count, NULL);
+	while (b - a > 1e-4) {
+		if (fc < fd) {
+			b = d; d = c; fd = fc;
+			c = b - phi * (b - a);
+			tune_k = c;
+			fc = total_loss(shards, n, count, NULL);
+		} else {
+			a = c; c = d; fc = fd;
+			d = a + phi * (b - a);
+			tune_k = d;
+			fd = total_loss(shards, n, count, NULL);
+		}
+	}
+	return (a + b) / 2;
+}
+
+static int w(int index) {
+	return (int)lround(weights[index]);
+}
+
+static void write_table(FILE *f, int first, int n) {
+	for (int i = 0; i < n; i++)
+		fprintf(f, "%s%4d%s", i % 8 ? " " : "\t", w(first + i),
+		        i == n - 1 ? "\n" : i % 8 == 7 ? ",\n" : ",");
+}
+
+static void write_pst(FILE *f, const char *name, int first) {
+	fprintf(f, "static const int %s[64] = {\n", name);
+	write_table(f, first, 64);
+	fprintf(f, "};\n");
+}
+
+static bool write_params(const char *path) {
+	char tmp[4096];
+	snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+	FILE *f = fopen(tmp, "w");
+	if (!f) return false;
+	fprintf(f,
+		"/* Evaluation weights in centipawns. gce-tune rewrites this file with\n"
+		" * tuned values; hand edits are kept until the next tuning run. */\n"
+		"#ifndef EVALPARAMS_H\n#define EVALPARAMS_H\n\n"
+		"#include \"board.h\"\n\n");
+	static const char *values[5] = {
+		"VAL_PAWN  ", "VAL_KNIGHT", "VAL_BISHOP", "VAL_ROOK  ", "VAL_QUEEN "
+	};
+	for (int pt = PAWN; pt <= QUEEN; pt++)
+		fprintf(f, "#define %s        %4d\n", values[pt], w(T_VALUE + pt));
+	fprintf(f, "\n");
+	fprintf(f, "#define BISHOP_PAIR       %4d\n", w(T_BISHOP_PAIR));
+	fprintf(f, "#define KNIGHT_PAWN_ADJ   %4d  /* per own pawn above five */\n",
+	        w(T_KNIGHT_ADJ));
+	fprintf(f, "#define ROOK_PAWN_ADJ     %4d  /* per own pawn above five */\n",
+	        w(T_ROOK_ADJ));
+	fprintf(f, "#define DOUBLED_PAWN      %4d\n", w(T_DOUBLED));
+	fprintf(f, "#define ISOLATED_PAWN     %4d\n", w(T_ISOLATED));
+	fprintf(f, "#define SHIELD_PAWN       %4d  /* per file next to the king */\n",
+	        w(T_SHIELD));
+	fprintf(f, "#define SHIELD_MISSING    %4d\n", w(T_SHIELD_MISSING));
+	fprintf(f, "#define MOBILITY          %4d  /* per move */\n", w(T_MOBILITY));
+	fprintf(f, "#define ROOK_OPEN_FILE    %4d\n", w(T_ROOK_OPEN));
+	fprintf(f, "#define ROOK_SEMI_OPEN    %4d\n", w(T_ROOK_SEMI));
+
+	fprintf(f, "\n/* Passed pawn by relative rank */\n"
+	           "static const int passed_pawn[8] = {\n");
+	write_table(f, T_PASSED, 8);
+	fprintf(f, "};\n\n");
+
+	fprintf(f, "/* Piece-square tables from white's side, a1 first */\n");
+	write_pst(f, "pst_pawn", T_PST + PAWN * 64);
+	write_pst(f, "pst_knight", T_PST + KNIGHT * 64);
+	write_pst(f, "pst_bishop", T_PST + BISHOP * 64);
+	write_pst(f, "pst_rook", T_PST + ROOK * 64);
+	write_pst(f, "pst_queen", T_PST + QUEEN * 64);
+	write_pst(f, "pst_king_mg", T_PST + KING * 64);
+	write_pst(f, "pst_king_eg", T_KING_EG);
+	fprintf(f, "\n#endif\n");
+	if (fclose(f) != 0) return false;
+	return rename(tmp, path) == 0;
+}
+
+static void usage(const char *prog) {
+	fprintf(stderr,
+		"usage: %s <positions.epd|records.bin> [--threads N] [--epochs N]\n"
+		"          [--lr X] [--k K] [--out evalparams.h]\n"
+		"EPD positions need a result opcode: c9 \"1-0\", \"0-1\" or \"1/2-1/2\".\n"
+		"A .bin file is read as --gensfen records.\n",
+		prog);
+}
+
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		usage(argv[0]);
+		return 1;
+	}
+	int threads = 0, epochs = DEFAULT_EPOCHS;
+	double lr = DEFAULT_LR;
+	const char *out = "evalparams.h";
+	tune_k = 0;
+	for (int i = 2; i < argc; i++) {
+		const char *a = argv[i];
+		bool has1 = i + 1 < argc;
+		if (strcmp(a, "--threads") == 0 && has1) {
+			threads = atoi(argv[++i]);
+		} else if (strcmp(a, "--epochs") == 0 && has1) {
+			epochs = atoi(argv[++i]);
+		} else if (strcmp(a, "--lr") == 0 && has1) {
+			lr = atof(argv[++i]);
+		} else if (strcmp(a, "--k") == 0 && has1) {
+			tune_k = atof(argv[++i]);
+		} else if (strcmp(a, "--out") == 0 && has1) {
+			out = argv[++i];
+		} else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+	if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if (threads < 1) threads = 1;
+
+	init_weights();
+
+	/* Each thread loads, and later scores, its own slice of the file */
+	size_t len = strlen(argv[1]);
+	bool binary = len > 4 && strcmp(argv[1] + len - 4, ".bin") == 0;
+	EpdFile file = { NULL, 0 };
+	SfenFile records = { NULL, 0 };
+	if (binary ? !sfen_open(&records, argv[1]) : !epd_open(&file, argv[1])) {
+		fprintf(stderr, "cannot open %s\n", argv[1]);
+		return 1;
+	}
+	int64_t t0 = now_ms();
+	Shard *shards = calloc((size_t)threads, sizeof(Shard));
+	for (int i = 0; i < threads; i++) {
+		size_t first = records.count / threads * i;
+		shards[i].records = records.records + first;
+		shards[i].n_records = i == threads - 1 ? records.count - first
+		                                       : records.count / threads;
+	}
+	size_t begin = 0;
+	for (int i = 0; i < threads; i++) {
+		size_t end = file.size / threads * (i + 1);
+		if (i == threads - 1) end = file.size;
+		while (end > 0 && end < file.size && file.data[end - 1] != '\n')
+			end++;
+		if (end < begin) end = begin;
+		shards[i].src.data = file.data + begin;
+		shards[i].src.size = end - begin;
+		begin = end;
+	}
+	run_shards(shards, threads, shard_load);
+	epd_close(&file);
+	sfen_close(&records);
+
+	size_t count = 0, skipped = 0, invalid = 0, mismatched = 0, terms = 0;
+	for (int i = 0; i < threads; i++) {
+		count += shards[i].n_samples;
+		skipped += shards[i].skipped;
+		invalid += shards[i].invalid;
+		mismatched += shards[i].mismatched;
+		terms += shards[i].n_terms;
+	}
+	printf("Loaded %zu positions in %.1f s, %.1f terms each, %.0f MB"
+	       " (%zu invalid, %zu in endgame evaluators)\n",
+	       count, (now_ms() - t0) / 1000.0, count ? (double)terms / count : 0,
+	       (count * sizeof(Sample) + terms * sizeof(TraceTerm)) / 1048576.0,
+	       invalid, skipped);
+	if (mismatched)
+		printf("warning: %zu positions evaluate differently from"
+		       " evaluate(); the trace is out of date\n", mismatched);
+	if (count == 0) return 1;
+
+	if (tune_k <= 0) {
+		tune_k = find_k(shards, threads, count);
+		printf("K = %.4f\n", tune_k);
+	}
+
+	static double grad[NUM_TERMS], m[NUM_TERMS], v[NUM_TERMS];
+	const double beta1 = 0.9, beta2 = 0.999, eps = 1e-8;
+	t0 = now_ms();
+	double loss = total_loss(shards, threads, count, NULL);
+	printf("Initial loss %.6f, %lld ms per pass on %d threads\n",
+	       loss, (long long)(now_ms() - t0), threads);
+	fflush(stdout);
+
+	t0 = now_ms();
+	for (int epoch = 1; epoch <= epochs; epoch++) {
+		loss = total_loss(shards, threads, count, grad);
+		double c1 = 1 - pow(beta1, epoch), c2 = 1 - pow(beta2, epoch);
+		for (int t = 0; t < NUM_TERMS; t++) {
+			m[t] = beta1 * m[t] + (1 - beta1) * grad[t];
+			v[t] = beta2 * v[t] + (1 - beta2) * grad[t] * grad[t];
+			weights[t] -= lr * (m[t] / c1) / (sqrt(v[t] / c2) + eps);
+		}
+		if (epoch % 10 == 0 || epoch == epochs) {
+			printf("epoch %4d  loss %.6f  %lld ms per epoch\n", epoch, loss,
+			       (long long)((now_ms() - t0) / epoch));
+			fflush(stdout);
+		}
+		if (epoch % SAVE_EVERY == 0 && !write_params(out))
+			fprintf(stderr, "cannot write %s\n", out);
+	}
+	printf("Final loss %.6f\n", total_loss(shards, threads, count, NULL));
+	if (!write_params(out)) {
+		fprintf(stderr, "cannot write %s\n", out);
+		return 1;
+	}
+	printf("Weights written to %s\n", out);
+
+	for (int i = 0; i < threads; i++) {
+		free(shards[i].samples);
+		free(shards[i].terms);
+	}
+	free(shards);
+	return 0;
+}
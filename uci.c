@@ -4,15 +4,27 @@
 #include "movegen.h"
 #include "move.h"
 #include "engine.h"
+#include "tt.h"
+#include "nnue.h"
+#include "kernels.h"
+#include "stats.h"
+#include "profile.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 #include <sys/select.h>
 
 static Position pos;
 static volatile int uci_quit_requested = 0;
 
+static int64_t uci_time_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
 static int stdin_has_data(void) {
 	fd_set fds;
 	struct timeval tv = {0, 0};
@@ -39,12 +51,30 @@ static void uci_check_input(void) {
 	}
 }
 
-static void handle_position(char *line) {
+/* Plays coordinate moves until the end or the first illegal one */
+static bool apply_moves(Position *pos, const char *moves) {
+	while (*moves) {
+		while (*moves == ' ') moves++;
+		if (*moves == '\0') break;
+		char ms[12];
+		int i = 0;
+		while (*moves && *moves != ' ' && i < 11)
+			ms[i++] = *moves++;
+		ms[i] = '\0';
+		Move m;
+		if (!parse_move(ms, pos, &m)) return false;
+		make_move(pos, &m);
+	}
+	return true;
+}
+
+/* False if the FEN or one of the moves was rejected */
+bool uci_parse_position(Position *pos, char *line) {
 	char *ptr = line + 8;
 	while (*ptr == ' ') ptr++;
 
 	if (strncmp(ptr, "startpos", 8) == 0) {
-		init_position(&pos);
+		init_position(pos);
 		ptr += 8;
 	} else if (strncmp(ptr, "fen", 3) == 0) {
 		ptr += 3;
@@ -52,34 +82,19 @@ static void handle_position(char *line) {
 		char *mp = strstr(ptr, " moves ");
 		if (mp) {
 			*mp = '\0';
-			if (!position_from_fen(&pos, ptr)) return;
+			if (!position_from_fen(pos, ptr)) return false;
 			*mp = ' ';
 			ptr = mp;
 		} else {
-			if (!position_from_fen(&pos, ptr)) return;
-			return;
+			return position_from_fen(pos, ptr);
 		}
 	} else {
-		return;
+		return false;
 	}
 
 	char *moves = strstr(ptr, "moves");
-	if (!moves) return;
-	moves += 5;
-	while (*moves) {
-		while (*moves == ' ') moves++;
-		if (*moves == '\0') break;
-		char ms[12];
-		int i = 0;
-		while (*moves && *moves != ' ' && i < 11)
-			ms[i++] = *moves++;
-		ms[i] = '\0';
-		Move m;
-		if (parse_move(ms, &pos, &m))
-			make_move(&pos, &m);
-		else
-			break;
-	}
+	if (!moves) return true;
+	return apply_moves(pos, moves + 5);
 }
 
 static int parse_int_after(const char *str, const char *key) {
@@ -91,7 +106,8 @@ static int parse_int_after(const char *str, const char *key) {
 	return atoi(p);
 }
 
-static void handle_go(const char *line) {
+void uci_parse_go(const char *line, const Position *pos,
+                  int *depth_out, int64_t *time_out) {
 	int max_depth = 0;
 	int64_t time_limit = 0;
 
@@ -109,8 +125,8 @@ static void handle_go(const char *line) {
 	if (mt > 0) {
 		time_limit = mt;
 	} else if (wt >= 0 || bt >= 0) {
-		int our_time = pos.white_turn ? wt : bt;
-		int our_inc  = pos.white_turn ? (wi > 0 ? wi : 0) : (bi > 0 ? bi : 0);
+		int our_time = pos->white_turn ? wt : bt;
+		int our_inc  = pos->white_turn ? (wi > 0 ? wi : 0) : (bi > 0 ? bi : 0);
 		if (our_time > 0) {
 			if (mtg > 0) {
 				time_limit = our_time / (mtg + 2) + our_inc;
@@ -133,6 +149,25 @@ static void handle_go(const char *line) {
 		else
 			max_depth = DEFAULT_DEPTH;
 	}
+	*depth_out = max_depth;
+	*time_out = time_limit;
+}
+
+void uci_bestmove_line(char *buf, const Move *best,
+                       const Move *pv, int pv_len) {
+	char ms[8];
+	move_to_str(best, ms);
+	int n = sprintf(buf, "bestmove %s", ms);
+	if (pv_len >= 2 && pv[0].from == best->from && pv[0].to == best->to) {
+		move_to_str(&pv[1], ms);
+		sprintf(buf + n, " ponder %s", ms);
+	}
+}
+
+static void handle_go(const char *line) {
+	int max_depth;
+	int64_t time_limit;
+	uci_parse_go(line, &pos, &max_depth, &time_limit);
 
 	MoveList legal;
 	generate_legal_moves(&pos, &legal);
@@ -144,41 +179,183 @@ static void handle_go(const char *line) {
 
 	engine_check_fn = uci_check_input;
 	Move best;
+	profile_reset();
 	engine_search_uci(&pos, max_depth, time_limit, &best);
 	engine_check_fn = NULL;
+	if (PROF_ENABLED) profile_report("info string ");
 
-	char buf[8];
-	move_to_str(&best, buf);
-	printf("bestmove %s\n", buf);
+	char buf[32];
+	Move pv[MAX_PLY];
+	int pv_len = engine_last_pv(pv);
+	uci_bestmove_line(buf, &best, pv, pv_len);
+	printf("%s\n", buf);
 	fflush(stdout);
 }
 
-void uci_loop(void) {
-	printf("id name GCE\n");
+/* The last position command, while pos is still its result */
+static char  *last_position;
+static size_t last_position_len, last_position_cap;
+
+/* A GUI resends the whole game every move; when the command extends the
+ * previous one only the new moves are played */
+static void handle_position(char *line) {
+	size_t len = strlen(line), n = last_position_len;
+	const char *rest = NULL;
+	if (n > 0 && len >= n && memcmp(line, last_position, n) == 0
+	    && (line[n] == ' ' || line[n] == '\0')) {
+		rest = line + n;
+		while (*rest == ' ') rest++;
+		/* The keyword is part of the new text if the last had no moves */
+		if (*rest && !strstr(last_position, " moves")) {
+			if (strncmp(rest, "moves", 5) == 0
+			    && (rest[5] == ' ' || rest[5] == '\0'))
+				rest += 5;
+			else
+				rest = NULL;
+		}
+	}
+	bool ok = rest ? apply_moves(&pos, rest) : uci_parse_position(&pos, line);
+
+	last_position_len = 0;
+	if (!ok) return;
+	if (len + 1 > last_position_cap) {
+		char *grown = realloc(last_position, len + 1);
+		if (!grown) return;
+		last_position = grown;
+		last_position_cap = len + 1;
+	}
+	memcpy(last_position, line, len + 1);
+	last_position_len = len;
+}
+
+static void uci_id(void) {
+	printf("id name GCE (%s)\n", kernels_name());
 	printf("id author GCE Team\n");
+	printf("option name Hash type spin default %d min 1 max %d\n",
+	       TT_DEFAULT_MB, TT_MAX_MB);
+	printf("option name HashFile type string default <empty>\n");
+	printf("option name UseNNUE type check default %s\n",
+	       nnue_enabled ? "true" : "false");
+	printf("option name EvalFile type string default <default>\n");
+	if (TRACE_ENABLED)
+		printf("option name TraceFile type string default <empty>\n");
+	printf("option name Kernels type combo default %s", kernels_level(0));
+	for (int i = 0; kernels_level(i); i++)
+		printf(" var %s", kernels_level(i));
+	printf("\n");
 	printf("uciok\n");
 	fflush(stdout);
+}
+
+/* setoption name <name> value <value> */
+static void handle_setoption(char *line) {
+	char *name = strstr(line, "name ");
+	if (!name) return;
+	name += 5;
+	char *value = strstr(name, " value ");
+	if (value) {
+		*value = '\0';
+		value += 7;
+	}
+
+	if (strcmp(name, "Hash") == 0 && value) {
+		int64_t start = uci_time_ms();
+		if (tt_file())
+			printf("info string Hash is fixed by HashFile %s\n", tt_file());
+		else if (!tt_resize((size_t)atoi(value)))
+			printf("info string cannot allocate %s MB\n", value);
+		else
+			printf("info string hash %zu MB allocated in %lld ms\n",
+			       tt_size_mb(), (long long)(uci_time_ms() - start));
+	} else if (strcmp(name, "HashFile") == 0) {
+		int64_t start = uci_time_ms();
+		char msg[512];
+		if (!value || !*value || strcmp(value, "<empty>") == 0) {
+			tt_resize(tt_size_mb());
+			printf("info string hash is private again\n");
+		} else if (!tt_map_file(value, tt_size_mb(), msg, sizeof(msg))) {
+			printf("info string %s\n", msg);
+		} else {
+			printf("info string hash %zu MB mapped from %s in %lld ms\n",
+			       tt_size_mb(), value, (long long)(uci_time_ms() - start));
+		}
+	} else if (strcmp(name, "UseNNUE") == 0 && value) {
+		nnue_enabled = strcmp(value, "true") == 0;
+		if (nnue_enabled) nnue_init();
+		printf("info string %s evaluation\n",
+		       nnue_enabled ? "NNUE" : "classic");
+	} else if (strcmp(name, "EvalFile") == 0) {
+		/* Choosing a net also switches NNUE on */
+		if (!value || !*value || strcmp(value, "<default>") == 0) {
+			nnue_use_default();
+			nnue_enabled = true;
+		} else if (nnue_load(value)) {
+			nnue_enabled = true;
+		} else {
+			printf("info string cannot load net %s, keeping %s\n",
+			       value, nnue_net_name());
+			fflush(stdout);
+			return;
+		}
+		printf("info string NNUE net %s, %s kernels\n",
+		       nnue_net_name(), nnue_kernel());
+	} else if (TRACE_ENABLED && strcmp(name, "TraceFile") == 0) {
+		if (!value || !*value || strcmp(value, "<empty>") == 0) {
+			trace_close();
+			printf("info string tracing off\n");
+		} else if (trace_open(value)) {
+			printf("info string tracing searches to %s\n", value);
+		} else {
+			printf("info string cannot create %s\n", value);
+		}
+	} else if (strcmp(name, "Kernels") == 0 && value) {
+		if (kernels_select(value))
+			printf("info string %s kernels, %s\n", kernels_name(), kernels->simd);
+		else
+			printf("info string %s kernels not supported here, keeping %s\n",
+			       value, kernels_name());
+	}
+	fflush(stdout);
+}
+
+/* savehash <file> / loadhash <file> */
+static void handle_hash_file(const char *line, bool save) {
+	const char *path = line + 8;
+	while (*path == ' ') path++;
+	char msg[512];
+	if (!*path)
+		snprintf(msg, sizeof(msg), "usage: %s <file>", save ? "savehash" : "loadhash");
+	else if (save)
+		tt_save(path, msg, sizeof(msg));
+	else
+		tt_load(path, msg, sizeof(msg));
+	printf("info string %s\n", msg);
+	fflush(stdout);
+}
+
+void uci_loop(void) {
+	uci_id();
 
 	init_position(&pos);
 	uci_quit_requested = 0;
 
-	char line[16384];
-	while (fgets(line, sizeof(line), stdin)) {
+	/* Grows with the game; position commands have no length limit */
+	char *line = NULL;
+	size_t line_cap = 0;
+	while (getline(&line, &line_cap, stdin) != -1) {
 		line[strcspn(line, "\n")] = '\0';
 		line[strcspn(line, "\r")] = '\0';
 		if (line[0] == '\0') continue;
 
 		if (strcmp(line, "uci") == 0) {
-			printf("id name GCE\n");
-			printf("id author GCE Team\n");
-			printf("uciok\n");
-			fflush(stdout);
+			uci_id();
 		} else if (strcmp(line, "isready") == 0) {
 			printf("readyok\n");
 			fflush(stdout);
 		} else if (strcmp(line, "ucinewgame") == 0) {
 			engine_init();
 			init_position(&pos);
+			last_position_len = 0;
 		} else if (strncmp(line, "position", 8) == 0 &&
 		           (line[8] == '\0' || line[8] == ' ')) {
 			handle_position(line);
@@ -186,10 +363,25 @@ void uci_loop(void) {
 		           (line[2] == '\0' || line[2] == ' ')) {
 			handle_go(line);
 			if (uci_quit_requested) break;
+		} else if (strncmp(line, "setoption ", 10) == 0) {
+			handle_setoption(line);
+		} else if (strncmp(line, "savehash", 8) == 0 &&
+		           (line[8] == '\0' || line[8] == ' ')) {
+			handle_hash_file(line, true);
+		} else if (strncmp(line, "loadhash", 8) == 0 &&
+		           (line[8] == '\0' || line[8] == ' ')) {
+			handle_hash_file(line, false);
+		} else if (strcmp(line, "debug on") == 0 || strcmp(line, "debug off") == 0) {
+			engine_debug = line[7] == 'n';
+			if (engine_debug && !STATS_ENABLED) {
+				printf("info string search statistics need a -DGCE_STATS build\n");
+				fflush(stdout);
+			}
 		} else if (strcmp(line, "stop") == 0) {
 			engine_stop = 1;
 		} else if (strcmp(line, "quit") == 0) {
 			break;
 		}
 	}
+	free(line);
 }
@@ -1,6 +1,14 @@
 #ifndef UCI_H
 #define UCI_H
 
+#include "board.h"
+#include "movegen.h"
+
 void uci_loop(void);
+bool uci_parse_position(Position *pos, char *line);
+void uci_parse_go(const char *line, const Position *pos,
+                  int *max_depth, int64_t *time_limit);
+void uci_bestmove_line(char *buf, const Move *best,
+                       const Move *pv, int pv_len);
 
 #endif
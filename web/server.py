@@ -3,9 +3,12 @@
 
 import json
 import os
+import queue
+import sqlite3
 import subprocess
 import sys
 import threading
+import time
 
 import chess
 from flask import Flask, send_from_directory
@@ -14,13 +17,86 @@ from flask_sock import Sock
 ENGINE_PATH = os.path.join(os.path.dirname(__file__), "..", "gce")
 WEB_DIR = os.path.dirname(os.path.abspath(__file__))
 DEFAULT_DEPTH = 6
+POOL_SIZE = int(os.environ.get("GCE_POOL_SIZE", os.cpu_count() or 2))
+QUEUE_LIMIT = int(os.environ.get("GCE_QUEUE_LIMIT", POOL_SIZE * 4))
+CACHE_PATH = os.environ.get("GCE_CACHE_PATH", os.path.join(WEB_DIR, "analysis.db"))
+CACHE_SIZE = int(os.environ.get("GCE_CACHE_SIZE", 100000))
+
+
+def position_key(board):
+    """Normalized FEN: placement, side, castling and a capturable ep square."""
+    return " ".join(board.fen(en_passant="legal").split()[:4])
+
+
+class AnalysisCache:
+    """On-disk search results shared by all sessions, with LRU eviction."""
+
+    def __init__(self, path=CACHE_PATH, max_entries=CACHE_SIZE):
+        self.max_entries = max(1, max_entries)
+        self.lock = threading.Lock()
+        self.db = sqlite3.connect(path, check_same_thread=False)
+        self.db.execute("PRAGMA journal_mode=WAL")
+        self.db.execute("PRAGMA synchronous=NORMAL")
+        self.db.execute("""CREATE TABLE IF NOT EXISTS analysis (
+            key TEXT PRIMARY KEY, bestmove TEXT, score_cp INTEGER,
+            score_mate INTEGER, depth INTEGER, pv TEXT, used REAL)""")
+        self.db.execute("CREATE INDEX IF NOT EXISTS analysis_used ON analysis(used)")
+        self.db.commit()
+        self.count = self.db.execute("SELECT COUNT(*) FROM analysis").fetchone()[0]
+
+    def get(self, key, depth):
+        """Return (bestmove, info) searched to at least depth, or None."""
+        with self.lock:
+            row = self.db.execute(
+                "SELECT bestmove, score_cp, score_mate, depth, pv FROM analysis"
+                " WHERE key = ? AND depth >= ?", (key, depth)).fetchone()
+            if not row:
+                return None
+            self.db.execute("UPDATE analysis SET used = ? WHERE key = ?", (time.time(), key))
+            self.db.commit()
+        bestmove, cp, mate, d, pv = row
+        info = {"depth": d, "pv": pv}
+        if mate is not None:
+            info["score_mate"] = mate
+        else:
+            info["score_cp"] = cp
+        return bestmove, info
+
+    def put(self, key, bestmove, info):
+        """Store a result unless a deeper one is already cached."""
+        if not bestmove or "depth" not in info:
+            return
+        row = (bestmove, info.get("score_cp"), info.get("score_mate"),
+               info["depth"], info.get("pv", ""), time.time(), key)
+        with self.lock:
+            old = self.db.execute("SELECT depth FROM analysis WHERE key = ?", (key,)).fetchone()
+            if old and old[0] > info["depth"]:
+                return
+            if old:
+                self.db.execute(
+                    "UPDATE analysis SET bestmove = ?, score_cp = ?, score_mate = ?,"
+                    " depth = ?, pv = ?, used = ? WHERE key = ?", row)
+            else:
+                self.db.execute(
+                    "INSERT INTO analysis (bestmove, score_cp, score_mate, depth, pv, used, key)"
+                    " VALUES (?, ?, ?, ?, ?, ?, ?)", row)
+                self.count += 1
+            if self.count > self.max_entries:
+                # Evict in batches so the delete is not paid on every insert
+                excess = self.count - self.max_entries + self.max_entries // 10
+                self.db.execute(
+                    "DELETE FROM analysis WHERE key IN"
+                    " (SELECT key FROM analysis ORDER BY used LIMIT ?)", (excess,))
+                self.count -= excess
+            self.db.commit()
 
 
 class Engine:
-    """Manages the GCE UCI subprocess (synchronous, one per session)."""
+    """Manages one GCE UCI subprocess (owned by a pool worker)."""
 
     def __init__(self):
         self.proc = None
+        self.write_lock = threading.Lock()
 
     def start(self):
         self.proc = subprocess.Popen(
@@ -47,8 +123,12 @@ class Engine:
 
     def _send(self, cmd):
         if self.proc and self.proc.stdin:
-            self.proc.stdin.write(cmd + "\n")
-            self.proc.stdin.flush()
+            with self.write_lock:
+                self.proc.stdin.write(cmd + "\n")
+                self.proc.stdin.flush()
+
+    def alive(self):
+        return self.proc is not None and self.proc.poll() is None
 
     def _readline(self):
         if self.proc and self.proc.stdout:
@@ -67,6 +147,13 @@ class Engine:
         self._send("isready")
         self._wait_for("readyok")
 
+    def stop_search(self):
+        """Ask a running search to finish; safe to call from another thread."""
+        try:
+            self._send("stop")
+        except (OSError, ValueError):
+            pass
+
     def search(self, fen, depth, info_callback=None):
         """Send position + go, return bestmove UCI string."""
         self._send(f"position fen {fen}")
@@ -75,7 +162,9 @@ class Engine:
         while True:
             line = self._readline()
             if not line:
-                break
+                if not self.alive():
+                    raise OSError("engine exited")
+                continue
             if line.startswith("info") and info_callback:
                 info = self._parse_info(line)
                 if info:
@@ -116,20 +205,155 @@ class Engine:
         return info if info else None
 
 
+class Job:
+    """A batch of searches run back to back on one pooled engine."""
+
+    def __init__(self, searches, on_info, on_done, stream=True):
+        self.searches = searches  # list of (fen, depth)
+        self.on_info = on_info    # thinking updates, with queue_ms/search_ms
+        self.on_done = on_done    # called with [(bestmove, last_info), ...]
+        self.stream = stream      # forward engine info lines, not just the start
+        self.cancelled = False
+        self.engine = None
+        self.lock = threading.Lock()
+        self.submitted = time.monotonic()
+        self.started = None
+
+    def cancel(self):
+        # Holding the lock keeps the stop from reaching the engine's next job
+        with self.lock:
+            self.cancelled = True
+            if self.engine:
+                self.engine.stop_search()
+
+    def latency(self):
+        now = time.monotonic()
+        started = self.started or now
+        return {
+            "queue_ms": int((started - self.submitted) * 1000),
+            "search_ms": int((now - started) * 1000),
+        }
+
+
+class EnginePool:
+    """Fixed set of warm engine processes fed from a bounded job queue."""
+
+    def __init__(self, size=POOL_SIZE, queue_limit=QUEUE_LIMIT):
+        self.size = max(1, size)
+        self.jobs = queue.Queue(maxsize=max(1, queue_limit))
+
+    def start(self):
+        for _ in range(self.size):
+            threading.Thread(target=self._worker, daemon=True).start()
+
+    def submit(self, job):
+        """Queue a job; returns False when the queue is full."""
+        try:
+            self.jobs.put_nowait(job)
+            return True
+        except queue.Full:
+            return False
+
+    def _notify(self, job, info):
+        try:
+            job.on_info({**info, **job.latency()})
+        except Exception:
+            job.cancel()  # client is gone
+
+    def _run(self, engine, job):
+        results = []
+        engine.new_game()  # no hash or history leaks between jobs
+        self._notify(job, {})
+        for fen, depth in job.searches:
+            if job.cancelled:
+                break
+            last = {}
+
+            def on_info(info, last=last):
+                last.update(info)
+                if job.stream:
+                    self._notify(job, info)
+
+            results.append((engine.search(fen, depth, info_callback=on_info), last))
+        return results
+
+    def _worker(self):
+        engine = Engine()
+        engine.start()
+        while True:
+            job = self.jobs.get()
+            with job.lock:
+                if job.cancelled:
+                    continue
+                job.engine = engine
+                job.started = time.monotonic()
+            try:
+                results = self._run(engine, job)
+            except (OSError, ValueError) as e:
+                print(f"[POOL] Engine failed: {e}; restarting", file=sys.stderr)
+                results = None
+                engine.stop()
+                engine = Engine()
+                engine.start()
+            with job.lock:
+                job.engine = None
+            if job.cancelled:
+                continue
+            try:
+                job.on_done(results)
+            except Exception as e:
+                print(f"[POOL] Job callback error: {e}", file=sys.stderr)
+
+
 class Session:
     """Per-client game session."""
 
-    def __init__(self):
+    def __init__(self, pool, cache, send_fn):
+        self.pool = pool
+        self.cache = cache
+        self.send_fn = send_fn
+        self.lock = threading.RLock()
+        self.job = None  # in-flight engine job, if any
         self.board = chess.Board()
-        self.engine = Engine()
         self.depth = DEFAULT_DEPTH
         self.move_history = []  # list of {uci, san, color, number, is_engine, is_capture, is_check, is_castle}
 
-    def start(self):
-        self.engine.start()
-
     def stop(self):
-        self.engine.stop()
+        self._cancel_job()
+
+    def _cancel_job(self):
+        with self.lock:
+            job, self.job = self.job, None
+        if job:
+            job.cancel()
+
+    def _submit(self, searches, on_done, stream=True):
+        """Queue engine work for this session; errors go to the client."""
+        with self.lock:
+            if self.job:
+                self.send_fn(json.dumps({"type": "error", "message": "Engine is already thinking"}))
+                return
+            fen = self.board.fen()
+
+            def on_info(info):
+                self.send_fn(json.dumps({"type": "thinking", **info}))
+
+            def finished(results):
+                with self.lock:
+                    # Drop results for a board that changed or a cancelled job
+                    if self.job is not job or self.board.fen() != fen:
+                        return
+                    self.job = None
+                    if results is None:
+                        self.send_fn(json.dumps({"type": "error", "message": "Engine crashed"}))
+                        return
+                    on_done(results, job.latency())
+
+            job = Job(searches, on_info, finished, stream)
+            if not self.pool.submit(job):
+                self.send_fn(json.dumps({"type": "error", "message": "Server busy, try again shortly"}))
+                return
+            self.job = job
 
     def _record_move(self, move, is_engine=False):
         """Record a move in history (call BEFORE pushing to board)."""
@@ -201,7 +425,11 @@ class Session:
                 state["termination"] = outcome.termination.name.lower()
         return state
 
-    def handle(self, raw, send_fn):
+    def handle(self, raw):
+        with self.lock:
+            self._handle(raw, self.send_fn)
+
+    def _handle(self, raw, send_fn):
         try:
             msg = json.loads(raw)
         except json.JSONDecodeError:
@@ -211,8 +439,8 @@ class Session:
         cmd = msg.get("cmd")
 
         if cmd == "new_game":
+            self._cancel_job()
             self.board = chess.Board()
-            self.engine.new_game()
             self.move_history = []
             send_fn(json.dumps(self.get_state()))
 
@@ -221,6 +449,7 @@ class Session:
             try:
                 move = chess.Move.from_uci(uci_str)
                 if move in self.board.legal_moves:
+                    self._cancel_job()
                     rec = self._record_move(move, is_engine=False)
                     self.board.push(move)
                     state = self.get_state()
@@ -236,55 +465,67 @@ class Session:
                 send_fn(json.dumps({"type": "error", "message": "Game is over"}))
                 return
             depth = msg.get("depth", self.depth)
+            key = position_key(self.board)
+            hit = self.cache.get(key, depth)
+            if hit:
+                latency = {"queue_ms": 0, "search_ms": 0, "cached": True}
+                send_fn(json.dumps({"type": "thinking", **hit[1], **latency}))
+                self._play_engine_move([hit], latency)
+                return
 
-            def info_cb(info):
-                send_fn(json.dumps({"type": "thinking", **info}))
-
-            bestmove = self.engine.search(self.board.fen(), depth, info_callback=info_cb)
-            if bestmove and bestmove != "(none)":
-                try:
-                    move = chess.Move.from_uci(bestmove)
-                    if move in self.board.legal_moves:
-                        rec = self._record_move(move, is_engine=True)
-                        self.board.push(move)
-                        state = self.get_state()
-                        state["engine_move"] = bestmove
-                        state["move_info"] = rec
-                        send_fn(json.dumps(state))
-                    else:
-                        send_fn(json.dumps({"type": "error", "message": f"Engine illegal move: {bestmove}"}))
-                except (ValueError, chess.InvalidMoveError):
-                    send_fn(json.dumps({"type": "error", "message": f"Engine invalid move: {bestmove}"}))
-            else:
-                send_fn(json.dumps({"type": "error", "message": "Engine returned no move"}))
+            def done(results, latency):
+                if results:
+                    self.cache.put(key, *results[0])
+                self._play_engine_move(results, latency)
+
+            self._submit([(self.board.fen(), depth)], done)
 
         elif cmd == "top":
             if self.board.is_game_over():
                 send_fn(json.dumps({"type": "error", "message": "Game is over"}))
                 return
             depth = msg.get("depth", self.depth)
-            results = []
-            for move in self.board.legal_moves:
+            moves = list(self.board.legal_moves)
+            known = {}
+            pending = []  # (move, key, fen) still to be searched
+            for move in moves:
                 copy = self.board.copy()
-                san = copy.san(move)
                 copy.push(move)
-                last_score = [None]
-
-                def score_cb(info, ls=last_score):
+                key = position_key(copy)
+                hit = self.cache.get(key, depth - 1)
+                if hit:
+                    known[move] = hit[1]
+                else:
+                    pending.append((move, key, copy.fen()))
+
+            def done(results, latency):
+                infos = dict(known)
+                for (move, key, _), (bestmove, info) in zip(pending, results):
+                    self.cache.put(key, bestmove, info)
+                    infos[move] = info
+                top = []
+                for move in moves:
+                    info = infos.get(move, {})
                     if "score_cp" in info:
-                        ls[0] = info["score_cp"]
+                        score = -info["score_cp"]
                     elif "score_mate" in info:
-                        ls[0] = info["score_mate"] * 100000
-
-                self.engine.search(copy.fen(), depth - 1, info_callback=score_cb)
-                score = -last_score[0] if last_score[0] is not None else 0
-                results.append({"move": move.uci(), "san": san, "score_cp": score})
+                        score = -info["score_mate"] * 100000
+                    else:
+                        score = 0
+                    top.append({"move": move.uci(), "san": self.board.san(move), "score_cp": score})
+                top.sort(key=lambda r: r["score_cp"], reverse=True)
+                self.send_fn(json.dumps({"type": "top_moves", "moves": top[:5], **latency}))
 
-            results.sort(key=lambda r: r["score_cp"], reverse=True)
-            send_fn(json.dumps({"type": "top_moves", "moves": results[:5]}))
+            if not pending:
+                done([], {"queue_ms": 0, "search_ms": 0, "cached": True})
+                return
+            # Child-position scores would show from the wrong side, so only
+            # the start of the job is reported while it runs
+            self._submit([(fen, depth - 1) for _, _, fen in pending], done, stream=False)
 
         elif cmd == "undo":
             if self.board.move_stack:
+                self._cancel_job()
                 self.board.pop()
                 if self.move_history:
                     self.move_history.pop()
@@ -304,7 +545,7 @@ class Session:
             fen = msg.get("fen", "")
             try:
                 self.board = chess.Board(fen)
-                self.engine.new_game()
+                self._cancel_job()
                 self.move_history = []
                 send_fn(json.dumps(self.get_state()))
             except ValueError:
@@ -316,6 +557,26 @@ class Session:
         else:
             send_fn(json.dumps({"type": "error", "message": f"Unknown command: {cmd}"}))
 
+    def _play_engine_move(self, results, latency):
+        bestmove = results[0][0] if results else None
+        if bestmove and bestmove not in ("(none)", "0000"):
+            try:
+                move = chess.Move.from_uci(bestmove)
+                if move in self.board.legal_moves:
+                    rec = self._record_move(move, is_engine=True)
+                    self.board.push(move)
+                    state = self.get_state()
+                    state["engine_move"] = bestmove
+                    state["move_info"] = rec
+                    state["latency"] = latency
+                    self.send_fn(json.dumps(state))
+                else:
+                    self.send_fn(json.dumps({"type": "error", "message": f"Engine illegal move: {bestmove}"}))
+            except (ValueError, chess.InvalidMoveError):
+                self.send_fn(json.dumps({"type": "error", "message": f"Engine invalid move: {bestmove}"}))
+        else:
+            self.send_fn(json.dumps({"type": "error", "message": "Engine returned no move"}))
+
 
 # ---------------------------------------------------------------------------
 # Flask app
@@ -323,6 +584,8 @@ class Session:
 
 app = Flask(__name__, static_folder=WEB_DIR)
 sock = Sock(app)
+pool = EnginePool()
+cache = None  # AnalysisCache, opened at startup
 
 
 @app.route("/")
@@ -337,15 +600,21 @@ def static_files(path):
 
 @sock.route("/ws")
 def websocket(ws):
-    session = Session()
+    # Pool workers reply from their own threads, so sends are serialised
+    send_lock = threading.Lock()
+
+    def send(data):
+        with send_lock:
+            ws.send(data)
+
+    session = Session(pool, cache, send)
     try:
-        session.start()
-        ws.send(json.dumps(session.get_state()))
+        send(json.dumps(session.get_state()))
         while True:
             data = ws.receive()
             if data is None:
                 break
-            session.handle(data, ws.send)
+            session.handle(data)
     except Exception as e:
         print(f"[WS] Error: {e}", file=sys.stderr)
     finally:
@@ -358,5 +627,9 @@ if __name__ == "__main__":
         print("        Run 'make' first to build the engine.", file=sys.stderr)
         sys.exit(1)
 
+    cache = AnalysisCache()
+    print(f"  Analysis cache: {CACHE_PATH} ({cache.count} positions, limit {cache.max_entries})", flush=True)
+    pool.start()
+    print(f"  Engine pool: {pool.size} processes, queue limit {pool.jobs.maxsize}", flush=True)
     print(f"\n  Open http://localhost:8080 in your browser to play!\n", flush=True)
     app.run(host="0.0.0.0", port=8080, debug=False)